@@ -3,13 +3,15 @@ CONFIG += c++14
 isEmpty(QTC_SOURCE):error(QTC_SOURCE must be set)
 isEmpty(QTC_BUILD):error(QTC_BUILD must be set)
 IDE_BUILD_TREE=$$QTC_BUILD
+# The benchmarks run as plugin tests
+equals(BENCHMARK, 1): TEST = 1
 QTC_PLUGIN_NAME = OCamlCreator
 QTC_PLUGIN_DEPENDS = coreplugin texteditor projectexplorer
 include($$QTC_SOURCE/src/qtcreatorplugin.pri)
 
 CONFIG += qjson
 
-QT     += scxml
+QT     += scxml concurrent
 STATECHARTS += MerlinFSM.scxml
 
 SOURCES += RubyPlugin.cpp \
@@ -29,15 +31,50 @@ SOURCES += RubyPlugin.cpp \
     editor/RubyRubocopHighlighter.cpp \
     editor/RubyScanner.cpp \
     editor/RubySymbolFilter.cpp \
+    editor/SourceCodeStream.cpp \
     editor/OCamlCompletionAssist.cpp \
+    editor/OCamlStringTable.cpp \
+    editor/OCamlIndexFile.cpp \
+    editor/OCamlLexer.cpp \
+    editor/OCamlDeclarationScanner.cpp \
+    editor/OCamlFuzzyIndex.cpp \
+    editor/OCamlOutlineIndex.cpp \
+    editor/OCamlBlockData.cpp \
+    editor/OCamlSemanticHighlighter.cpp \
     projectmanager/RubyProject.cpp \
     projectmanager/RubyProjectNode.cpp \
+    projectmanager/OCamlProjectCrawler.cpp \
+    projectmanager/OCamlSexp.cpp \
+    projectmanager/OCamlDuneProject.cpp \
     #editor/RubyCompletionAssist.cpp \
     #projectmanager/RubyProjectWizard.cpp
 
 
 equals(TEST, 1) {
-    SOURCES += editor/ScannerTest.cpp
+    SOURCES += editor/ScannerTest.cpp \
+        editor/OCamlScannerTest.cpp
+}
+
+# qmake BENCHMARK=1, then "make benchmark" runs the benchmarks over the corpus in
+# benchmark/corpus, see benchmark/OCamlBenchmark.h.
+equals(BENCHMARK, 1) {
+    DEFINES += WITH_BENCHMARKS
+    SOURCES += benchmark/OCamlBenchmark.cpp
+    HEADERS += benchmark/OCamlBenchmark.h
+    RESOURCES += benchmark/benchmark.qrc
+
+    linux {
+        LIBS += -ldl
+        alloccounter.target = $$OUT_PWD/libOCamlAllocationCounter.so
+        alloccounter.depends = $$PWD/benchmark/AllocationCounter.cpp
+        alloccounter.commands = $$QMAKE_CXX -O2 -shared -fPIC -o $$alloccounter.target $$alloccounter.depends
+        QMAKE_EXTRA_TARGETS += alloccounter
+
+        benchmark.depends = alloccounter
+        benchmark.commands = LD_PRELOAD=$$alloccounter.target
+    }
+    benchmark.commands += $$IDE_BIN_PATH/qtcreator -test \"OCamlCreator,benchmark_*\"
+    QMAKE_EXTRA_TARGETS += benchmark
 }
 
 HEADERS += RubyPlugin.h \
@@ -61,8 +98,20 @@ HEADERS += RubyPlugin.h \
     editor/RubySymbolFilter.h \
     editor/SourceCodeStream.h \
     editor/OCamlCompletionAssist.h \
+    editor/OCamlStringTable.h \
+    editor/OCamlCodeModelData.h \
+    editor/OCamlIndexFile.h \
+    editor/OCamlLexer.h \
+    editor/OCamlDeclarationScanner.h \
+    editor/OCamlFuzzyIndex.h \
+    editor/OCamlOutlineIndex.h \
+    editor/OCamlBlockData.h \
+    editor/OCamlSemanticHighlighter.h \
     projectmanager/RubyProject.h \
     projectmanager/RubyProjectNode.h \
+    projectmanager/OCamlProjectCrawler.h \
+    projectmanager/OCamlSexp.h \
+    projectmanager/OCamlDuneProject.h \
     #projectmanager/RubyProjectWizard.h
     #editor/RubyCompletionAssist.h \
 
@@ -70,4 +119,5 @@ RESOURCES += \
     Ruby.qrc
 
 OTHER_FILES += \
-    README.md Ruby.json.in
+    README.md Ruby.json.in \
+    benchmark/AllocationCounter.cpp
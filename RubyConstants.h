@@ -6,6 +6,8 @@ namespace Constants {
 
 const char M_TOOLS_OCAML[]                  = "OCamlCreator.MainMenu";
 const char TASK_CATEGORY_MERLIN_COMPILE[] = "Task.Category.Merlin.Compile";
+const char TASK_INDEX[] = "OCamlCreator.Task.Index";
+const char TASK_OUTLINE[] = "OCamlCreator.Task.Outline";
 const char M_CONTEXT[] = "OcamlEditor.ContextMenu";
 const char SWITCH_INTF_IMPL[] = "OcamlEditor.SwitchIntfImpl";
 const char FIND_USAGES[] = "OcamlEditor.FindUsages";
@@ -10,6 +10,7 @@
 #include "editor/RubyQuickFixes.h"
 #include "editor/RubySymbolFilter.h"
 #include "editor/OCamlCompletionAssist.h"
+#include "editor/OCamlOutlineIndex.h"
 #include "editor/RubyRubocopHighlighter.h"
 #include "projectmanager/RubyProject.h"
 
@@ -17,6 +18,10 @@
 #include "projectmanager/RubyProjectWizard.h"
 #endif
 
+#ifdef WITH_BENCHMARKS
+#include "benchmark/OCamlBenchmark.h"
+#endif
+
 #include <coreplugin/icore.h>
 #include <coreplugin/icontext.h>
 #include <coreplugin/actionmanager/actionmanager.h>
@@ -132,16 +137,20 @@ bool Plugin::initialize(const QStringList &, QString *errorString)
     }
     //ProjectExplorer::ProjectManager::registerProjectType<Project>(Constants::ProjectMimeType);
 
-    // TODO: reenable this stuff
-//    addAutoReleasedObject(new SymbolFilter([](const QString &file) {
-//        return CodeModel::instance()->methodsIn(file);
-//    }, "Ruby Methods in Current Document", '.'));
-//    addAutoReleasedObject(new SymbolFilter([](const QString &) {
-//        return CodeModel::instance()->allMethods();
-//    }, "Ruby methods", 'm'));
-//    addAutoReleasedObject(new SymbolFilter([](const QString &) {
-//        return CodeModel::instance()->allClasses();
-//    }, "Ruby classes", 'c'));
+    addAutoReleasedObject(new SymbolFilter([](const QString &file) {
+        return CodeModel::instance()->declarationsIn(file);
+    }, "OCaml Symbols in Current Document", '.', SymbolFilter::CurrentDocument));
+    addAutoReleasedObject(new SymbolFilter([](const QString &) {
+        return CodeModel::instance()->allMethods();
+    }, "OCaml Values", 'm'));
+    addAutoReleasedObject(new SymbolFilter([](const QString &) {
+        return CodeModel::instance()->allClasses();
+    }, "OCaml Types and Modules", 'c'));
+    auto workspaceFilter = new SymbolFilter([](const QString &) {
+        return OutlineIndex::instance()->allSymbols();
+    }, "OCaml Workspace Symbols (Merlin)", 'w');
+    workspaceFilter->setRevisionProvider([] { return OutlineIndex::instance()->revision(); });
+    addAutoReleasedObject(workspaceFilter);
 
     ProjectExplorer::ProjectManager::registerProjectType<Project>(Constants::OCaml::ProjectMimeType);
 
@@ -170,6 +179,13 @@ void Plugin::extensionsInitialized()
     ProjectExplorer::TaskHub::addCategory(Constants::TASK_CATEGORY_MERLIN_COMPILE, tr("Merlin"));
 }
 
+#ifdef WITH_BENCHMARKS
+QList<QObject *> Plugin::createTestObjects() const
+{
+    return { new Benchmark };
+}
+#endif
+
 QuickFixAssistProvider *Plugin::quickFixProvider()
 {
     return m_quickFixProvider;
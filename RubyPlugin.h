@@ -21,6 +21,10 @@ public:
     virtual void extensionsInitialized() override;
     QuickFixAssistProvider* quickFixProvider();
 
+#ifdef WITH_BENCHMARKS
+    QList<QObject *> createTestObjects() const override;
+#endif
+
 private:
     void initializeToolsSettings();
 
@@ -46,6 +50,16 @@ private slots:
     void test_regexpLiteral();
     void test_brackets();
     void test_keyword_symbols();
+
+    void test_ocamlComments();
+    void test_ocamlLexerThroughput();
+    void test_ocamlKeywords();
+    void test_ocamlLiterals();
+    void test_ocamlDeclarations();
+    void test_ocamlSemanticClasses();
+    void test_fuzzyIndex();
+    void test_ignoreRules();
+    void test_duneProject();
 #endif
 };
 
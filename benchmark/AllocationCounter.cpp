@@ -0,0 +1,41 @@
+// Counts heap allocations for the plugin benchmarks. Built as a small shared
+// library and preloaded into Qt Creator (LD_PRELOAD) by the benchmark target,
+// the benchmarks find the counter with dlsym(). Linux with glibc only.
+
+#include <atomic>
+#include <cstddef>
+
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+
+static std::atomic<unsigned long long> allocations(0);
+
+__attribute__((visibility("default"))) unsigned long long ocamlBenchmarkAllocations()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+// operator new ends up in malloc(), so does every Qt container.
+void *malloc(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+// Growing a QString or a QVector reallocates, count it as an allocation.
+void *realloc(void *pointer, size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(pointer, size);
+}
+
+}
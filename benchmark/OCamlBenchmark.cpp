@@ -0,0 +1,253 @@
+#include "OCamlBenchmark.h"
+
+#include "../editor/OCamlLexer.h"
+#include "../editor/RubyCodeModel.h"
+#include "../editor/RubyHighlighter.h"
+#include "../editor/RubyIndenter.h"
+
+#include <texteditor/tabsettings.h>
+#include <texteditor/textdocumentlayout.h>
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QVector>
+#include <QtTest/QtTest>
+
+#include <algorithm>
+
+#ifdef Q_OS_LINUX
+#include <dlfcn.h>
+#endif
+
+namespace OCamlCreator {
+
+static const char *const CORPUS[] = { "small", "large", "pathological" };
+
+// Every function runs its work at least this many times and for at least this
+// long, and keeps the median run.
+static const int MinimumRuns = 5;
+static const qint64 MinimumTime = 500;
+
+// Number of heap allocations so far, from benchmark/AllocationCounter.cpp when
+// it is preloaded, e.g. with "make benchmark" on Linux.
+typedef unsigned long long (*AllocationCounter)();
+
+static AllocationCounter allocationCounter()
+{
+#ifdef Q_OS_LINUX
+    static const auto counter = reinterpret_cast<AllocationCounter>(dlsym(RTLD_DEFAULT,
+                                                                           "ocamlBenchmarkAllocations"));
+    return counter;
+#else
+    return nullptr;
+#endif
+}
+
+static QString codeModelPath(const QString &name)
+{
+    return QLatin1String("/ocamlbenchmark/") + name + QLatin1String(".ml");
+}
+
+template <typename Work>
+Benchmark::Result Benchmark::measure(const CorpusFile &file, Work work)
+{
+    const AllocationCounter counter = allocationCounter();
+    QVector<qint64> times;
+    times.reserve(1024);
+    unsigned long long allocations = 0;
+
+    QElapsedTimer total;
+    total.start();
+    do {
+        const unsigned long long allocationsBefore = counter ? counter() : 0;
+        QElapsedTimer timer;
+        timer.start();
+        work();
+        const qint64 time = timer.nsecsElapsed();
+        if (counter)
+            allocations += counter() - allocationsBefore;
+        times << qMax(time, qint64(1));
+    } while (times.size() < MinimumRuns || total.elapsed() < MinimumTime);
+
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    const double seconds = times[times.size() / 2] / 1e9;
+
+    Result result;
+    result.megabytesPerSecond = file.bytes / 1e6 / seconds;
+    result.tokensPerSecond = file.tokens / seconds;
+    result.allocationsPerKilobyte = counter ? allocations / double(times.size()) / (file.bytes / 1024.0) : -1;
+    return result;
+}
+
+void Benchmark::initTestCase()
+{
+    for (const char *name : CORPUS) {
+        QFile file(QLatin1String(":/ocamlbenchmark/") + QLatin1String(name) + QLatin1String(".ml"));
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        const QByteArray contents = file.readAll();
+
+        CorpusFile corpusFile;
+        corpusFile.text = QString::fromUtf8(contents);
+        corpusFile.bytes = contents.size();
+        corpusFile.tokens = 0;
+        OCaml::Lexer lexer(&corpusFile.text);
+        while (lexer.read().kind != OCaml::Token::EndOfText)
+            ++corpusFile.tokens;
+        m_corpus.insert(QLatin1String(name), corpusFile);
+    }
+
+    bool ok = false;
+    const double tolerance = qgetenv("OCAML_BENCHMARK_TOLERANCE").toDouble(&ok);
+    if (ok)
+        m_tolerance = tolerance;
+
+    m_baselineFile = QString::fromLocal8Bit(qgetenv("OCAML_BENCHMARK_BASELINE"));
+    QFile baseline(m_baselineFile);
+    if (!m_baselineFile.isEmpty() && baseline.open(QIODevice::ReadOnly))
+        m_baseline = QJsonDocument::fromJson(baseline.readAll()).object();
+    if (!allocationCounter())
+        qDebug("Allocations are not counted, the allocation counter isn't preloaded.");
+}
+
+void Benchmark::cleanupTestCase()
+{
+    for (const char *name : CORPUS)
+        CodeModel::instance()->removeSymbolsFrom(codeModelPath(QLatin1String(name)));
+
+    if (m_baselineFile.isEmpty() || !m_baseline.isEmpty())
+        return;
+    QSaveFile baseline(m_baselineFile);
+    if (baseline.open(QIODevice::WriteOnly)) {
+        baseline.write(QJsonDocument(m_results).toJson());
+        if (baseline.commit())
+            qDebug("Baseline written to %s", qPrintable(m_baselineFile));
+    }
+}
+
+void Benchmark::addCorpusRows()
+{
+    QTest::addColumn<QString>("name");
+    for (const char *name : CORPUS)
+        QTest::newRow(name) << QString::fromLatin1(name);
+}
+
+void Benchmark::report(const QString &name, const Result &result)
+{
+    QString line = QString::fromLatin1("%1: %2 MB/s, %3 Mtokens/s").arg(name)
+            .arg(result.megabytesPerSecond, 0, 'f', 1).arg(result.tokensPerSecond / 1e6, 0, 'f', 2);
+    QJsonObject values;
+    values.insert(QLatin1String("MB/s"), result.megabytesPerSecond);
+    values.insert(QLatin1String("tokens/s"), result.tokensPerSecond);
+    if (result.allocationsPerKilobyte >= 0) {
+        line += QString::fromLatin1(", %1 allocs/KB").arg(result.allocationsPerKilobyte, 0, 'f', 2);
+        values.insert(QLatin1String("allocs/KB"), result.allocationsPerKilobyte);
+    }
+    qDebug("%s", qPrintable(line));
+    m_results.insert(name, values);
+    QTest::setBenchmarkResult(result.megabytesPerSecond * 1e6, QTest::BytesPerSecond);
+
+    const QJsonObject baseline = m_baseline.value(name).toObject();
+    if (baseline.isEmpty())
+        return;
+    const double slowest = baseline.value(QLatin1String("MB/s")).toDouble() * (1 - m_tolerance);
+    QVERIFY2(result.megabytesPerSecond >= slowest,
+             qPrintable(QString::fromLatin1("%1 is slower than the baseline allows (%2 MB/s)")
+                        .arg(name).arg(slowest, 0, 'f', 1)));
+    // Allocations don't depend on the machine, a small slack covers the rounding.
+    if (result.allocationsPerKilobyte >= 0 && baseline.contains(QLatin1String("allocs/KB"))) {
+        const double most = baseline.value(QLatin1String("allocs/KB")).toDouble() * (1 + m_tolerance) + 0.05;
+        QVERIFY2(result.allocationsPerKilobyte <= most,
+                 qPrintable(QString::fromLatin1("%1 allocates more than the baseline allows (%2 allocs/KB)")
+                            .arg(name).arg(most, 0, 'f', 2)));
+    }
+}
+
+void Benchmark::benchmark_lexer_data()
+{
+    addCorpusRows();
+}
+
+void Benchmark::benchmark_lexer()
+{
+    QFETCH(QString, name);
+    const CorpusFile &file = m_corpus[name];
+
+    report(QLatin1String("lexer/") + name, measure(file, [&file] {
+        OCaml::Lexer lexer(&file.text);
+        while (lexer.read().kind != OCaml::Token::EndOfText) {}
+    }));
+}
+
+void Benchmark::benchmark_highlighter_data()
+{
+    addCorpusRows();
+}
+
+void Benchmark::benchmark_highlighter()
+{
+    QFETCH(QString, name);
+    const CorpusFile &file = m_corpus[name];
+
+    QTextDocument document;
+    document.setDocumentLayout(new TextEditor::TextDocumentLayout(&document));
+    document.setPlainText(file.text);
+    Highlighter *highlighter = new Highlighter(&document);
+
+    report(QLatin1String("highlighter/") + name, measure(file, [highlighter] {
+        highlighter->rehighlight();
+    }));
+}
+
+void Benchmark::benchmark_indenter_data()
+{
+    addCorpusRows();
+}
+
+// Indents every block of a highlighted document as typing does, with the
+// in-memory indenter: ocp-indent, which selections go through, depends on what
+// the machine has installed. The first pass changes the indentation, the
+// measured ones redo it on lines that are already indented.
+void Benchmark::benchmark_indenter()
+{
+    QFETCH(QString, name);
+    const CorpusFile &file = m_corpus[name];
+
+    QTextDocument document;
+    document.setDocumentLayout(new TextEditor::TextDocumentLayout(&document));
+    document.setPlainText(file.text);
+    Highlighter *highlighter = new Highlighter(&document);
+    highlighter->rehighlight();
+
+    Indenter indenter;
+    const TextEditor::TabSettings settings;
+    auto indentAll = [&] {
+        for (QTextBlock block = document.firstBlock(); block.isValid(); block = block.next())
+            indenter.indentBlock(&document, block, QChar(), settings);
+    };
+    indentAll();
+
+    report(QLatin1String("indenter/") + name, measure(file, indentAll));
+}
+
+void Benchmark::benchmark_codeModel_data()
+{
+    addCorpusRows();
+}
+
+void Benchmark::benchmark_codeModel()
+{
+    QFETCH(QString, name);
+    const CorpusFile &file = m_corpus[name];
+    const QString path = codeModelPath(name);
+
+    report(QLatin1String("codeModel/") + name, measure(file, [&file, &path] {
+        CodeModel::instance()->updateFile(path, file.text);
+    }));
+    qDebug("%s", qPrintable(CodeModel::instance()->memoryReport(false)));
+}
+
+}
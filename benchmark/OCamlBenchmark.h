@@ -0,0 +1,69 @@
+#ifndef OCaml_Benchmark_h
+#define OCaml_Benchmark_h
+
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+
+namespace OCamlCreator {
+
+// Throughput of the lexer, the highlighter, the indenter and the code model
+// over the files of benchmark/corpus, run as plugin tests:
+//
+//   qtcreator -test "OCamlCreator,benchmark_*"
+//
+// Each function reports MB/s, tokens/s and, when the allocation counter is
+// preloaded (see benchmark/AllocationCounter.cpp), heap allocations per KB.
+// Results are compared with the baseline file named by
+// OCAML_BENCHMARK_BASELINE, and a function fails when it got slower or
+// allocates more than OCAML_BENCHMARK_TOLERANCE (0.15 by default) allows.
+// A baseline that doesn't exist yet is written with the current results.
+class Benchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchmark_lexer_data();
+    void benchmark_lexer();
+    void benchmark_highlighter_data();
+    void benchmark_highlighter();
+    void benchmark_indenter_data();
+    void benchmark_indenter();
+    void benchmark_codeModel_data();
+    void benchmark_codeModel();
+
+private:
+    struct Result
+    {
+        double megabytesPerSecond;
+        double tokensPerSecond;
+        double allocationsPerKilobyte;  // negative when not counted
+    };
+
+    struct CorpusFile
+    {
+        QString text;
+        int bytes;
+        int tokens;
+    };
+
+    template <typename Work>
+    static Result measure(const CorpusFile &file, Work work);
+
+    void addCorpusRows();
+    void report(const QString &name, const Result &result);
+
+    QHash<QString, CorpusFile> m_corpus;
+    QJsonObject m_baseline;
+    QJsonObject m_results;
+    QString m_baselineFile;
+    double m_tolerance = 0.15;
+};
+
+}
+
+#endif
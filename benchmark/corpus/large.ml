@@ -0,0 +1,10082 @@
+(* Collections of records, parsers and printers as found in an everyday
+   application. Used as the large file of the benchmark corpus. *)
+
+open Printf
+
+module Account = struct
+  (** One account as stored on disk. *)
+  type t = {
+    enabled : bool;
+    weight : float;
+    children : int list;
+    parent : int option;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_account of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate account %d" id
+
+  let compare = Stdlib.compare
+
+  (* Writes the accounts in place; the array must not be empty. *)
+  let write_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let check_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let render table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  (* Reads the accounts in place; the array must not be empty. *)
+  let read_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<account %d>" (Hashtbl.hash x)
+end
+
+class account_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let group_accounts ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Buffer = struct
+  (** One buffer as stored on disk. *)
+  type t = {
+    children : int list;
+    tags : string list;
+    id : int;
+    created : float;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_buffer of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate buffer %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let insert table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let hash_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let encode table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let group_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<buffer %d>" (Hashtbl.hash x)
+end
+
+let write_buffers ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Cache = struct
+  (** One cache as stored on disk. *)
+  type t = {
+    children : int list;
+    created : float;
+    name : string;
+    label : string;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_cache of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate cache %d" id
+
+  let compare = Stdlib.compare
+
+  (* Hashs the caches in place; the array must not be empty. *)
+  let hash_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Updates the caches in place; the array must not be empty. *)
+  let update_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let validate_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let remove_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<cache %d>" (Hashtbl.hash x)
+end
+
+class cache_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let split_caches ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Document = struct
+  (** One document as stored on disk. *)
+  type t = {
+    mutable count : int;
+    name : string;
+    label : string;
+    id : int;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_document of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate document %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let sort_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Hashs the documents in place; the array must not be empty. *)
+  let hash_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let write_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let read_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<document %d>" (Hashtbl.hash x)
+end
+
+class document_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let check_documents ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Entry = struct
+  (** One entry as stored on disk. *)
+  type t = {
+    created : float;
+    tags : string list;
+    children : int list;
+    mutable count : int;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_entry of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate entry %d" id
+
+  let compare = Stdlib.compare
+
+  let write_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let merge_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let insert_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  (* Checks the entrys in place; the array must not be empty. *)
+  let check_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<entry %d>" (Hashtbl.hash x)
+end
+
+let check_entrys ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module File = struct
+  (** One file as stored on disk. *)
+  type t = {
+    parent : int option;
+    tags : string list;
+    weight : float;
+    name : string;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_file of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate file %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Inserts the files in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let normalize_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let render_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let scan table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<file %d>" (Hashtbl.hash x)
+end
+
+module Make_file_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let render_files ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Graph = struct
+  (** One graph as stored on disk. *)
+  type t = {
+    created : float;
+    children : int list;
+    mutable count : int;
+    enabled : bool;
+    label : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_graph of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate graph %d" id
+
+  let compare = Stdlib.compare
+
+  let find_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let check table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let read table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let write_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<graph %d>" (Hashtbl.hash x)
+end
+
+let sort_graphs ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Handle = struct
+  (** One handle as stored on disk. *)
+  type t = {
+    children : int list;
+    mutable count : int;
+    enabled : bool;
+    tags : string list;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_handle of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate handle %d" id
+
+  let compare = Stdlib.compare
+
+  let normalize_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let remove_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let update_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let encode_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<handle %d>" (Hashtbl.hash x)
+end
+
+module Make_handle_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let update_handles ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Index = struct
+  (** One index as stored on disk. *)
+  type t = {
+    children : int list;
+    enabled : bool;
+    created : float;
+    weight : float;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_index of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate index %d" id
+
+  let compare = Stdlib.compare
+
+  let save_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let join_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let decode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let check_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<index %d>" (Hashtbl.hash x)
+end
+
+let join_indexs ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Job = struct
+  (** One job as stored on disk. *)
+  type t = {
+    parent : int option;
+    label : string;
+    tags : string list;
+    name : string;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_job of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate job %d" id
+
+  let compare = Stdlib.compare
+
+  let update table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  (* Sorts the jobs in place; the array must not be empty. *)
+  let sort_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let find_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let read_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<job %d>" (Hashtbl.hash x)
+end
+
+class job_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let insert_jobs ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Key = struct
+  (** One key as stored on disk. *)
+  type t = {
+    created : float;
+    weight : float;
+    name : string;
+    parent : int option;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_key of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate key %d" id
+
+  let compare = Stdlib.compare
+
+  let find_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let merge_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let sort_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  (* Updates the keys in place; the array must not be empty. *)
+  let update_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<key %d>" (Hashtbl.hash x)
+end
+
+module Make_key_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let encode_keys ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Layout = struct
+  (** One layout as stored on disk. *)
+  type t = {
+    mutable count : int;
+    tags : string list;
+    label : string;
+    parent : int option;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_layout of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate layout %d" id
+
+  let compare = Stdlib.compare
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let group_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let sort_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let insert table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<layout %d>" (Hashtbl.hash x)
+end
+
+let normalize_layouts ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Message = struct
+  (** One message as stored on disk. *)
+  type t = {
+    created : float;
+    label : string;
+    id : int;
+    tags : string list;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_message of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate message %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let remove_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let update_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let load_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let check_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<message %d>" (Hashtbl.hash x)
+end
+
+class message_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let insert_messages ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Node = struct
+  (** One node as stored on disk. *)
+  type t = {
+    tags : string list;
+    enabled : bool;
+    id : int;
+    children : int list;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_node of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate node %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let build_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let merge_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let check_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let join table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<node %d>" (Hashtbl.hash x)
+end
+
+module Make_node_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let load_nodes ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Option = struct
+  (** One option as stored on disk. *)
+  type t = {
+    name : string;
+    enabled : bool;
+    children : int list;
+    created : float;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_option of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate option %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Groups the options in place; the array must not be empty. *)
+  let group_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Inserts the options in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Reads the options in place; the array must not be empty. *)
+  let read_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Scans the options in place; the array must not be empty. *)
+  let scan_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<option %d>" (Hashtbl.hash x)
+end
+
+class option_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let sort_options ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Packet = struct
+  (** One packet as stored on disk. *)
+  type t = {
+    tags : string list;
+    weight : float;
+    parent : int option;
+    label : string;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_packet of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate packet %d" id
+
+  let compare = Stdlib.compare
+
+  let merge_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  (* Writes the packets in place; the array must not be empty. *)
+  let write_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let group_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let add_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<packet %d>" (Hashtbl.hash x)
+end
+
+class packet_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let write_packets ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Query = struct
+  (** One query as stored on disk. *)
+  type t = {
+    label : string;
+    id : int;
+    name : string;
+    enabled : bool;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_query of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate query %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let add table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let normalize_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let find_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  (* Updates the querys in place; the array must not be empty. *)
+  let update_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<query %d>" (Hashtbl.hash x)
+end
+
+module Make_query_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let write_querys ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Record = struct
+  (** One record as stored on disk. *)
+  type t = {
+    created : float;
+    mutable count : int;
+    parent : int option;
+    enabled : bool;
+    label : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_record of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate record %d" id
+
+  let compare = Stdlib.compare
+
+  let merge table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let decode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Hashs the records in place; the array must not be empty. *)
+  let hash_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let write table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<record %d>" (Hashtbl.hash x)
+end
+
+class record_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let render_records ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Session = struct
+  (** One session as stored on disk. *)
+  type t = {
+    mutable count : int;
+    enabled : bool;
+    name : string;
+    id : int;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_session of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate session %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let join_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let sort_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let read_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let split_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<session %d>" (Hashtbl.hash x)
+end
+
+module Make_session_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let check_sessions ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Table = struct
+  (** One table as stored on disk. *)
+  type t = {
+    mutable count : int;
+    parent : int option;
+    children : int list;
+    id : int;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_table of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate table %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let check_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let find_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let join_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let read_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<table %d>" (Hashtbl.hash x)
+end
+
+let hash_tables ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module User = struct
+  (** One user as stored on disk. *)
+  type t = {
+    enabled : bool;
+    mutable count : int;
+    created : float;
+    id : int;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_user of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate user %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Updates the users in place; the array must not be empty. *)
+  let update_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let scan_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let decode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let remove_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<user %d>" (Hashtbl.hash x)
+end
+
+module Make_user_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let encode_users ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Value = struct
+  (** One value as stored on disk. *)
+  type t = {
+    parent : int option;
+    enabled : bool;
+    children : int list;
+    mutable count : int;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_value of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate value %d" id
+
+  let compare = Stdlib.compare
+
+  (* Writes the values in place; the array must not be empty. *)
+  let write_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let hash_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let normalize_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let save table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<value %d>" (Hashtbl.hash x)
+end
+
+let parse_values ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Widget = struct
+  (** One widget as stored on disk. *)
+  type t = {
+    tags : string list;
+    weight : float;
+    enabled : bool;
+    label : string;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_widget of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate widget %d" id
+
+  let compare = Stdlib.compare
+
+  let check_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let build_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Groups the widgets in place; the array must not be empty. *)
+  let group_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let remove_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<widget %d>" (Hashtbl.hash x)
+end
+
+class widget_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let join_widgets ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Zone = struct
+  (** One zone as stored on disk. *)
+  type t = {
+    id : int;
+    parent : int option;
+    tags : string list;
+    children : int list;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_zone of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate zone %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Inserts the zones in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let hash table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let join_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let merge table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<zone %d>" (Hashtbl.hash x)
+end
+
+module Make_zone_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let build_zones ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Event = struct
+  (** One event as stored on disk. *)
+  type t = {
+    weight : float;
+    created : float;
+    parent : int option;
+    enabled : bool;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_event of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate event %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let render_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Finds the events in place; the array must not be empty. *)
+  let find_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let load_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let add table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<event %d>" (Hashtbl.hash x)
+end
+
+module Make_event_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let group_events ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Frame = struct
+  (** One frame as stored on disk. *)
+  type t = {
+    parent : int option;
+    tags : string list;
+    mutable count : int;
+    children : int list;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_frame of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate frame %d" id
+
+  let compare = Stdlib.compare
+
+  let save_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let encode table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let merge_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let check_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<frame %d>" (Hashtbl.hash x)
+end
+
+class frame_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let parse_frames ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Image = struct
+  (** One image as stored on disk. *)
+  type t = {
+    id : int;
+    parent : int option;
+    name : string;
+    enabled : bool;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_image of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate image %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let decode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let insert_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let build_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let hash_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<image %d>" (Hashtbl.hash x)
+end
+
+class image_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let scan_images ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Ledger = struct
+  (** One ledger as stored on disk. *)
+  type t = {
+    mutable count : int;
+    enabled : bool;
+    created : float;
+    children : int list;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_ledger of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate ledger %d" id
+
+  let compare = Stdlib.compare
+
+  let update_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let group_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Validates the ledgers in place; the array must not be empty. *)
+  let validate_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let scan_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<ledger %d>" (Hashtbl.hash x)
+end
+
+let scan_ledgers ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Matrix = struct
+  (** One matrix as stored on disk. *)
+  type t = {
+    tags : string list;
+    id : int;
+    label : string;
+    children : int list;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_matrix of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate matrix %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let write_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let remove_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let validate_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let sort_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<matrix %d>" (Hashtbl.hash x)
+end
+
+module Make_matrix_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let merge_matrixs ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Order = struct
+  (** One order as stored on disk. *)
+  type t = {
+    created : float;
+    mutable count : int;
+    name : string;
+    label : string;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_order of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate order %d" id
+
+  let compare = Stdlib.compare
+
+  let join_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  (* Saves the orders in place; the array must not be empty. *)
+  let save_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let split_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let validate_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<order %d>" (Hashtbl.hash x)
+end
+
+module Make_order_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let remove_orders ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Point = struct
+  (** One point as stored on disk. *)
+  type t = {
+    parent : int option;
+    mutable count : int;
+    id : int;
+    weight : float;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_point of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate point %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let sort_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let update_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let load_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let merge_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<point %d>" (Hashtbl.hash x)
+end
+
+class point_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let parse_points ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Route = struct
+  (** One route as stored on disk. *)
+  type t = {
+    mutable count : int;
+    label : string;
+    parent : int option;
+    enabled : bool;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_route of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate route %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let load table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let build_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Renders the routes in place; the array must not be empty. *)
+  let render_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Splits the routes in place; the array must not be empty. *)
+  let split_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<route %d>" (Hashtbl.hash x)
+end
+
+module Make_route_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let build_routes ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Signal = struct
+  (** One signal as stored on disk. *)
+  type t = {
+    created : float;
+    mutable count : int;
+    parent : int option;
+    tags : string list;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_signal of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate signal %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let parse_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  (* Groups the signals in place; the array must not be empty. *)
+  let group_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let remove table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let build table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<signal %d>" (Hashtbl.hash x)
+end
+
+module Make_signal_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let merge_signals ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Token = struct
+  (** One token as stored on disk. *)
+  type t = {
+    children : int list;
+    enabled : bool;
+    mutable count : int;
+    weight : float;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_token of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate token %d" id
+
+  let compare = Stdlib.compare
+
+  let hash_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let build_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Renders the tokens in place; the array must not be empty. *)
+  let render_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<token %d>" (Hashtbl.hash x)
+end
+
+let check_tokens ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Vertex = struct
+  (** One vertex as stored on disk. *)
+  type t = {
+    id : int;
+    weight : float;
+    enabled : bool;
+    mutable count : int;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_vertex of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate vertex %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let split_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let read_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let save_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let check_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<vertex %d>" (Hashtbl.hash x)
+end
+
+let merge_vertexs ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Window = struct
+  (** One window as stored on disk. *)
+  type t = {
+    tags : string list;
+    name : string;
+    children : int list;
+    label : string;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_window of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate window %d" id
+
+  let compare = Stdlib.compare
+
+  let hash_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let read_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let join_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  (* Groups the windows in place; the array must not be empty. *)
+  let group_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<window %d>" (Hashtbl.hash x)
+end
+
+class window_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let normalize_windows ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Account1 = struct
+  (** One account1 as stored on disk. *)
+  type t = {
+    name : string;
+    enabled : bool;
+    tags : string list;
+    created : float;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_account1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate account1 %d" id
+
+  let compare = Stdlib.compare
+
+  let scan_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let remove_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let merge_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let write_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<account1 %d>" (Hashtbl.hash x)
+end
+
+class account1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let merge_account1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Buffer1 = struct
+  (** One buffer1 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    enabled : bool;
+    parent : int option;
+    id : int;
+    label : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_buffer1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate buffer1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let remove_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let save table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let hash_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let split_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<buffer1 %d>" (Hashtbl.hash x)
+end
+
+module Make_buffer1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let scan_buffer1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Cache1 = struct
+  (** One cache1 as stored on disk. *)
+  type t = {
+    name : string;
+    parent : int option;
+    label : string;
+    mutable count : int;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_cache1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate cache1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let write_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let insert_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let normalize_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let build_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<cache1 %d>" (Hashtbl.hash x)
+end
+
+module Make_cache1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let split_cache1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Document1 = struct
+  (** One document1 as stored on disk. *)
+  type t = {
+    parent : int option;
+    id : int;
+    mutable count : int;
+    name : string;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_document1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate document1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let split_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let encode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let hash_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let load_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<document1 %d>" (Hashtbl.hash x)
+end
+
+class document1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let validate_document1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Entry1 = struct
+  (** One entry1 as stored on disk. *)
+  type t = {
+    label : string;
+    created : float;
+    enabled : bool;
+    tags : string list;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_entry1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate entry1 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Hashs the entry1s in place; the array must not be empty. *)
+  let hash_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let sort_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  (* Adds the entry1s in place; the array must not be empty. *)
+  let add_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Parses the entry1s in place; the array must not be empty. *)
+  let parse_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<entry1 %d>" (Hashtbl.hash x)
+end
+
+module Make_entry1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let insert_entry1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module File1 = struct
+  (** One file1 as stored on disk. *)
+  type t = {
+    id : int;
+    enabled : bool;
+    tags : string list;
+    weight : float;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_file1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate file1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let group_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let join_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  (* Adds the file1s in place; the array must not be empty. *)
+  let add_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let write table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<file1 %d>" (Hashtbl.hash x)
+end
+
+let merge_file1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Graph1 = struct
+  (** One graph1 as stored on disk. *)
+  type t = {
+    parent : int option;
+    name : string;
+    created : float;
+    mutable count : int;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_graph1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate graph1 %d" id
+
+  let compare = Stdlib.compare
+
+  let split_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let parse_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let add_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let decode_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<graph1 %d>" (Hashtbl.hash x)
+end
+
+class graph1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let group_graph1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Handle1 = struct
+  (** One handle1 as stored on disk. *)
+  type t = {
+    label : string;
+    parent : int option;
+    name : string;
+    children : int list;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_handle1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate handle1 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Inserts the handle1s in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let find table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let normalize_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let join_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<handle1 %d>" (Hashtbl.hash x)
+end
+
+module Make_handle1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let read_handle1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Index1 = struct
+  (** One index1 as stored on disk. *)
+  type t = {
+    weight : float;
+    id : int;
+    created : float;
+    enabled : bool;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_index1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate index1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let add_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let hash table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let parse_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let encode table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<index1 %d>" (Hashtbl.hash x)
+end
+
+let add_index1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Job1 = struct
+  (** One job1 as stored on disk. *)
+  type t = {
+    weight : float;
+    name : string;
+    id : int;
+    created : float;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_job1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate job1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let build_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let render_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let scan_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let normalize table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<job1 %d>" (Hashtbl.hash x)
+end
+
+module Make_job1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let encode_job1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Key1 = struct
+  (** One key1 as stored on disk. *)
+  type t = {
+    children : int list;
+    label : string;
+    weight : float;
+    id : int;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_key1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate key1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let split_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let decode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let hash_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let update_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<key1 %d>" (Hashtbl.hash x)
+end
+
+let remove_key1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Layout1 = struct
+  (** One layout1 as stored on disk. *)
+  type t = {
+    weight : float;
+    name : string;
+    tags : string list;
+    mutable count : int;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_layout1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate layout1 %d" id
+
+  let compare = Stdlib.compare
+
+  let merge_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let build table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let write_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let parse_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<layout1 %d>" (Hashtbl.hash x)
+end
+
+let decode_layout1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Message1 = struct
+  (** One message1 as stored on disk. *)
+  type t = {
+    parent : int option;
+    children : int list;
+    created : float;
+    tags : string list;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_message1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate message1 %d" id
+
+  let compare = Stdlib.compare
+
+  let insert_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Reads the message1s in place; the array must not be empty. *)
+  let read_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let merge_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<message1 %d>" (Hashtbl.hash x)
+end
+
+let build_message1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Node1 = struct
+  (** One node1 as stored on disk. *)
+  type t = {
+    tags : string list;
+    id : int;
+    mutable count : int;
+    weight : float;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_node1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate node1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Updates the node1s in place; the array must not be empty. *)
+  let update_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Joins the node1s in place; the array must not be empty. *)
+  let join_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let group_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let encode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<node1 %d>" (Hashtbl.hash x)
+end
+
+module Make_node1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let sort_node1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Option1 = struct
+  (** One option1 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    children : int list;
+    created : float;
+    id : int;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_option1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate option1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let scan table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let update_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Decodes the option1s in place; the array must not be empty. *)
+  let decode_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<option1 %d>" (Hashtbl.hash x)
+end
+
+class option1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let update_option1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Packet1 = struct
+  (** One packet1 as stored on disk. *)
+  type t = {
+    created : float;
+    children : int list;
+    label : string;
+    id : int;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_packet1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate packet1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let render_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let remove_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let encode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let validate_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<packet1 %d>" (Hashtbl.hash x)
+end
+
+class packet1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let hash_packet1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Query1 = struct
+  (** One query1 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    children : int list;
+    id : int;
+    name : string;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_query1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate query1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let decode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Loads the query1s in place; the array must not be empty. *)
+  let load_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let read_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  (* Joins the query1s in place; the array must not be empty. *)
+  let join_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<query1 %d>" (Hashtbl.hash x)
+end
+
+module Make_query1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let scan_query1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Record1 = struct
+  (** One record1 as stored on disk. *)
+  type t = {
+    weight : float;
+    created : float;
+    parent : int option;
+    label : string;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_record1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate record1 %d" id
+
+  let compare = Stdlib.compare
+
+  let insert_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Adds the record1s in place; the array must not be empty. *)
+  let add_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Groups the record1s in place; the array must not be empty. *)
+  let group_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let render_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<record1 %d>" (Hashtbl.hash x)
+end
+
+module Make_record1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let save_record1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Session1 = struct
+  (** One session1 as stored on disk. *)
+  type t = {
+    weight : float;
+    label : string;
+    mutable count : int;
+    tags : string list;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_session1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate session1 %d" id
+
+  let compare = Stdlib.compare
+
+  let split_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let merge_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  (* Inserts the session1s in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let find_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<session1 %d>" (Hashtbl.hash x)
+end
+
+let read_session1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Table1 = struct
+  (** One table1 as stored on disk. *)
+  type t = {
+    name : string;
+    label : string;
+    tags : string list;
+    parent : int option;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_table1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate table1 %d" id
+
+  let compare = Stdlib.compare
+
+  let remove_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Writes the table1s in place; the array must not be empty. *)
+  let write_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Builds the table1s in place; the array must not be empty. *)
+  let build_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let load_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<table1 %d>" (Hashtbl.hash x)
+end
+
+module Make_table1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let parse_table1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module User1 = struct
+  (** One user1 as stored on disk. *)
+  type t = {
+    created : float;
+    weight : float;
+    parent : int option;
+    children : int list;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_user1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate user1 %d" id
+
+  let compare = Stdlib.compare
+
+  let validate_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Splits the user1s in place; the array must not be empty. *)
+  let split_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let scan_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let update_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<user1 %d>" (Hashtbl.hash x)
+end
+
+class user1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let save_user1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Value1 = struct
+  (** One value1 as stored on disk. *)
+  type t = {
+    id : int;
+    enabled : bool;
+    created : float;
+    tags : string list;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_value1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate value1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let merge_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Builds the value1s in place; the array must not be empty. *)
+  let build_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let add_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let update_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<value1 %d>" (Hashtbl.hash x)
+end
+
+class value1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let read_value1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Widget1 = struct
+  (** One widget1 as stored on disk. *)
+  type t = {
+    label : string;
+    name : string;
+    mutable count : int;
+    tags : string list;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_widget1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate widget1 %d" id
+
+  let compare = Stdlib.compare
+
+  let sort_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let validate_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Checks the widget1s in place; the array must not be empty. *)
+  let check_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let load_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<widget1 %d>" (Hashtbl.hash x)
+end
+
+let check_widget1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Zone1 = struct
+  (** One zone1 as stored on disk. *)
+  type t = {
+    label : string;
+    enabled : bool;
+    name : string;
+    mutable count : int;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_zone1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate zone1 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Hashs the zone1s in place; the array must not be empty. *)
+  let hash_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Adds the zone1s in place; the array must not be empty. *)
+  let add_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let find_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let parse_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<zone1 %d>" (Hashtbl.hash x)
+end
+
+module Make_zone1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let scan_zone1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Event1 = struct
+  (** One event1 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    created : float;
+    id : int;
+    name : string;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_event1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate event1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let find table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  (* Loads the event1s in place; the array must not be empty. *)
+  let load_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let split_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let read_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<event1 %d>" (Hashtbl.hash x)
+end
+
+module Make_event1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let update_event1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Frame1 = struct
+  (** One frame1 as stored on disk. *)
+  type t = {
+    name : string;
+    mutable count : int;
+    label : string;
+    enabled : bool;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_frame1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate frame1 %d" id
+
+  let compare = Stdlib.compare
+
+  let read_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let parse_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let remove_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Inserts the frame1s in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<frame1 %d>" (Hashtbl.hash x)
+end
+
+module Make_frame1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let render_frame1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Image1 = struct
+  (** One image1 as stored on disk. *)
+  type t = {
+    parent : int option;
+    mutable count : int;
+    enabled : bool;
+    children : int list;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_image1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate image1 %d" id
+
+  let compare = Stdlib.compare
+
+  let load table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let write_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let insert table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  (* Joins the image1s in place; the array must not be empty. *)
+  let join_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<image1 %d>" (Hashtbl.hash x)
+end
+
+class image1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let remove_image1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Ledger1 = struct
+  (** One ledger1 as stored on disk. *)
+  type t = {
+    parent : int option;
+    enabled : bool;
+    tags : string list;
+    id : int;
+    label : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_ledger1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate ledger1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let find table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let check table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let split_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<ledger1 %d>" (Hashtbl.hash x)
+end
+
+let read_ledger1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Matrix1 = struct
+  (** One matrix1 as stored on disk. *)
+  type t = {
+    tags : string list;
+    id : int;
+    created : float;
+    name : string;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_matrix1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate matrix1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let encode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let update table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let remove_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let hash_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<matrix1 %d>" (Hashtbl.hash x)
+end
+
+let remove_matrix1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Order1 = struct
+  (** One order1 as stored on disk. *)
+  type t = {
+    label : string;
+    name : string;
+    enabled : bool;
+    tags : string list;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_order1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate order1 %d" id
+
+  let compare = Stdlib.compare
+
+  let parse_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let hash table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let build_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let write_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<order1 %d>" (Hashtbl.hash x)
+end
+
+class order1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let encode_order1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Point1 = struct
+  (** One point1 as stored on disk. *)
+  type t = {
+    label : string;
+    created : float;
+    tags : string list;
+    weight : float;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_point1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate point1 %d" id
+
+  let compare = Stdlib.compare
+
+  let insert table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let save table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let join table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let scan_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<point1 %d>" (Hashtbl.hash x)
+end
+
+class point1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let normalize_point1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Route1 = struct
+  (** One route1 as stored on disk. *)
+  type t = {
+    name : string;
+    tags : string list;
+    mutable count : int;
+    enabled : bool;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_route1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate route1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let group_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Scans the route1s in place; the array must not be empty. *)
+  let scan_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let update_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let encode_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<route1 %d>" (Hashtbl.hash x)
+end
+
+module Make_route1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let join_route1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Signal1 = struct
+  (** One signal1 as stored on disk. *)
+  type t = {
+    children : int list;
+    label : string;
+    weight : float;
+    enabled : bool;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_signal1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate signal1 %d" id
+
+  let compare = Stdlib.compare
+
+  let scan_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let parse_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let check_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let render_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<signal1 %d>" (Hashtbl.hash x)
+end
+
+module Make_signal1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let write_signal1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Token1 = struct
+  (** One token1 as stored on disk. *)
+  type t = {
+    id : int;
+    name : string;
+    children : int list;
+    enabled : bool;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_token1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate token1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Parses the token1s in place; the array must not be empty. *)
+  let parse_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let find_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let normalize_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let read_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<token1 %d>" (Hashtbl.hash x)
+end
+
+class token1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let remove_token1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Vertex1 = struct
+  (** One vertex1 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    name : string;
+    label : string;
+    weight : float;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_vertex1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate vertex1 %d" id
+
+  let compare = Stdlib.compare
+
+  let read_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let build_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let save_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let merge_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<vertex1 %d>" (Hashtbl.hash x)
+end
+
+module Make_vertex1_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let update_vertex1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Window1 = struct
+  (** One window1 as stored on disk. *)
+  type t = {
+    id : int;
+    label : string;
+    tags : string list;
+    mutable count : int;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_window1 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate window1 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let add_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let update_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let render_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let find_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<window1 %d>" (Hashtbl.hash x)
+end
+
+class window1_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let load_window1s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Account2 = struct
+  (** One account2 as stored on disk. *)
+  type t = {
+    created : float;
+    label : string;
+    enabled : bool;
+    name : string;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_account2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate account2 %d" id
+
+  let compare = Stdlib.compare
+
+  let render_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let join_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let split_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let update_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<account2 %d>" (Hashtbl.hash x)
+end
+
+class account2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let find_account2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Buffer2 = struct
+  (** One buffer2 as stored on disk. *)
+  type t = {
+    id : int;
+    tags : string list;
+    parent : int option;
+    mutable count : int;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_buffer2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate buffer2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let hash_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let scan table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let merge_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let read table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<buffer2 %d>" (Hashtbl.hash x)
+end
+
+module Make_buffer2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let scan_buffer2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Cache2 = struct
+  (** One cache2 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    tags : string list;
+    name : string;
+    enabled : bool;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_cache2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate cache2 %d" id
+
+  let compare = Stdlib.compare
+
+  let join_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let insert_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let decode_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let save table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<cache2 %d>" (Hashtbl.hash x)
+end
+
+class cache2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let render_cache2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Document2 = struct
+  (** One document2 as stored on disk. *)
+  type t = {
+    name : string;
+    mutable count : int;
+    enabled : bool;
+    created : float;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_document2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate document2 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Builds the document2s in place; the array must not be empty. *)
+  let build_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let validate_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let add_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Splits the document2s in place; the array must not be empty. *)
+  let split_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<document2 %d>" (Hashtbl.hash x)
+end
+
+let find_document2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Entry2 = struct
+  (** One entry2 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    parent : int option;
+    weight : float;
+    id : int;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_entry2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate entry2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Writes the entry2s in place; the array must not be empty. *)
+  let write_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let sort_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let join_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let build_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<entry2 %d>" (Hashtbl.hash x)
+end
+
+let encode_entry2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module File2 = struct
+  (** One file2 as stored on disk. *)
+  type t = {
+    tags : string list;
+    label : string;
+    id : int;
+    weight : float;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_file2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate file2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let merge table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  (* Joins the file2s in place; the array must not be empty. *)
+  let join_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let sort_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let render_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<file2 %d>" (Hashtbl.hash x)
+end
+
+class file2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let insert_file2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Graph2 = struct
+  (** One graph2 as stored on disk. *)
+  type t = {
+    created : float;
+    id : int;
+    parent : int option;
+    enabled : bool;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_graph2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate graph2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let scan_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let write_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let build_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let split_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<graph2 %d>" (Hashtbl.hash x)
+end
+
+module Make_graph2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let render_graph2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Handle2 = struct
+  (** One handle2 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    created : float;
+    parent : int option;
+    children : int list;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_handle2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate handle2 %d" id
+
+  let compare = Stdlib.compare
+
+  let write table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let check_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let group_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let find_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<handle2 %d>" (Hashtbl.hash x)
+end
+
+module Make_handle2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let normalize_handle2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Index2 = struct
+  (** One index2 as stored on disk. *)
+  type t = {
+    id : int;
+    label : string;
+    weight : float;
+    enabled : bool;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_index2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate index2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let find_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let join_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let normalize_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<index2 %d>" (Hashtbl.hash x)
+end
+
+class index2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let save_index2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Job2 = struct
+  (** One job2 as stored on disk. *)
+  type t = {
+    children : int list;
+    id : int;
+    parent : int option;
+    enabled : bool;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_job2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate job2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let group_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let write_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let build_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  (* Checks the job2s in place; the array must not be empty. *)
+  let check_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<job2 %d>" (Hashtbl.hash x)
+end
+
+class job2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let update_job2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Key2 = struct
+  (** One key2 as stored on disk. *)
+  type t = {
+    children : int list;
+    enabled : bool;
+    name : string;
+    mutable count : int;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_key2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate key2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let scan_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  (* Parses the key2s in place; the array must not be empty. *)
+  let parse_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Merges the key2s in place; the array must not be empty. *)
+  let merge_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let update_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<key2 %d>" (Hashtbl.hash x)
+end
+
+module Make_key2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let save_key2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Layout2 = struct
+  (** One layout2 as stored on disk. *)
+  type t = {
+    weight : float;
+    name : string;
+    created : float;
+    mutable count : int;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_layout2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate layout2 %d" id
+
+  let compare = Stdlib.compare
+
+  let find_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let load_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let render table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  (* Hashs the layout2s in place; the array must not be empty. *)
+  let hash_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<layout2 %d>" (Hashtbl.hash x)
+end
+
+module Make_layout2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let check_layout2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Message2 = struct
+  (** One message2 as stored on disk. *)
+  type t = {
+    children : int list;
+    enabled : bool;
+    name : string;
+    mutable count : int;
+    label : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_message2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate message2 %d" id
+
+  let compare = Stdlib.compare
+
+  let add_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let save_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let normalize_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let render table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<message2 %d>" (Hashtbl.hash x)
+end
+
+let hash_message2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Node2 = struct
+  (** One node2 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    tags : string list;
+    label : string;
+    created : float;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_node2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate node2 %d" id
+
+  let compare = Stdlib.compare
+
+  let join table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let sort_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let check_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let split table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<node2 %d>" (Hashtbl.hash x)
+end
+
+module Make_node2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let decode_node2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Option2 = struct
+  (** One option2 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    name : string;
+    label : string;
+    weight : float;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_option2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate option2 %d" id
+
+  let compare = Stdlib.compare
+
+  let scan_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let add_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let encode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let write_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<option2 %d>" (Hashtbl.hash x)
+end
+
+let hash_option2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Packet2 = struct
+  (** One packet2 as stored on disk. *)
+  type t = {
+    tags : string list;
+    parent : int option;
+    label : string;
+    children : int list;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_packet2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate packet2 %d" id
+
+  let compare = Stdlib.compare
+
+  let split table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let check_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let encode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Scans the packet2s in place; the array must not be empty. *)
+  let scan_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<packet2 %d>" (Hashtbl.hash x)
+end
+
+module Make_packet2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let add_packet2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Query2 = struct
+  (** One query2 as stored on disk. *)
+  type t = {
+    label : string;
+    weight : float;
+    created : float;
+    mutable count : int;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_query2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate query2 %d" id
+
+  let compare = Stdlib.compare
+
+  let split table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  (* Normalizes the query2s in place; the array must not be empty. *)
+  let normalize_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let insert table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  (* Finds the query2s in place; the array must not be empty. *)
+  let find_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<query2 %d>" (Hashtbl.hash x)
+end
+
+class query2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let scan_query2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Record2 = struct
+  (** One record2 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    children : int list;
+    tags : string list;
+    label : string;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_record2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate record2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let build_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let hash_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let insert table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let validate_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<record2 %d>" (Hashtbl.hash x)
+end
+
+module Make_record2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let group_record2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Session2 = struct
+  (** One session2 as stored on disk. *)
+  type t = {
+    weight : float;
+    mutable count : int;
+    tags : string list;
+    children : int list;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_session2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate session2 %d" id
+
+  let compare = Stdlib.compare
+
+  let build_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Merges the session2s in place; the array must not be empty. *)
+  let merge_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let sort_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<session2 %d>" (Hashtbl.hash x)
+end
+
+module Make_session2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let write_session2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Table2 = struct
+  (** One table2 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    id : int;
+    parent : int option;
+    tags : string list;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_table2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate table2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let merge_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let encode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Builds the table2s in place; the array must not be empty. *)
+  let build_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let sort_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<table2 %d>" (Hashtbl.hash x)
+end
+
+let load_table2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module User2 = struct
+  (** One user2 as stored on disk. *)
+  type t = {
+    tags : string list;
+    mutable count : int;
+    children : int list;
+    created : float;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_user2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate user2 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Decodes the user2s in place; the array must not be empty. *)
+  let decode_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let update table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let scan_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let render_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<user2 %d>" (Hashtbl.hash x)
+end
+
+let build_user2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Value2 = struct
+  (** One value2 as stored on disk. *)
+  type t = {
+    weight : float;
+    enabled : bool;
+    mutable count : int;
+    tags : string list;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_value2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate value2 %d" id
+
+  let compare = Stdlib.compare
+
+  let encode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let decode_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let load_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let join_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<value2 %d>" (Hashtbl.hash x)
+end
+
+let insert_value2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Widget2 = struct
+  (** One widget2 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    label : string;
+    mutable count : int;
+    tags : string list;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_widget2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate widget2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let insert_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let validate_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let decode table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let render table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<widget2 %d>" (Hashtbl.hash x)
+end
+
+class widget2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let update_widget2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Zone2 = struct
+  (** One zone2 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    created : float;
+    name : string;
+    enabled : bool;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_zone2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate zone2 %d" id
+
+  let compare = Stdlib.compare
+
+  let check_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let update_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let find_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let sort_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<zone2 %d>" (Hashtbl.hash x)
+end
+
+let write_zone2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Event2 = struct
+  (** One event2 as stored on disk. *)
+  type t = {
+    weight : float;
+    id : int;
+    created : float;
+    name : string;
+    mutable count : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_event2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate event2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let remove table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let load_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let decode_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let group_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<event2 %d>" (Hashtbl.hash x)
+end
+
+module Make_event2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let build_event2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Frame2 = struct
+  (** One frame2 as stored on disk. *)
+  type t = {
+    children : int list;
+    created : float;
+    id : int;
+    tags : string list;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_frame2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate frame2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let build_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let encode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let add_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let update_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<frame2 %d>" (Hashtbl.hash x)
+end
+
+let render_frame2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Image2 = struct
+  (** One image2 as stored on disk. *)
+  type t = {
+    parent : int option;
+    created : float;
+    enabled : bool;
+    weight : float;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_image2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate image2 %d" id
+
+  let compare = Stdlib.compare
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let build table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let merge table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let sort_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<image2 %d>" (Hashtbl.hash x)
+end
+
+class image2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let build_image2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Ledger2 = struct
+  (** One ledger2 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    tags : string list;
+    weight : float;
+    created : float;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_ledger2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate ledger2 %d" id
+
+  let compare = Stdlib.compare
+
+  let merge_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let join table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let write_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let sort_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<ledger2 %d>" (Hashtbl.hash x)
+end
+
+module Make_ledger2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let build_ledger2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Matrix2 = struct
+  (** One matrix2 as stored on disk. *)
+  type t = {
+    mutable count : int;
+    enabled : bool;
+    name : string;
+    label : string;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_matrix2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate matrix2 %d" id
+
+  let compare = Stdlib.compare
+
+  let update_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let decode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Loads the matrix2s in place; the array must not be empty. *)
+  let load_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let scan_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<matrix2 %d>" (Hashtbl.hash x)
+end
+
+let update_matrix2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Order2 = struct
+  (** One order2 as stored on disk. *)
+  type t = {
+    children : int list;
+    parent : int option;
+    mutable count : int;
+    name : string;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_order2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate order2 %d" id
+
+  let compare = Stdlib.compare
+
+  let decode_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let render_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Splits the order2s in place; the array must not be empty. *)
+  let split_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let parse_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<order2 %d>" (Hashtbl.hash x)
+end
+
+module Make_order2_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let write_order2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Point2 = struct
+  (** One point2 as stored on disk. *)
+  type t = {
+    name : string;
+    enabled : bool;
+    tags : string list;
+    label : string;
+    created : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_point2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate point2 %d" id
+
+  let compare = Stdlib.compare
+
+  let hash_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let remove_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let decode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let encode table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<point2 %d>" (Hashtbl.hash x)
+end
+
+class point2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let normalize_point2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Route2 = struct
+  (** One route2 as stored on disk. *)
+  type t = {
+    label : string;
+    enabled : bool;
+    created : float;
+    name : string;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_route2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate route2 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Inserts the route2s in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let split table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let hash_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let normalize table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<route2 %d>" (Hashtbl.hash x)
+end
+
+class route2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let merge_route2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Signal2 = struct
+  (** One signal2 as stored on disk. *)
+  type t = {
+    weight : float;
+    id : int;
+    enabled : bool;
+    tags : string list;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_signal2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate signal2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let sort_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let build_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let group_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Checks the signal2s in place; the array must not be empty. *)
+  let check_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<signal2 %d>" (Hashtbl.hash x)
+end
+
+let merge_signal2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Token2 = struct
+  (** One token2 as stored on disk. *)
+  type t = {
+    label : string;
+    weight : float;
+    enabled : bool;
+    mutable count : int;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_token2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate token2 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Inserts the token2s in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let write_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let sort_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let render_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<token2 %d>" (Hashtbl.hash x)
+end
+
+let decode_token2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Vertex2 = struct
+  (** One vertex2 as stored on disk. *)
+  type t = {
+    children : int list;
+    tags : string list;
+    weight : float;
+    id : int;
+    enabled : bool;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_vertex2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate vertex2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let sort_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let update_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  (* Splits the vertex2s in place; the array must not be empty. *)
+  let split_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let hash_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<vertex2 %d>" (Hashtbl.hash x)
+end
+
+let render_vertex2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Window2 = struct
+  (** One window2 as stored on disk. *)
+  type t = {
+    id : int;
+    children : int list;
+    tags : string list;
+    name : string;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_window2 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate window2 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let parse table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let normalize table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let split_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let load_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<window2 %d>" (Hashtbl.hash x)
+end
+
+class window2_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let join_window2s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Account3 = struct
+  (** One account3 as stored on disk. *)
+  type t = {
+    label : string;
+    weight : float;
+    id : int;
+    tags : string list;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_account3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate account3 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let update_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Inserts the account3s in place; the array must not be empty. *)
+  let insert_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let hash_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let group_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<account3 %d>" (Hashtbl.hash x)
+end
+
+let split_account3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Buffer3 = struct
+  (** One buffer3 as stored on disk. *)
+  type t = {
+    tags : string list;
+    children : int list;
+    enabled : bool;
+    label : string;
+    parent : int option;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_buffer3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate buffer3 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Removes the buffer3s in place; the array must not be empty. *)
+  let remove_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let write_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let check_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let update_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let pp fmt x = Format.fprintf fmt "<buffer3 %d>" (Hashtbl.hash x)
+end
+
+module Make_buffer3_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let add_buffer3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Cache3 = struct
+  (** One cache3 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    id : int;
+    mutable count : int;
+    children : int list;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_cache3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate cache3 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let validate_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let read table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let scan_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let save_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<cache3 %d>" (Hashtbl.hash x)
+end
+
+class cache3_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let add_cache3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Document3 = struct
+  (** One document3 as stored on disk. *)
+  type t = {
+    id : int;
+    weight : float;
+    mutable count : int;
+    children : int list;
+    tags : string list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_document3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate document3 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let load_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let split table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let decode_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let write_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let pp fmt x = Format.fprintf fmt "<document3 %d>" (Hashtbl.hash x)
+end
+
+module Make_document3_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let save_document3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Entry3 = struct
+  (** One entry3 as stored on disk. *)
+  type t = {
+    parent : int option;
+    created : float;
+    label : string;
+    id : int;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_entry3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate entry3 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Renders the entry3s in place; the array must not be empty. *)
+  let render_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let read_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let update_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let sort_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<entry3 %d>" (Hashtbl.hash x)
+end
+
+let group_entry3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module File3 = struct
+  (** One file3 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    label : string;
+    mutable count : int;
+    created : float;
+    weight : float;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_file3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate file3 %d" id
+
+  let compare = Stdlib.compare
+
+  (* Renders the file3s in place; the array must not be empty. *)
+  let render_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  (* Adds the file3s in place; the array must not be empty. *)
+  let add_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let sort_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  (* Saves the file3s in place; the array must not be empty. *)
+  let save_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let pp fmt x = Format.fprintf fmt "<file3 %d>" (Hashtbl.hash x)
+end
+
+module Make_file3_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let remove_file3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Graph3 = struct
+  (** One graph3 as stored on disk. *)
+  type t = {
+    parent : int option;
+    id : int;
+    name : string;
+    mutable count : int;
+    label : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_graph3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate graph3 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let find_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let split_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  (* Renders the graph3s in place; the array must not be empty. *)
+  let render_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let remove table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<graph3 %d>" (Hashtbl.hash x)
+end
+
+class graph3_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let join_graph3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Handle3 = struct
+  (** One handle3 as stored on disk. *)
+  type t = {
+    label : string;
+    created : float;
+    children : int list;
+    parent : int option;
+    id : int;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_handle3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate handle3 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  let read_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let encode_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let join table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let split table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let pp fmt x = Format.fprintf fmt "<handle3 %d>" (Hashtbl.hash x)
+end
+
+module Make_handle3_store (K : sig type t val equal : t -> t -> bool val hash : t -> int end) : sig
+  type 'a t
+  val create : int -> 'a t
+  val add : 'a t -> K.t -> 'a -> unit
+  val find : 'a t -> K.t -> 'a option
+  val fold : (K.t -> 'a -> 'b -> 'b) -> 'a t -> 'b -> 'b
+end = struct
+  module H = Hashtbl.Make (K)
+  type 'a t = { table : 'a H.t; mutable hits : int; mutable misses : int }
+  let create n = { table = H.create n; hits = 0; misses = 0 }
+  let add s k v = H.replace s.table k v
+  let find s k =
+    match H.find_opt s.table k with
+    | Some _ as r -> s.hits <- s.hits + 1; r
+    | None -> s.misses <- s.misses + 1; None
+  let fold f s init = H.fold f s.table init
+end
+
+let group_handle3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Index3 = struct
+  (** One index3 as stored on disk. *)
+  type t = {
+    tags : string list;
+    parent : int option;
+    mutable count : int;
+    weight : float;
+    children : int list;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_index3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate index3 %d" id
+
+  let compare = Stdlib.compare
+
+  let remove table key =
+    match Hashtbl.find_opt table key with
+    | Some v when v >= 0 -> `Found v
+    | Some _ -> `Removed
+    | None -> `Missing key
+
+  let split_all ?(limit = max_int) ~f items =
+    let rec go n acc = function
+      | [] -> List.rev acc
+      | _ when n >= limit -> List.rev acc
+      | x :: rest -> go (n + 1) (f x :: acc) rest
+    in
+    go 0 [] items
+
+  let save_into buf items =
+    Buffer.add_char buf '[';
+    List.iteri (fun i x ->
+        if i > 0 then Buffer.add_string buf ", ";
+        Buffer.add_string buf (string_of_int x)) items;
+    Buffer.add_char buf ']'
+
+  let add_line line =
+    match String.split_on_char ',' line with
+    | [a; b] -> Ok (String.trim a, float_of_string (String.trim b))
+    | [a] -> Ok (String.trim a, 0.)
+    | _ -> Error (Bad_value ("line", line))
+
+  let pp fmt x = Format.fprintf fmt "<index3 %d>" (Hashtbl.hash x)
+end
+
+let read_index3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+module Job3 = struct
+  (** One job3 as stored on disk. *)
+  type t = {
+    enabled : bool;
+    weight : float;
+    id : int;
+    children : int list;
+    name : string;
+  }
+
+  type error =
+    | Missing_field of string
+    | Bad_value of string * string
+    | Duplicate of int
+
+  exception Invalid_job3 of error
+
+  let string_of_error = function
+    | Missing_field f -> sprintf "missing field %s" f
+    | Bad_value (f, v) -> sprintf "bad value %S for %s" v f
+    | Duplicate id -> sprintf "duplicate job3 %d" id
+
+  let compare a b = Stdlib.compare a.id b.id
+
+  (* Builds the job3s in place; the array must not be empty. *)
+  let build_in_place (a : int array) =
+    assert (Array.length a > 0);
+    for i = 1 to Array.length a - 1 do
+      let x = a.(i) and j = ref (i - 1) in
+      while !j >= 0 && a.(!j) > x do
+        a.(!j + 1) <- a.(!j);
+        decr j
+      done;
+      a.(!j + 1) <- x
+    done
+
+  let read_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let write_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let add_with_retry ?(attempts = 3) f x =
+    let rec loop n =
+      try f x with
+      | Not_found -> None
+      | Failure msg when n > 1 ->
+        eprintf "retrying after %s\n%!" msg;
+        loop (n - 1)
+    in
+    loop attempts
+
+  let pp fmt x = Format.fprintf fmt "<job3 %d>" (Hashtbl.hash x)
+end
+
+class job3_printer ?(indent = 2) (out : out_channel) = object (self)
+  val mutable depth = 0
+  val mutable lines = 0
+  method private pad = String.make (depth * indent) ' '
+  method line fmt = ksprintf (fun s -> lines <- lines + 1; output_string out (self#pad ^ s ^ "\n")) fmt
+  method nest : 'a. (unit -> 'a) -> 'a = fun f ->
+    depth <- depth + 1;
+    Fun.protect ~finally:(fun () -> depth <- depth - 1) f
+  method lines = lines
+end
+
+let find_job3s ~verbose paths =
+  let total = ref 0 in
+  List.iter (fun path ->
+      let ic = open_in path in
+      let rec loop () =
+        match input_line ic with
+        | line ->
+          incr total;
+          if verbose then printf "%s:%d: %s\n" path !total line;
+          loop ()
+        | exception End_of_file -> close_in ic
+      in
+      loop ()) paths;
+  !total
+
+let () =
+  let store = Account.compare in
+  ignore store
@@ -0,0 +1,2010 @@
+(* Inputs at the edges of what the lexer, the highlighter and the indenter
+   handle: very long lines, deep nesting, long comments and strings. *)
+
+let long_line = [x0 + 0; x1 + 1; x2 + 2; x3 + 3; x4 + 4; x5 + 5; x6 + 6; x7 + 7; x8 + 8; x9 + 9; x10 + 10; x11 + 11; x12 + 12; x13 + 13; x14 + 14; x15 + 15; x16 + 16; x17 + 17; x18 + 18; x19 + 19; x20 + 20; x21 + 21; x22 + 22; x23 + 23; x24 + 24; x25 + 25; x26 + 26; x27 + 27; x28 + 28; x29 + 29; x30 + 30; x31 + 31; x32 + 32; x33 + 33; x34 + 34; x35 + 35; x36 + 36; x37 + 37; x38 + 38; x39 + 39; x40 + 40; x41 + 41; x42 + 42; x43 + 43; x44 + 44; x45 + 45; x46 + 46; x47 + 47; x48 + 48; x49 + 49; x50 + 50; x51 + 51; x52 + 52; x53 + 53; x54 + 54; x55 + 55; x56 + 56; x57 + 57; x58 + 58; x59 + 59; x60 + 60; x61 + 61; x62 + 62; x63 + 63; x64 + 64; x65 + 65; x66 + 66; x67 + 67; x68 + 68; x69 + 69; x70 + 70; x71 + 71; x72 + 72; x73 + 73; x74 + 74; x75 + 75; x76 + 76; x77 + 77; x78 + 78; x79 + 79; x80 + 80; x81 + 81; x82 + 82; x83 + 83; x84 + 84; x85 + 85; x86 + 86; x87 + 87; x88 + 88; x89 + 89; x90 + 90; x91 + 91; x92 + 92; x93 + 93; x94 + 94; x95 + 95; x96 + 96; x97 + 97; x98 + 98; x99 + 99; x100 + 100; x101 + 101; x102 + 102; x103 + 103; x104 + 104; x105 + 105; x106 + 106; x107 + 107; x108 + 108; x109 + 109; x110 + 110; x111 + 111; x112 + 112; x113 + 113; x114 + 114; x115 + 115; x116 + 116; x117 + 117; x118 + 118; x119 + 119; x120 + 120; x121 + 121; x122 + 122; x123 + 123; x124 + 124; x125 + 125; x126 + 126; x127 + 127; x128 + 128; x129 + 129; x130 + 130; x131 + 131; x132 + 132; x133 + 133; x134 + 134; x135 + 135; x136 + 136; x137 + 137; x138 + 138; x139 + 139; x140 + 140; x141 + 141; x142 + 142; x143 + 143; x144 + 144; x145 + 145; x146 + 146; x147 + 147; x148 + 148; x149 + 149; x150 + 150; x151 + 151; x152 + 152; x153 + 153; x154 + 154; x155 + 155; x156 + 156; x157 + 157; x158 + 158; x159 + 159; x160 + 160; x161 + 161; x162 + 162; x163 + 163; x164 + 164; x165 + 165; x166 + 166; x167 + 167; x168 + 168; x169 + 169; x170 + 170; x171 + 171; x172 + 172; x173 + 173; x174 + 174; x175 + 175; x176 + 176; x177 + 177; x178 + 178; x179 + 179; x180 + 180; x181 + 181; x182 + 182; x183 + 183; x184 + 184; x185 + 185; x186 + 186; x187 + 187; x188 + 188; x189 + 189; x190 + 190; x191 + 191; x192 + 192; x193 + 193; x194 + 194; x195 + 195; x196 + 196; x197 + 197; x198 + 198; x199 + 199; x200 + 200; x201 + 201; x202 + 202; x203 + 203; x204 + 204; x205 + 205; x206 + 206; x207 + 207; x208 + 208; x209 + 209; x210 + 210; x211 + 211; x212 + 212; x213 + 213; x214 + 214; x215 + 215; x216 + 216; x217 + 217; x218 + 218; x219 + 219; x220 + 220; x221 + 221; x222 + 222; x223 + 223; x224 + 224; x225 + 225; x226 + 226; x227 + 227; x228 + 228; x229 + 229; x230 + 230; x231 + 231; x232 + 232; x233 + 233; x234 + 234; x235 + 235; x236 + 236; x237 + 237; x238 + 238; x239 + 239; x240 + 240; x241 + 241; x242 + 242; x243 + 243; x244 + 244; x245 + 245; x246 + 246; x247 + 247; x248 + 248; x249 + 249; x250 + 250; x251 + 251; x252 + 252; x253 + 253; x254 + 254; x255 + 255; x256 + 256; x257 + 257; x258 + 258; x259 + 259; x260 + 260; x261 + 261; x262 + 262; x263 + 263; x264 + 264; x265 + 265; x266 + 266; x267 + 267; x268 + 268; x269 + 269; x270 + 270; x271 + 271; x272 + 272; x273 + 273; x274 + 274; x275 + 275; x276 + 276; x277 + 277; x278 + 278; x279 + 279; x280 + 280; x281 + 281; x282 + 282; x283 + 283; x284 + 284; x285 + 285; x286 + 286; x287 + 287; x288 + 288; x289 + 289; x290 + 290; x291 + 291; x292 + 292; x293 + 293; x294 + 294; x295 + 295; x296 + 296; x297 + 297; x298 + 298; x299 + 299; x300 + 300; x301 + 301; x302 + 302; x303 + 303; x304 + 304; x305 + 305; x306 + 306; x307 + 307; x308 + 308; x309 + 309; x310 + 310; x311 + 311; x312 + 312; x313 + 313; x314 + 314; x315 + 315; x316 + 316; x317 + 317; x318 + 318; x319 + 319; x320 + 320; x321 + 321; x322 + 322; x323 + 323; x324 + 324; x325 + 325; x326 + 326; x327 + 327; x328 + 328; x329 + 329; x330 + 330; x331 + 331; x332 + 332; x333 + 333; x334 + 334; x335 + 335; x336 + 336; x337 + 337; x338 + 338; x339 + 339; x340 + 340; x341 + 341; x342 + 342; x343 + 343; x344 + 344; x345 + 345; x346 + 346; x347 + 347; x348 + 348; x349 + 349; x350 + 350; x351 + 351; x352 + 352; x353 + 353; x354 + 354; x355 + 355; x356 + 356; x357 + 357; x358 + 358; x359 + 359; x360 + 360; x361 + 361; x362 + 362; x363 + 363; x364 + 364; x365 + 365; x366 + 366; x367 + 367; x368 + 368; x369 + 369; x370 + 370; x371 + 371; x372 + 372; x373 + 373; x374 + 374; x375 + 375; x376 + 376; x377 + 377; x378 + 378; x379 + 379; x380 + 380; x381 + 381; x382 + 382; x383 + 383; x384 + 384; x385 + 385; x386 + 386; x387 + 387; x388 + 388; x389 + 389; x390 + 390; x391 + 391; x392 + 392; x393 + 393; x394 + 394; x395 + 395; x396 + 396; x397 + 397; x398 + 398; x399 + 399; x400 + 400; x401 + 401; x402 + 402; x403 + 403; x404 + 404; x405 + 405; x406 + 406; x407 + 407; x408 + 408; x409 + 409; x410 + 410; x411 + 411; x412 + 412; x413 + 413; x414 + 414; x415 + 415; x416 + 416; x417 + 417; x418 + 418; x419 + 419; x420 + 420; x421 + 421; x422 + 422; x423 + 423; x424 + 424; x425 + 425; x426 + 426; x427 + 427; x428 + 428; x429 + 429; x430 + 430; x431 + 431; x432 + 432; x433 + 433; x434 + 434; x435 + 435; x436 + 436; x437 + 437; x438 + 438; x439 + 439; x440 + 440; x441 + 441; x442 + 442; x443 + 443; x444 + 444; x445 + 445; x446 + 446; x447 + 447; x448 + 448; x449 + 449; x450 + 450; x451 + 451; x452 + 452; x453 + 453; x454 + 454; x455 + 455; x456 + 456; x457 + 457; x458 + 458; x459 + 459; x460 + 460; x461 + 461; x462 + 462; x463 + 463; x464 + 464; x465 + 465; x466 + 466; x467 + 467; x468 + 468; x469 + 469; x470 + 470; x471 + 471; x472 + 472; x473 + 473; x474 + 474; x475 + 475; x476 + 476; x477 + 477; x478 + 478; x479 + 479; x480 + 480; x481 + 481; x482 + 482; x483 + 483; x484 + 484; x485 + 485; x486 + 486; x487 + 487; x488 + 488; x489 + 489; x490 + 490; x491 + 491; x492 + 492; x493 + 493; x494 + 494; x495 + 495; x496 + 496; x497 + 497; x498 + 498; x499 + 499; x500 + 500; x501 + 501; x502 + 502; x503 + 503; x504 + 504; x505 + 505; x506 + 506; x507 + 507; x508 + 508; x509 + 509; x510 + 510; x511 + 511; x512 + 512; x513 + 513; x514 + 514; x515 + 515; x516 + 516; x517 + 517; x518 + 518; x519 + 519; x520 + 520; x521 + 521; x522 + 522; x523 + 523; x524 + 524; x525 + 525; x526 + 526; x527 + 527; x528 + 528; x529 + 529; x530 + 530; x531 + 531; x532 + 532; x533 + 533; x534 + 534; x535 + 535; x536 + 536; x537 + 537; x538 + 538; x539 + 539; x540 + 540; x541 + 541; x542 + 542; x543 + 543; x544 + 544; x545 + 545; x546 + 546; x547 + 547; x548 + 548; x549 + 549; x550 + 550; x551 + 551; x552 + 552; x553 + 553; x554 + 554; x555 + 555; x556 + 556; x557 + 557; x558 + 558; x559 + 559; x560 + 560; x561 + 561; x562 + 562; x563 + 563; x564 + 564; x565 + 565; x566 + 566; x567 + 567; x568 + 568; x569 + 569; x570 + 570; x571 + 571; x572 + 572; x573 + 573; x574 + 574; x575 + 575; x576 + 576; x577 + 577; x578 + 578; x579 + 579; x580 + 580; x581 + 581; x582 + 582; x583 + 583; x584 + 584; x585 + 585; x586 + 586; x587 + 587; x588 + 588; x589 + 589; x590 + 590; x591 + 591; x592 + 592; x593 + 593; x594 + 594; x595 + 595; x596 + 596; x597 + 597; x598 + 598; x599 + 599; x600 + 600; x601 + 601; x602 + 602; x603 + 603; x604 + 604; x605 + 605; x606 + 606; x607 + 607; x608 + 608; x609 + 609; x610 + 610; x611 + 611; x612 + 612; x613 + 613; x614 + 614; x615 + 615; x616 + 616; x617 + 617; x618 + 618; x619 + 619; x620 + 620; x621 + 621; x622 + 622; x623 + 623; x624 + 624; x625 + 625; x626 + 626; x627 + 627; x628 + 628; x629 + 629; x630 + 630; x631 + 631; x632 + 632; x633 + 633; x634 + 634; x635 + 635; x636 + 636; x637 + 637; x638 + 638; x639 + 639; x640 + 640; x641 + 641; x642 + 642; x643 + 643; x644 + 644; x645 + 645; x646 + 646; x647 + 647; x648 + 648; x649 + 649; x650 + 650; x651 + 651; x652 + 652; x653 + 653; x654 + 654; x655 + 655; x656 + 656; x657 + 657; x658 + 658; x659 + 659; x660 + 660; x661 + 661; x662 + 662; x663 + 663; x664 + 664; x665 + 665; x666 + 666; x667 + 667; x668 + 668; x669 + 669; x670 + 670; x671 + 671; x672 + 672; x673 + 673; x674 + 674; x675 + 675; x676 + 676; x677 + 677; x678 + 678; x679 + 679; x680 + 680; x681 + 681; x682 + 682; x683 + 683; x684 + 684; x685 + 685; x686 + 686; x687 + 687; x688 + 688; x689 + 689; x690 + 690; x691 + 691; x692 + 692; x693 + 693; x694 + 694; x695 + 695; x696 + 696; x697 + 697; x698 + 698; x699 + 699; x700 + 700; x701 + 701; x702 + 702; x703 + 703; x704 + 704; x705 + 705; x706 + 706; x707 + 707; x708 + 708; x709 + 709; x710 + 710; x711 + 711; x712 + 712; x713 + 713; x714 + 714; x715 + 715; x716 + 716; x717 + 717; x718 + 718; x719 + 719; x720 + 720; x721 + 721; x722 + 722; x723 + 723; x724 + 724; x725 + 725; x726 + 726; x727 + 727; x728 + 728; x729 + 729; x730 + 730; x731 + 731; x732 + 732; x733 + 733; x734 + 734; x735 + 735; x736 + 736; x737 + 737; x738 + 738; x739 + 739; x740 + 740; x741 + 741; x742 + 742; x743 + 743; x744 + 744; x745 + 745; x746 + 746; x747 + 747; x748 + 748; x749 + 749; x750 + 750; x751 + 751; x752 + 752; x753 + 753; x754 + 754; x755 + 755; x756 + 756; x757 + 757; x758 + 758; x759 + 759; x760 + 760; x761 + 761; x762 + 762; x763 + 763; x764 + 764; x765 + 765; x766 + 766; x767 + 767; x768 + 768; x769 + 769; x770 + 770; x771 + 771; x772 + 772; x773 + 773; x774 + 774; x775 + 775; x776 + 776; x777 + 777; x778 + 778; x779 + 779; x780 + 780; x781 + 781; x782 + 782; x783 + 783; x784 + 784; x785 + 785; x786 + 786; x787 + 787; x788 + 788; x789 + 789; x790 + 790; x791 + 791; x792 + 792; x793 + 793; x794 + 794; x795 + 795; x796 + 796; x797 + 797; x798 + 798; x799 + 799; x800 + 800; x801 + 801; x802 + 802; x803 + 803; x804 + 804; x805 + 805; x806 + 806; x807 + 807; x808 + 808; x809 + 809; x810 + 810; x811 + 811; x812 + 812; x813 + 813; x814 + 814; x815 + 815; x816 + 816; x817 + 817; x818 + 818; x819 + 819; x820 + 820; x821 + 821; x822 + 822; x823 + 823; x824 + 824; x825 + 825; x826 + 826; x827 + 827; x828 + 828; x829 + 829; x830 + 830; x831 + 831; x832 + 832; x833 + 833; x834 + 834; x835 + 835; x836 + 836; x837 + 837; x838 + 838; x839 + 839; x840 + 840; x841 + 841; x842 + 842; x843 + 843; x844 + 844; x845 + 845; x846 + 846; x847 + 847; x848 + 848; x849 + 849; x850 + 850; x851 + 851; x852 + 852; x853 + 853; x854 + 854; x855 + 855; x856 + 856; x857 + 857; x858 + 858; x859 + 859; x860 + 860; x861 + 861; x862 + 862; x863 + 863; x864 + 864; x865 + 865; x866 + 866; x867 + 867; x868 + 868; x869 + 869; x870 + 870; x871 + 871; x872 + 872; x873 + 873; x874 + 874; x875 + 875; x876 + 876; x877 + 877; x878 + 878; x879 + 879; x880 + 880; x881 + 881; x882 + 882; x883 + 883; x884 + 884; x885 + 885; x886 + 886; x887 + 887; x888 + 888; x889 + 889; x890 + 890; x891 + 891; x892 + 892; x893 + 893; x894 + 894; x895 + 895; x896 + 896; x897 + 897; x898 + 898; x899 + 899; x900 + 900; x901 + 901; x902 + 902; x903 + 903; x904 + 904; x905 + 905; x906 + 906; x907 + 907; x908 + 908; x909 + 909; x910 + 910; x911 + 911; x912 + 912; x913 + 913; x914 + 914; x915 + 915; x916 + 916; x917 + 917; x918 + 918; x919 + 919; x920 + 920; x921 + 921; x922 + 922; x923 + 923; x924 + 924; x925 + 925; x926 + 926; x927 + 927; x928 + 928; x929 + 929; x930 + 930; x931 + 931; x932 + 932; x933 + 933; x934 + 934; x935 + 935; x936 + 936; x937 + 937; x938 + 938; x939 + 939; x940 + 940; x941 + 941; x942 + 942; x943 + 943; x944 + 944; x945 + 945; x946 + 946; x947 + 947; x948 + 948; x949 + 949; x950 + 950; x951 + 951; x952 + 952; x953 + 953; x954 + 954; x955 + 955; x956 + 956; x957 + 957; x958 + 958; x959 + 959; x960 + 960; x961 + 961; x962 + 962; x963 + 963; x964 + 964; x965 + 965; x966 + 966; x967 + 967; x968 + 968; x969 + 969; x970 + 970; x971 + 971; x972 + 972; x973 + 973; x974 + 974; x975 + 975; x976 + 976; x977 + 977; x978 + 978; x979 + 979; x980 + 980; x981 + 981; x982 + 982; x983 + 983; x984 + 984; x985 + 985; x986 + 986; x987 + 987; x988 + 988; x989 + 989; x990 + 990; x991 + 991; x992 + 992; x993 + 993; x994 + 994; x995 + 995; x996 + 996; x997 + 997; x998 + 998; x999 + 999; x1000 + 1000; x1001 + 1001; x1002 + 1002; x1003 + 1003; x1004 + 1004; x1005 + 1005; x1006 + 1006; x1007 + 1007; x1008 + 1008; x1009 + 1009; x1010 + 1010; x1011 + 1011; x1012 + 1012; x1013 + 1013; x1014 + 1014; x1015 + 1015; x1016 + 1016; x1017 + 1017; x1018 + 1018; x1019 + 1019; x1020 + 1020; x1021 + 1021; x1022 + 1022; x1023 + 1023; x1024 + 1024; x1025 + 1025; x1026 + 1026; x1027 + 1027; x1028 + 1028; x1029 + 1029; x1030 + 1030; x1031 + 1031; x1032 + 1032; x1033 + 1033; x1034 + 1034; x1035 + 1035; x1036 + 1036; x1037 + 1037; x1038 + 1038; x1039 + 1039; x1040 + 1040; x1041 + 1041; x1042 + 1042; x1043 + 1043; x1044 + 1044; x1045 + 1045; x1046 + 1046; x1047 + 1047; x1048 + 1048; x1049 + 1049; x1050 + 1050; x1051 + 1051; x1052 + 1052; x1053 + 1053; x1054 + 1054; x1055 + 1055; x1056 + 1056; x1057 + 1057; x1058 + 1058; x1059 + 1059; x1060 + 1060; x1061 + 1061; x1062 + 1062; x1063 + 1063; x1064 + 1064; x1065 + 1065; x1066 + 1066; x1067 + 1067; x1068 + 1068; x1069 + 1069; x1070 + 1070; x1071 + 1071; x1072 + 1072; x1073 + 1073; x1074 + 1074; x1075 + 1075; x1076 + 1076; x1077 + 1077; x1078 + 1078; x1079 + 1079; x1080 + 1080; x1081 + 1081; x1082 + 1082; x1083 + 1083; x1084 + 1084; x1085 + 1085; x1086 + 1086; x1087 + 1087; x1088 + 1088; x1089 + 1089; x1090 + 1090; x1091 + 1091; x1092 + 1092; x1093 + 1093; x1094 + 1094; x1095 + 1095; x1096 + 1096; x1097 + 1097; x1098 + 1098; x1099 + 1099; x1100 + 1100; x1101 + 1101; x1102 + 1102; x1103 + 1103; x1104 + 1104; x1105 + 1105; x1106 + 1106; x1107 + 1107; x1108 + 1108; x1109 + 1109; x1110 + 1110; x1111 + 1111; x1112 + 1112; x1113 + 1113; x1114 + 1114; x1115 + 1115; x1116 + 1116; x1117 + 1117; x1118 + 1118; x1119 + 1119; x1120 + 1120; x1121 + 1121; x1122 + 1122; x1123 + 1123; x1124 + 1124; x1125 + 1125; x1126 + 1126; x1127 + 1127; x1128 + 1128; x1129 + 1129; x1130 + 1130; x1131 + 1131; x1132 + 1132; x1133 + 1133; x1134 + 1134; x1135 + 1135; x1136 + 1136; x1137 + 1137; x1138 + 1138; x1139 + 1139; x1140 + 1140; x1141 + 1141; x1142 + 1142; x1143 + 1143; x1144 + 1144; x1145 + 1145; x1146 + 1146; x1147 + 1147; x1148 + 1148; x1149 + 1149; x1150 + 1150; x1151 + 1151; x1152 + 1152; x1153 + 1153; x1154 + 1154; x1155 + 1155; x1156 + 1156; x1157 + 1157; x1158 + 1158; x1159 + 1159; x1160 + 1160; x1161 + 1161; x1162 + 1162; x1163 + 1163; x1164 + 1164; x1165 + 1165; x1166 + 1166; x1167 + 1167; x1168 + 1168; x1169 + 1169; x1170 + 1170; x1171 + 1171; x1172 + 1172; x1173 + 1173; x1174 + 1174; x1175 + 1175; x1176 + 1176; x1177 + 1177; x1178 + 1178; x1179 + 1179; x1180 + 1180; x1181 + 1181; x1182 + 1182; x1183 + 1183; x1184 + 1184; x1185 + 1185; x1186 + 1186; x1187 + 1187; x1188 + 1188; x1189 + 1189; x1190 + 1190; x1191 + 1191; x1192 + 1192; x1193 + 1193; x1194 + 1194; x1195 + 1195; x1196 + 1196; x1197 + 1197; x1198 + 1198; x1199 + 1199; x1200 + 1200; x1201 + 1201; x1202 + 1202; x1203 + 1203; x1204 + 1204; x1205 + 1205; x1206 + 1206; x1207 + 1207; x1208 + 1208; x1209 + 1209; x1210 + 1210; x1211 + 1211; x1212 + 1212; x1213 + 1213; x1214 + 1214; x1215 + 1215; x1216 + 1216; x1217 + 1217; x1218 + 1218; x1219 + 1219; x1220 + 1220; x1221 + 1221; x1222 + 1222; x1223 + 1223; x1224 + 1224; x1225 + 1225; x1226 + 1226; x1227 + 1227; x1228 + 1228; x1229 + 1229; x1230 + 1230; x1231 + 1231; x1232 + 1232; x1233 + 1233; x1234 + 1234; x1235 + 1235; x1236 + 1236; x1237 + 1237; x1238 + 1238; x1239 + 1239; x1240 + 1240; x1241 + 1241; x1242 + 1242; x1243 + 1243; x1244 + 1244; x1245 + 1245; x1246 + 1246; x1247 + 1247; x1248 + 1248; x1249 + 1249; x1250 + 1250; x1251 + 1251; x1252 + 1252; x1253 + 1253; x1254 + 1254; x1255 + 1255; x1256 + 1256; x1257 + 1257; x1258 + 1258; x1259 + 1259; x1260 + 1260; x1261 + 1261; x1262 + 1262; x1263 + 1263; x1264 + 1264; x1265 + 1265; x1266 + 1266; x1267 + 1267; x1268 + 1268; x1269 + 1269; x1270 + 1270; x1271 + 1271; x1272 + 1272; x1273 + 1273; x1274 + 1274; x1275 + 1275; x1276 + 1276; x1277 + 1277; x1278 + 1278; x1279 + 1279; x1280 + 1280; x1281 + 1281; x1282 + 1282; x1283 + 1283; x1284 + 1284; x1285 + 1285; x1286 + 1286; x1287 + 1287; x1288 + 1288; x1289 + 1289; x1290 + 1290; x1291 + 1291; x1292 + 1292; x1293 + 1293; x1294 + 1294; x1295 + 1295; x1296 + 1296; x1297 + 1297; x1298 + 1298; x1299 + 1299; x1300 + 1300; x1301 + 1301; x1302 + 1302; x1303 + 1303; x1304 + 1304; x1305 + 1305; x1306 + 1306; x1307 + 1307; x1308 + 1308; x1309 + 1309; x1310 + 1310; x1311 + 1311; x1312 + 1312; x1313 + 1313; x1314 + 1314; x1315 + 1315; x1316 + 1316; x1317 + 1317; x1318 + 1318; x1319 + 1319; x1320 + 1320; x1321 + 1321; x1322 + 1322; x1323 + 1323; x1324 + 1324; x1325 + 1325; x1326 + 1326; x1327 + 1327; x1328 + 1328; x1329 + 1329; x1330 + 1330; x1331 + 1331; x1332 + 1332; x1333 + 1333; x1334 + 1334; x1335 + 1335; x1336 + 1336; x1337 + 1337; x1338 + 1338; x1339 + 1339; x1340 + 1340; x1341 + 1341; x1342 + 1342; x1343 + 1343; x1344 + 1344; x1345 + 1345; x1346 + 1346; x1347 + 1347; x1348 + 1348; x1349 + 1349; x1350 + 1350; x1351 + 1351; x1352 + 1352; x1353 + 1353; x1354 + 1354; x1355 + 1355; x1356 + 1356; x1357 + 1357; x1358 + 1358; x1359 + 1359; x1360 + 1360; x1361 + 1361; x1362 + 1362; x1363 + 1363; x1364 + 1364; x1365 + 1365; x1366 + 1366; x1367 + 1367; x1368 + 1368; x1369 + 1369; x1370 + 1370; x1371 + 1371; x1372 + 1372; x1373 + 1373; x1374 + 1374; x1375 + 1375; x1376 + 1376; x1377 + 1377; x1378 + 1378; x1379 + 1379; x1380 + 1380; x1381 + 1381; x1382 + 1382; x1383 + 1383; x1384 + 1384; x1385 + 1385; x1386 + 1386; x1387 + 1387; x1388 + 1388; x1389 + 1389; x1390 + 1390; x1391 + 1391; x1392 + 1392; x1393 + 1393; x1394 + 1394; x1395 + 1395; x1396 + 1396; x1397 + 1397; x1398 + 1398; x1399 + 1399; x1400 + 1400; x1401 + 1401; x1402 + 1402; x1403 + 1403; x1404 + 1404; x1405 + 1405; x1406 + 1406; x1407 + 1407; x1408 + 1408; x1409 + 1409; x1410 + 1410; x1411 + 1411; x1412 + 1412; x1413 + 1413; x1414 + 1414; x1415 + 1415; x1416 + 1416; x1417 + 1417; x1418 + 1418; x1419 + 1419; x1420 + 1420; x1421 + 1421; x1422 + 1422; x1423 + 1423; x1424 + 1424; x1425 + 1425; x1426 + 1426; x1427 + 1427; x1428 + 1428; x1429 + 1429; x1430 + 1430; x1431 + 1431; x1432 + 1432; x1433 + 1433; x1434 + 1434; x1435 + 1435; x1436 + 1436; x1437 + 1437; x1438 + 1438; x1439 + 1439; x1440 + 1440; x1441 + 1441; x1442 + 1442; x1443 + 1443; x1444 + 1444; x1445 + 1445; x1446 + 1446; x1447 + 1447; x1448 + 1448; x1449 + 1449; x1450 + 1450; x1451 + 1451; x1452 + 1452; x1453 + 1453; x1454 + 1454; x1455 + 1455; x1456 + 1456; x1457 + 1457; x1458 + 1458; x1459 + 1459; x1460 + 1460; x1461 + 1461; x1462 + 1462; x1463 + 1463; x1464 + 1464; x1465 + 1465; x1466 + 1466; x1467 + 1467; x1468 + 1468; x1469 + 1469; x1470 + 1470; x1471 + 1471; x1472 + 1472; x1473 + 1473; x1474 + 1474; x1475 + 1475; x1476 + 1476; x1477 + 1477; x1478 + 1478; x1479 + 1479; x1480 + 1480; x1481 + 1481; x1482 + 1482; x1483 + 1483; x1484 + 1484; x1485 + 1485; x1486 + 1486; x1487 + 1487; x1488 + 1488; x1489 + 1489; x1490 + 1490; x1491 + 1491; x1492 + 1492; x1493 + 1493; x1494 + 1494; x1495 + 1495; x1496 + 1496; x1497 + 1497; x1498 + 1498; x1499 + 1499; x1500 + 1500; x1501 + 1501; x1502 + 1502; x1503 + 1503; x1504 + 1504; x1505 + 1505; x1506 + 1506; x1507 + 1507; x1508 + 1508; x1509 + 1509; x1510 + 1510; x1511 + 1511; x1512 + 1512; x1513 + 1513; x1514 + 1514; x1515 + 1515; x1516 + 1516; x1517 + 1517; x1518 + 1518; x1519 + 1519; x1520 + 1520; x1521 + 1521; x1522 + 1522; x1523 + 1523; x1524 + 1524; x1525 + 1525; x1526 + 1526; x1527 + 1527; x1528 + 1528; x1529 + 1529; x1530 + 1530; x1531 + 1531; x1532 + 1532; x1533 + 1533; x1534 + 1534; x1535 + 1535; x1536 + 1536; x1537 + 1537; x1538 + 1538; x1539 + 1539; x1540 + 1540; x1541 + 1541; x1542 + 1542; x1543 + 1543; x1544 + 1544; x1545 + 1545; x1546 + 1546; x1547 + 1547; x1548 + 1548; x1549 + 1549; x1550 + 1550; x1551 + 1551; x1552 + 1552; x1553 + 1553; x1554 + 1554; x1555 + 1555; x1556 + 1556; x1557 + 1557; x1558 + 1558; x1559 + 1559; x1560 + 1560; x1561 + 1561; x1562 + 1562; x1563 + 1563; x1564 + 1564; x1565 + 1565; x1566 + 1566; x1567 + 1567; x1568 + 1568; x1569 + 1569; x1570 + 1570; x1571 + 1571; x1572 + 1572; x1573 + 1573; x1574 + 1574; x1575 + 1575; x1576 + 1576; x1577 + 1577; x1578 + 1578; x1579 + 1579; x1580 + 1580; x1581 + 1581; x1582 + 1582; x1583 + 1583; x1584 + 1584; x1585 + 1585; x1586 + 1586; x1587 + 1587; x1588 + 1588; x1589 + 1589; x1590 + 1590; x1591 + 1591; x1592 + 1592; x1593 + 1593; x1594 + 1594; x1595 + 1595; x1596 + 1596; x1597 + 1597; x1598 + 1598; x1599 + 1599; x1600 + 1600; x1601 + 1601; x1602 + 1602; x1603 + 1603; x1604 + 1604; x1605 + 1605; x1606 + 1606; x1607 + 1607; x1608 + 1608; x1609 + 1609; x1610 + 1610; x1611 + 1611; x1612 + 1612; x1613 + 1613; x1614 + 1614; x1615 + 1615; x1616 + 1616; x1617 + 1617; x1618 + 1618; x1619 + 1619; x1620 + 1620; x1621 + 1621; x1622 + 1622; x1623 + 1623; x1624 + 1624; x1625 + 1625; x1626 + 1626; x1627 + 1627; x1628 + 1628; x1629 + 1629; x1630 + 1630; x1631 + 1631; x1632 + 1632; x1633 + 1633; x1634 + 1634; x1635 + 1635; x1636 + 1636; x1637 + 1637; x1638 + 1638; x1639 + 1639; x1640 + 1640; x1641 + 1641; x1642 + 1642; x1643 + 1643; x1644 + 1644; x1645 + 1645; x1646 + 1646; x1647 + 1647; x1648 + 1648; x1649 + 1649; x1650 + 1650; x1651 + 1651; x1652 + 1652; x1653 + 1653; x1654 + 1654; x1655 + 1655; x1656 + 1656; x1657 + 1657; x1658 + 1658; x1659 + 1659; x1660 + 1660; x1661 + 1661; x1662 + 1662; x1663 + 1663; x1664 + 1664; x1665 + 1665; x1666 + 1666; x1667 + 1667; x1668 + 1668; x1669 + 1669; x1670 + 1670; x1671 + 1671; x1672 + 1672; x1673 + 1673; x1674 + 1674; x1675 + 1675; x1676 + 1676; x1677 + 1677; x1678 + 1678; x1679 + 1679; x1680 + 1680; x1681 + 1681; x1682 + 1682; x1683 + 1683; x1684 + 1684; x1685 + 1685; x1686 + 1686; x1687 + 1687; x1688 + 1688; x1689 + 1689; x1690 + 1690; x1691 + 1691; x1692 + 1692; x1693 + 1693; x1694 + 1694; x1695 + 1695; x1696 + 1696; x1697 + 1697; x1698 + 1698; x1699 + 1699; x1700 + 1700; x1701 + 1701; x1702 + 1702; x1703 + 1703; x1704 + 1704; x1705 + 1705; x1706 + 1706; x1707 + 1707; x1708 + 1708; x1709 + 1709; x1710 + 1710; x1711 + 1711; x1712 + 1712; x1713 + 1713; x1714 + 1714; x1715 + 1715; x1716 + 1716; x1717 + 1717; x1718 + 1718; x1719 + 1719; x1720 + 1720; x1721 + 1721; x1722 + 1722; x1723 + 1723; x1724 + 1724; x1725 + 1725; x1726 + 1726; x1727 + 1727; x1728 + 1728; x1729 + 1729; x1730 + 1730; x1731 + 1731; x1732 + 1732; x1733 + 1733; x1734 + 1734; x1735 + 1735; x1736 + 1736; x1737 + 1737; x1738 + 1738; x1739 + 1739; x1740 + 1740; x1741 + 1741; x1742 + 1742; x1743 + 1743; x1744 + 1744; x1745 + 1745; x1746 + 1746; x1747 + 1747; x1748 + 1748; x1749 + 1749; x1750 + 1750; x1751 + 1751; x1752 + 1752; x1753 + 1753; x1754 + 1754; x1755 + 1755; x1756 + 1756; x1757 + 1757; x1758 + 1758; x1759 + 1759; x1760 + 1760; x1761 + 1761; x1762 + 1762; x1763 + 1763; x1764 + 1764; x1765 + 1765; x1766 + 1766; x1767 + 1767; x1768 + 1768; x1769 + 1769; x1770 + 1770; x1771 + 1771; x1772 + 1772; x1773 + 1773; x1774 + 1774; x1775 + 1775; x1776 + 1776; x1777 + 1777; x1778 + 1778; x1779 + 1779; x1780 + 1780; x1781 + 1781; x1782 + 1782; x1783 + 1783; x1784 + 1784; x1785 + 1785; x1786 + 1786; x1787 + 1787; x1788 + 1788; x1789 + 1789; x1790 + 1790; x1791 + 1791; x1792 + 1792; x1793 + 1793; x1794 + 1794; x1795 + 1795; x1796 + 1796; x1797 + 1797; x1798 + 1798; x1799 + 1799; x1800 + 1800; x1801 + 1801; x1802 + 1802; x1803 + 1803; x1804 + 1804; x1805 + 1805; x1806 + 1806; x1807 + 1807; x1808 + 1808; x1809 + 1809; x1810 + 1810; x1811 + 1811; x1812 + 1812; x1813 + 1813; x1814 + 1814; x1815 + 1815; x1816 + 1816; x1817 + 1817; x1818 + 1818; x1819 + 1819; x1820 + 1820; x1821 + 1821; x1822 + 1822; x1823 + 1823; x1824 + 1824; x1825 + 1825; x1826 + 1826; x1827 + 1827; x1828 + 1828; x1829 + 1829; x1830 + 1830; x1831 + 1831; x1832 + 1832; x1833 + 1833; x1834 + 1834; x1835 + 1835; x1836 + 1836; x1837 + 1837; x1838 + 1838; x1839 + 1839; x1840 + 1840; x1841 + 1841; x1842 + 1842; x1843 + 1843; x1844 + 1844; x1845 + 1845; x1846 + 1846; x1847 + 1847; x1848 + 1848; x1849 + 1849; x1850 + 1850; x1851 + 1851; x1852 + 1852; x1853 + 1853; x1854 + 1854; x1855 + 1855; x1856 + 1856; x1857 + 1857; x1858 + 1858; x1859 + 1859; x1860 + 1860; x1861 + 1861; x1862 + 1862; x1863 + 1863; x1864 + 1864; x1865 + 1865; x1866 + 1866; x1867 + 1867; x1868 + 1868; x1869 + 1869; x1870 + 1870; x1871 + 1871; x1872 + 1872; x1873 + 1873; x1874 + 1874; x1875 + 1875; x1876 + 1876; x1877 + 1877; x1878 + 1878; x1879 + 1879; x1880 + 1880; x1881 + 1881; x1882 + 1882; x1883 + 1883; x1884 + 1884; x1885 + 1885; x1886 + 1886; x1887 + 1887; x1888 + 1888; x1889 + 1889; x1890 + 1890; x1891 + 1891; x1892 + 1892; x1893 + 1893; x1894 + 1894; x1895 + 1895; x1896 + 1896; x1897 + 1897; x1898 + 1898; x1899 + 1899; x1900 + 1900; x1901 + 1901; x1902 + 1902; x1903 + 1903; x1904 + 1904; x1905 + 1905; x1906 + 1906; x1907 + 1907; x1908 + 1908; x1909 + 1909; x1910 + 1910; x1911 + 1911; x1912 + 1912; x1913 + 1913; x1914 + 1914; x1915 + 1915; x1916 + 1916; x1917 + 1917; x1918 + 1918; x1919 + 1919; x1920 + 1920; x1921 + 1921; x1922 + 1922; x1923 + 1923; x1924 + 1924; x1925 + 1925; x1926 + 1926; x1927 + 1927; x1928 + 1928; x1929 + 1929; x1930 + 1930; x1931 + 1931; x1932 + 1932; x1933 + 1933; x1934 + 1934; x1935 + 1935; x1936 + 1936; x1937 + 1937; x1938 + 1938; x1939 + 1939; x1940 + 1940; x1941 + 1941; x1942 + 1942; x1943 + 1943; x1944 + 1944; x1945 + 1945; x1946 + 1946; x1947 + 1947; x1948 + 1948; x1949 + 1949; x1950 + 1950; x1951 + 1951; x1952 + 1952; x1953 + 1953; x1954 + 1954; x1955 + 1955; x1956 + 1956; x1957 + 1957; x1958 + 1958; x1959 + 1959; x1960 + 1960; x1961 + 1961; x1962 + 1962; x1963 + 1963; x1964 + 1964; x1965 + 1965; x1966 + 1966; x1967 + 1967; x1968 + 1968; x1969 + 1969; x1970 + 1970; x1971 + 1971; x1972 + 1972; x1973 + 1973; x1974 + 1974; x1975 + 1975; x1976 + 1976; x1977 + 1977; x1978 + 1978; x1979 + 1979; x1980 + 1980; x1981 + 1981; x1982 + 1982; x1983 + 1983; x1984 + 1984; x1985 + 1985; x1986 + 1986; x1987 + 1987; x1988 + 1988; x1989 + 1989; x1990 + 1990; x1991 + 1991; x1992 + 1992; x1993 + 1993; x1994 + 1994; x1995 + 1995; x1996 + 1996; x1997 + 1997; x1998 + 1998; x1999 + 1999; x2000 + 2000; x2001 + 2001; x2002 + 2002; x2003 + 2003; x2004 + 2004; x2005 + 2005; x2006 + 2006; x2007 + 2007; x2008 + 2008; x2009 + 2009; x2010 + 2010; x2011 + 2011; x2012 + 2012; x2013 + 2013; x2014 + 2014; x2015 + 2015; x2016 + 2016; x2017 + 2017; x2018 + 2018; x2019 + 2019; x2020 + 2020; x2021 + 2021; x2022 + 2022; x2023 + 2023; x2024 + 2024; x2025 + 2025; x2026 + 2026; x2027 + 2027; x2028 + 2028; x2029 + 2029; x2030 + 2030; x2031 + 2031; x2032 + 2032; x2033 + 2033; x2034 + 2034; x2035 + 2035; x2036 + 2036; x2037 + 2037; x2038 + 2038; x2039 + 2039; x2040 + 2040; x2041 + 2041; x2042 + 2042; x2043 + 2043; x2044 + 2044; x2045 + 2045; x2046 + 2046; x2047 + 2047; x2048 + 2048; x2049 + 2049; x2050 + 2050; x2051 + 2051; x2052 + 2052; x2053 + 2053; x2054 + 2054; x2055 + 2055; x2056 + 2056; x2057 + 2057; x2058 + 2058; x2059 + 2059; x2060 + 2060; x2061 + 2061; x2062 + 2062; x2063 + 2063; x2064 + 2064; x2065 + 2065; x2066 + 2066; x2067 + 2067; x2068 + 2068; x2069 + 2069; x2070 + 2070; x2071 + 2071; x2072 + 2072; x2073 + 2073; x2074 + 2074; x2075 + 2075; x2076 + 2076; x2077 + 2077; x2078 + 2078; x2079 + 2079; x2080 + 2080; x2081 + 2081; x2082 + 2082; x2083 + 2083; x2084 + 2084; x2085 + 2085; x2086 + 2086; x2087 + 2087; x2088 + 2088; x2089 + 2089; x2090 + 2090; x2091 + 2091; x2092 + 2092; x2093 + 2093; x2094 + 2094; x2095 + 2095; x2096 + 2096; x2097 + 2097; x2098 + 2098; x2099 + 2099; x2100 + 2100; x2101 + 2101; x2102 + 2102; x2103 + 2103; x2104 + 2104; x2105 + 2105; x2106 + 2106; x2107 + 2107; x2108 + 2108; x2109 + 2109; x2110 + 2110; x2111 + 2111; x2112 + 2112; x2113 + 2113; x2114 + 2114; x2115 + 2115; x2116 + 2116; x2117 + 2117; x2118 + 2118; x2119 + 2119; x2120 + 2120; x2121 + 2121; x2122 + 2122; x2123 + 2123; x2124 + 2124; x2125 + 2125; x2126 + 2126; x2127 + 2127; x2128 + 2128; x2129 + 2129; x2130 + 2130; x2131 + 2131; x2132 + 2132; x2133 + 2133; x2134 + 2134; x2135 + 2135; x2136 + 2136; x2137 + 2137; x2138 + 2138; x2139 + 2139; x2140 + 2140; x2141 + 2141; x2142 + 2142; x2143 + 2143; x2144 + 2144; x2145 + 2145; x2146 + 2146; x2147 + 2147; x2148 + 2148; x2149 + 2149; x2150 + 2150; x2151 + 2151; x2152 + 2152; x2153 + 2153; x2154 + 2154; x2155 + 2155; x2156 + 2156; x2157 + 2157; x2158 + 2158; x2159 + 2159; x2160 + 2160; x2161 + 2161; x2162 + 2162; x2163 + 2163; x2164 + 2164; x2165 + 2165; x2166 + 2166; x2167 + 2167; x2168 + 2168; x2169 + 2169; x2170 + 2170; x2171 + 2171; x2172 + 2172; x2173 + 2173; x2174 + 2174; x2175 + 2175; x2176 + 2176; x2177 + 2177; x2178 + 2178; x2179 + 2179; x2180 + 2180; x2181 + 2181; x2182 + 2182; x2183 + 2183; x2184 + 2184; x2185 + 2185; x2186 + 2186; x2187 + 2187; x2188 + 2188; x2189 + 2189; x2190 + 2190; x2191 + 2191; x2192 + 2192; x2193 + 2193; x2194 + 2194; x2195 + 2195; x2196 + 2196; x2197 + 2197; x2198 + 2198; x2199 + 2199; x2200 + 2200; x2201 + 2201; x2202 + 2202; x2203 + 2203; x2204 + 2204; x2205 + 2205; x2206 + 2206; x2207 + 2207; x2208 + 2208; x2209 + 2209; x2210 + 2210; x2211 + 2211; x2212 + 2212; x2213 + 2213; x2214 + 2214; x2215 + 2215; x2216 + 2216; x2217 + 2217; x2218 + 2218; x2219 + 2219; x2220 + 2220; x2221 + 2221; x2222 + 2222; x2223 + 2223; x2224 + 2224; x2225 + 2225; x2226 + 2226; x2227 + 2227; x2228 + 2228; x2229 + 2229; x2230 + 2230; x2231 + 2231; x2232 + 2232; x2233 + 2233; x2234 + 2234; x2235 + 2235; x2236 + 2236; x2237 + 2237; x2238 + 2238; x2239 + 2239; x2240 + 2240; x2241 + 2241; x2242 + 2242; x2243 + 2243; x2244 + 2244; x2245 + 2245; x2246 + 2246; x2247 + 2247; x2248 + 2248; x2249 + 2249; x2250 + 2250; x2251 + 2251; x2252 + 2252; x2253 + 2253; x2254 + 2254; x2255 + 2255; x2256 + 2256; x2257 + 2257; x2258 + 2258; x2259 + 2259; x2260 + 2260; x2261 + 2261; x2262 + 2262; x2263 + 2263; x2264 + 2264; x2265 + 2265; x2266 + 2266; x2267 + 2267; x2268 + 2268; x2269 + 2269; x2270 + 2270; x2271 + 2271; x2272 + 2272; x2273 + 2273; x2274 + 2274; x2275 + 2275; x2276 + 2276; x2277 + 2277; x2278 + 2278; x2279 + 2279; x2280 + 2280; x2281 + 2281; x2282 + 2282; x2283 + 2283; x2284 + 2284; x2285 + 2285; x2286 + 2286; x2287 + 2287; x2288 + 2288; x2289 + 2289; x2290 + 2290; x2291 + 2291; x2292 + 2292; x2293 + 2293; x2294 + 2294; x2295 + 2295; x2296 + 2296; x2297 + 2297; x2298 + 2298; x2299 + 2299; x2300 + 2300; x2301 + 2301; x2302 + 2302; x2303 + 2303; x2304 + 2304; x2305 + 2305; x2306 + 2306; x2307 + 2307; x2308 + 2308; x2309 + 2309; x2310 + 2310; x2311 + 2311; x2312 + 2312; x2313 + 2313; x2314 + 2314; x2315 + 2315; x2316 + 2316; x2317 + 2317; x2318 + 2318; x2319 + 2319; x2320 + 2320; x2321 + 2321; x2322 + 2322; x2323 + 2323; x2324 + 2324; x2325 + 2325; x2326 + 2326; x2327 + 2327; x2328 + 2328; x2329 + 2329; x2330 + 2330; x2331 + 2331; x2332 + 2332; x2333 + 2333; x2334 + 2334; x2335 + 2335; x2336 + 2336; x2337 + 2337; x2338 + 2338; x2339 + 2339; x2340 + 2340; x2341 + 2341; x2342 + 2342; x2343 + 2343; x2344 + 2344; x2345 + 2345; x2346 + 2346; x2347 + 2347; x2348 + 2348; x2349 + 2349; x2350 + 2350; x2351 + 2351; x2352 + 2352; x2353 + 2353; x2354 + 2354; x2355 + 2355; x2356 + 2356; x2357 + 2357; x2358 + 2358; x2359 + 2359; x2360 + 2360; x2361 + 2361; x2362 + 2362; x2363 + 2363; x2364 + 2364; x2365 + 2365; x2366 + 2366; x2367 + 2367; x2368 + 2368; x2369 + 2369; x2370 + 2370; x2371 + 2371; x2372 + 2372; x2373 + 2373; x2374 + 2374; x2375 + 2375; x2376 + 2376; x2377 + 2377; x2378 + 2378; x2379 + 2379; x2380 + 2380; x2381 + 2381; x2382 + 2382; x2383 + 2383; x2384 + 2384; x2385 + 2385; x2386 + 2386; x2387 + 2387; x2388 + 2388; x2389 + 2389; x2390 + 2390; x2391 + 2391; x2392 + 2392; x2393 + 2393; x2394 + 2394; x2395 + 2395; x2396 + 2396; x2397 + 2397; x2398 + 2398; x2399 + 2399; x2400 + 2400; x2401 + 2401; x2402 + 2402; x2403 + 2403; x2404 + 2404; x2405 + 2405; x2406 + 2406; x2407 + 2407; x2408 + 2408; x2409 + 2409; x2410 + 2410; x2411 + 2411; x2412 + 2412; x2413 + 2413; x2414 + 2414; x2415 + 2415; x2416 + 2416; x2417 + 2417; x2418 + 2418; x2419 + 2419; x2420 + 2420; x2421 + 2421; x2422 + 2422; x2423 + 2423; x2424 + 2424; x2425 + 2425; x2426 + 2426; x2427 + 2427; x2428 + 2428; x2429 + 2429; x2430 + 2430; x2431 + 2431; x2432 + 2432; x2433 + 2433; x2434 + 2434; x2435 + 2435; x2436 + 2436; x2437 + 2437; x2438 + 2438; x2439 + 2439; x2440 + 2440; x2441 + 2441; x2442 + 2442; x2443 + 2443; x2444 + 2444; x2445 + 2445; x2446 + 2446; x2447 + 2447; x2448 + 2448; x2449 + 2449; x2450 + 2450; x2451 + 2451; x2452 + 2452; x2453 + 2453; x2454 + 2454; x2455 + 2455; x2456 + 2456; x2457 + 2457; x2458 + 2458; x2459 + 2459; x2460 + 2460; x2461 + 2461; x2462 + 2462; x2463 + 2463; x2464 + 2464; x2465 + 2465; x2466 + 2466; x2467 + 2467; x2468 + 2468; x2469 + 2469; x2470 + 2470; x2471 + 2471; x2472 + 2472; x2473 + 2473; x2474 + 2474; x2475 + 2475; x2476 + 2476; x2477 + 2477; x2478 + 2478; x2479 + 2479; x2480 + 2480; x2481 + 2481; x2482 + 2482; x2483 + 2483; x2484 + 2484; x2485 + 2485; x2486 + 2486; x2487 + 2487; x2488 + 2488; x2489 + 2489; x2490 + 2490; x2491 + 2491; x2492 + 2492; x2493 + 2493; x2494 + 2494; x2495 + 2495; x2496 + 2496; x2497 + 2497; x2498 + 2498; x2499 + 2499; x2500 + 2500; x2501 + 2501; x2502 + 2502; x2503 + 2503; x2504 + 2504; x2505 + 2505; x2506 + 2506; x2507 + 2507; x2508 + 2508; x2509 + 2509; x2510 + 2510; x2511 + 2511; x2512 + 2512; x2513 + 2513; x2514 + 2514; x2515 + 2515; x2516 + 2516; x2517 + 2517; x2518 + 2518; x2519 + 2519; x2520 + 2520; x2521 + 2521; x2522 + 2522; x2523 + 2523; x2524 + 2524; x2525 + 2525; x2526 + 2526; x2527 + 2527; x2528 + 2528; x2529 + 2529; x2530 + 2530; x2531 + 2531; x2532 + 2532; x2533 + 2533; x2534 + 2534; x2535 + 2535; x2536 + 2536; x2537 + 2537; x2538 + 2538; x2539 + 2539; x2540 + 2540; x2541 + 2541; x2542 + 2542; x2543 + 2543; x2544 + 2544; x2545 + 2545; x2546 + 2546; x2547 + 2547; x2548 + 2548; x2549 + 2549; x2550 + 2550; x2551 + 2551; x2552 + 2552; x2553 + 2553; x2554 + 2554; x2555 + 2555; x2556 + 2556; x2557 + 2557; x2558 + 2558; x2559 + 2559; x2560 + 2560; x2561 + 2561; x2562 + 2562; x2563 + 2563; x2564 + 2564; x2565 + 2565; x2566 + 2566; x2567 + 2567; x2568 + 2568; x2569 + 2569; x2570 + 2570; x2571 + 2571; x2572 + 2572; x2573 + 2573; x2574 + 2574; x2575 + 2575; x2576 + 2576; x2577 + 2577; x2578 + 2578; x2579 + 2579; x2580 + 2580; x2581 + 2581; x2582 + 2582; x2583 + 2583; x2584 + 2584; x2585 + 2585; x2586 + 2586; x2587 + 2587; x2588 + 2588; x2589 + 2589; x2590 + 2590; x2591 + 2591; x2592 + 2592; x2593 + 2593; x2594 + 2594; x2595 + 2595; x2596 + 2596; x2597 + 2597; x2598 + 2598; x2599 + 2599; x2600 + 2600; x2601 + 2601; x2602 + 2602; x2603 + 2603; x2604 + 2604; x2605 + 2605; x2606 + 2606; x2607 + 2607; x2608 + 2608; x2609 + 2609; x2610 + 2610; x2611 + 2611; x2612 + 2612; x2613 + 2613; x2614 + 2614; x2615 + 2615; x2616 + 2616; x2617 + 2617; x2618 + 2618; x2619 + 2619; x2620 + 2620; x2621 + 2621; x2622 + 2622; x2623 + 2623; x2624 + 2624; x2625 + 2625; x2626 + 2626; x2627 + 2627; x2628 + 2628; x2629 + 2629; x2630 + 2630; x2631 + 2631; x2632 + 2632; x2633 + 2633; x2634 + 2634; x2635 + 2635; x2636 + 2636; x2637 + 2637; x2638 + 2638; x2639 + 2639; x2640 + 2640; x2641 + 2641; x2642 + 2642; x2643 + 2643; x2644 + 2644; x2645 + 2645; x2646 + 2646; x2647 + 2647; x2648 + 2648; x2649 + 2649; x2650 + 2650; x2651 + 2651; x2652 + 2652; x2653 + 2653; x2654 + 2654; x2655 + 2655; x2656 + 2656; x2657 + 2657; x2658 + 2658; x2659 + 2659; x2660 + 2660; x2661 + 2661; x2662 + 2662; x2663 + 2663; x2664 + 2664; x2665 + 2665; x2666 + 2666; x2667 + 2667; x2668 + 2668; x2669 + 2669; x2670 + 2670; x2671 + 2671; x2672 + 2672; x2673 + 2673; x2674 + 2674; x2675 + 2675; x2676 + 2676; x2677 + 2677; x2678 + 2678; x2679 + 2679; x2680 + 2680; x2681 + 2681; x2682 + 2682; x2683 + 2683; x2684 + 2684; x2685 + 2685; x2686 + 2686; x2687 + 2687; x2688 + 2688; x2689 + 2689; x2690 + 2690; x2691 + 2691; x2692 + 2692; x2693 + 2693; x2694 + 2694; x2695 + 2695; x2696 + 2696; x2697 + 2697; x2698 + 2698; x2699 + 2699; x2700 + 2700; x2701 + 2701; x2702 + 2702; x2703 + 2703; x2704 + 2704; x2705 + 2705; x2706 + 2706; x2707 + 2707; x2708 + 2708; x2709 + 2709; x2710 + 2710; x2711 + 2711; x2712 + 2712; x2713 + 2713; x2714 + 2714; x2715 + 2715; x2716 + 2716; x2717 + 2717; x2718 + 2718; x2719 + 2719; x2720 + 2720; x2721 + 2721; x2722 + 2722; x2723 + 2723; x2724 + 2724; x2725 + 2725; x2726 + 2726; x2727 + 2727; x2728 + 2728; x2729 + 2729; x2730 + 2730; x2731 + 2731; x2732 + 2732; x2733 + 2733; x2734 + 2734; x2735 + 2735; x2736 + 2736; x2737 + 2737; x2738 + 2738; x2739 + 2739; x2740 + 2740; x2741 + 2741; x2742 + 2742; x2743 + 2743; x2744 + 2744; x2745 + 2745; x2746 + 2746; x2747 + 2747; x2748 + 2748; x2749 + 2749; x2750 + 2750; x2751 + 2751; x2752 + 2752; x2753 + 2753; x2754 + 2754; x2755 + 2755; x2756 + 2756; x2757 + 2757; x2758 + 2758; x2759 + 2759; x2760 + 2760; x2761 + 2761; x2762 + 2762; x2763 + 2763; x2764 + 2764; x2765 + 2765; x2766 + 2766; x2767 + 2767; x2768 + 2768; x2769 + 2769; x2770 + 2770; x2771 + 2771; x2772 + 2772; x2773 + 2773; x2774 + 2774; x2775 + 2775; x2776 + 2776; x2777 + 2777; x2778 + 2778; x2779 + 2779; x2780 + 2780; x2781 + 2781; x2782 + 2782; x2783 + 2783; x2784 + 2784; x2785 + 2785; x2786 + 2786; x2787 + 2787; x2788 + 2788; x2789 + 2789; x2790 + 2790; x2791 + 2791; x2792 + 2792; x2793 + 2793; x2794 + 2794; x2795 + 2795; x2796 + 2796; x2797 + 2797; x2798 + 2798; x2799 + 2799; x2800 + 2800; x2801 + 2801; x2802 + 2802; x2803 + 2803; x2804 + 2804; x2805 + 2805; x2806 + 2806; x2807 + 2807; x2808 + 2808; x2809 + 2809; x2810 + 2810; x2811 + 2811; x2812 + 2812; x2813 + 2813; x2814 + 2814; x2815 + 2815; x2816 + 2816; x2817 + 2817; x2818 + 2818; x2819 + 2819; x2820 + 2820; x2821 + 2821; x2822 + 2822; x2823 + 2823; x2824 + 2824; x2825 + 2825; x2826 + 2826; x2827 + 2827; x2828 + 2828; x2829 + 2829; x2830 + 2830; x2831 + 2831; x2832 + 2832; x2833 + 2833; x2834 + 2834; x2835 + 2835; x2836 + 2836; x2837 + 2837; x2838 + 2838; x2839 + 2839; x2840 + 2840; x2841 + 2841; x2842 + 2842; x2843 + 2843; x2844 + 2844; x2845 + 2845; x2846 + 2846; x2847 + 2847; x2848 + 2848; x2849 + 2849; x2850 + 2850; x2851 + 2851; x2852 + 2852; x2853 + 2853; x2854 + 2854; x2855 + 2855; x2856 + 2856; x2857 + 2857; x2858 + 2858; x2859 + 2859; x2860 + 2860; x2861 + 2861; x2862 + 2862; x2863 + 2863; x2864 + 2864; x2865 + 2865; x2866 + 2866; x2867 + 2867; x2868 + 2868; x2869 + 2869; x2870 + 2870; x2871 + 2871; x2872 + 2872; x2873 + 2873; x2874 + 2874; x2875 + 2875; x2876 + 2876; x2877 + 2877; x2878 + 2878; x2879 + 2879; x2880 + 2880; x2881 + 2881; x2882 + 2882; x2883 + 2883; x2884 + 2884; x2885 + 2885; x2886 + 2886; x2887 + 2887; x2888 + 2888; x2889 + 2889; x2890 + 2890; x2891 + 2891; x2892 + 2892; x2893 + 2893; x2894 + 2894; x2895 + 2895; x2896 + 2896; x2897 + 2897; x2898 + 2898; x2899 + 2899; x2900 + 2900; x2901 + 2901; x2902 + 2902; x2903 + 2903; x2904 + 2904; x2905 + 2905; x2906 + 2906; x2907 + 2907; x2908 + 2908; x2909 + 2909; x2910 + 2910; x2911 + 2911; x2912 + 2912; x2913 + 2913; x2914 + 2914; x2915 + 2915; x2916 + 2916; x2917 + 2917; x2918 + 2918; x2919 + 2919; x2920 + 2920; x2921 + 2921; x2922 + 2922; x2923 + 2923; x2924 + 2924; x2925 + 2925; x2926 + 2926; x2927 + 2927; x2928 + 2928; x2929 + 2929; x2930 + 2930; x2931 + 2931; x2932 + 2932; x2933 + 2933; x2934 + 2934; x2935 + 2935; x2936 + 2936; x2937 + 2937; x2938 + 2938; x2939 + 2939; x2940 + 2940; x2941 + 2941; x2942 + 2942; x2943 + 2943; x2944 + 2944; x2945 + 2945; x2946 + 2946; x2947 + 2947; x2948 + 2948; x2949 + 2949; x2950 + 2950; x2951 + 2951; x2952 + 2952; x2953 + 2953; x2954 + 2954; x2955 + 2955; x2956 + 2956; x2957 + 2957; x2958 + 2958; x2959 + 2959; x2960 + 2960; x2961 + 2961; x2962 + 2962; x2963 + 2963; x2964 + 2964; x2965 + 2965; x2966 + 2966; x2967 + 2967; x2968 + 2968; x2969 + 2969; x2970 + 2970; x2971 + 2971; x2972 + 2972; x2973 + 2973; x2974 + 2974; x2975 + 2975; x2976 + 2976; x2977 + 2977; x2978 + 2978; x2979 + 2979; x2980 + 2980; x2981 + 2981; x2982 + 2982; x2983 + 2983; x2984 + 2984; x2985 + 2985; x2986 + 2986; x2987 + 2987; x2988 + 2988; x2989 + 2989; x2990 + 2990; x2991 + 2991; x2992 + 2992; x2993 + 2993; x2994 + 2994; x2995 + 2995; x2996 + 2996; x2997 + 2997; x2998 + 2998; x2999 + 2999]
+
+let deep =
+[ f0
+ ( f1
+  ( f2
+   [ f3
+    ( f4
+     ( f5
+      [ f6
+       ( f7
+        ( f8
+         [ f9
+          ( f10
+           ( f11
+            [ f12
+             ( f13
+              ( f14
+               [ f15
+                ( f16
+                 ( f17
+                  [ f18
+                   ( f19
+                    ( f20
+                     [ f21
+                      ( f22
+                       ( f23
+                        [ f24
+                         ( f25
+                          ( f26
+                           [ f27
+                            ( f28
+                             ( f29
+                              [ f30
+                               ( f31
+                                ( f32
+                                 [ f33
+                                  ( f34
+                                   ( f35
+                                    [ f36
+                                     ( f37
+                                      ( f38
+                                       [ f39
+( f40
+ ( f41
+  [ f42
+   ( f43
+    ( f44
+     [ f45
+      ( f46
+       ( f47
+        [ f48
+         ( f49
+          ( f50
+           [ f51
+            ( f52
+             ( f53
+              [ f54
+               ( f55
+                ( f56
+                 [ f57
+                  ( f58
+                   ( f59
+                    [ f60
+                     ( f61
+                      ( f62
+                       [ f63
+                        ( f64
+                         ( f65
+                          [ f66
+                           ( f67
+                            ( f68
+                             [ f69
+                              ( f70
+                               ( f71
+                                [ f72
+                                 ( f73
+                                  ( f74
+                                   [ f75
+                                    ( f76
+                                     ( f77
+                                      [ f78
+                                       ( f79
+( f80
+ [ f81
+  ( f82
+   ( f83
+    [ f84
+     ( f85
+      ( f86
+       [ f87
+        ( f88
+         ( f89
+          [ f90
+           ( f91
+            ( f92
+             [ f93
+              ( f94
+               ( f95
+                [ f96
+                 ( f97
+                  ( f98
+                   [ f99
+                    ( f100
+                     ( f101
+                      [ f102
+                       ( f103
+                        ( f104
+                         [ f105
+                          ( f106
+                           ( f107
+                            [ f108
+                             ( f109
+                              ( f110
+                               [ f111
+                                ( f112
+                                 ( f113
+                                  [ f114
+                                   ( f115
+                                    ( f116
+                                     [ f117
+                                      ( f118
+                                       ( f119
+[ f120
+ ( f121
+  ( f122
+   [ f123
+    ( f124
+     ( f125
+      [ f126
+       ( f127
+        ( f128
+         [ f129
+          ( f130
+           ( f131
+            [ f132
+             ( f133
+              ( f134
+               [ f135
+                ( f136
+                 ( f137
+                  [ f138
+                   ( f139
+                    ( f140
+                     [ f141
+                      ( f142
+                       ( f143
+                        [ f144
+                         ( f145
+                          ( f146
+                           [ f147
+                            ( f148
+                             ( f149
+                              [ f150
+                               ( f151
+                                ( f152
+                                 [ f153
+                                  ( f154
+                                   ( f155
+                                    [ f156
+                                     ( f157
+                                      ( f158
+                                       [ f159
+( f160
+ ( f161
+  [ f162
+   ( f163
+    ( f164
+     [ f165
+      ( f166
+       ( f167
+        [ f168
+         ( f169
+          ( f170
+           [ f171
+            ( f172
+             ( f173
+              [ f174
+               ( f175
+                ( f176
+                 [ f177
+                  ( f178
+                   ( f179
+                    [ f180
+                     ( f181
+                      ( f182
+                       [ f183
+                        ( f184
+                         ( f185
+                          [ f186
+                           ( f187
+                            ( f188
+                             [ f189
+                              ( f190
+                               ( f191
+                                [ f192
+                                 ( f193
+                                  ( f194
+                                   [ f195
+                                    ( f196
+                                     ( f197
+                                      [ f198
+                                       ( f199
+( f200
+ [ f201
+  ( f202
+   ( f203
+    [ f204
+     ( f205
+      ( f206
+       [ f207
+        ( f208
+         ( f209
+          [ f210
+           ( f211
+            ( f212
+             [ f213
+              ( f214
+               ( f215
+                [ f216
+                 ( f217
+                  ( f218
+                   [ f219
+                    ( f220
+                     ( f221
+                      [ f222
+                       ( f223
+                        ( f224
+                         [ f225
+                          ( f226
+                           ( f227
+                            [ f228
+                             ( f229
+                              ( f230
+                               [ f231
+                                ( f232
+                                 ( f233
+                                  [ f234
+                                   ( f235
+                                    ( f236
+                                     [ f237
+                                      ( f238
+                                       ( f239
+[ f240
+ ( f241
+  ( f242
+   [ f243
+    ( f244
+     ( f245
+      [ f246
+       ( f247
+        ( f248
+         [ f249
+          ( f250
+           ( f251
+            [ f252
+             ( f253
+              ( f254
+               [ f255
+                ( f256
+                 ( f257
+                  [ f258
+                   ( f259
+                    ( f260
+                     [ f261
+                      ( f262
+                       ( f263
+                        [ f264
+                         ( f265
+                          ( f266
+                           [ f267
+                            ( f268
+                             ( f269
+                              [ f270
+                               ( f271
+                                ( f272
+                                 [ f273
+                                  ( f274
+                                   ( f275
+                                    [ f276
+                                     ( f277
+                                      ( f278
+                                       [ f279
+( f280
+ ( f281
+  [ f282
+   ( f283
+    ( f284
+     [ f285
+      ( f286
+       ( f287
+        [ f288
+         ( f289
+          ( f290
+           [ f291
+            ( f292
+             ( f293
+              [ f294
+               ( f295
+                ( f296
+                 [ f297
+                  ( f298
+                   ( f299
+                    [ f300
+                     ( f301
+                      ( f302
+                       [ f303
+                        ( f304
+                         ( f305
+                          [ f306
+                           ( f307
+                            ( f308
+                             [ f309
+                              ( f310
+                               ( f311
+                                [ f312
+                                 ( f313
+                                  ( f314
+                                   [ f315
+                                    ( f316
+                                     ( f317
+                                      [ f318
+                                       ( f319
+( f320
+ [ f321
+  ( f322
+   ( f323
+    [ f324
+     ( f325
+      ( f326
+       [ f327
+        ( f328
+         ( f329
+          [ f330
+           ( f331
+            ( f332
+             [ f333
+              ( f334
+               ( f335
+                [ f336
+                 ( f337
+                  ( f338
+                   [ f339
+                    ( f340
+                     ( f341
+                      [ f342
+                       ( f343
+                        ( f344
+                         [ f345
+                          ( f346
+                           ( f347
+                            [ f348
+                             ( f349
+                              ( f350
+                               [ f351
+                                ( f352
+                                 ( f353
+                                  [ f354
+                                   ( f355
+                                    ( f356
+                                     [ f357
+                                      ( f358
+                                       ( f359
+[ f360
+ ( f361
+  ( f362
+   [ f363
+    ( f364
+     ( f365
+      [ f366
+       ( f367
+        ( f368
+         [ f369
+          ( f370
+           ( f371
+            [ f372
+             ( f373
+              ( f374
+               [ f375
+                ( f376
+                 ( f377
+                  [ f378
+                   ( f379
+                    ( f380
+                     [ f381
+                      ( f382
+                       ( f383
+                        [ f384
+                         ( f385
+                          ( f386
+                           [ f387
+                            ( f388
+                             ( f389
+                              [ f390
+                               ( f391
+                                ( f392
+                                 [ f393
+                                  ( f394
+                                   ( f395
+                                    [ f396
+                                     ( f397
+                                      ( f398
+                                       [ f399
+                                       ]
+                                      )
+                                     )
+                                    ]
+                                   )
+                                  )
+                                 ]
+                                )
+                               )
+                              ]
+                             )
+                            )
+                           ]
+                          )
+                         )
+                        ]
+                       )
+                      )
+                     ]
+                    )
+                   )
+                  ]
+                 )
+                )
+               ]
+              )
+             )
+            ]
+           )
+          )
+         ]
+        )
+       )
+      ]
+     )
+    )
+   ]
+  )
+ )
+]
+                                       )
+                                      )
+                                     ]
+                                    )
+                                   )
+                                  ]
+                                 )
+                                )
+                               ]
+                              )
+                             )
+                            ]
+                           )
+                          )
+                         ]
+                        )
+                       )
+                      ]
+                     )
+                    )
+                   ]
+                  )
+                 )
+                ]
+               )
+              )
+             ]
+            )
+           )
+          ]
+         )
+        )
+       ]
+      )
+     )
+    ]
+   )
+  )
+ ]
+)
+                                       )
+                                      ]
+                                     )
+                                    )
+                                   ]
+                                  )
+                                 )
+                                ]
+                               )
+                              )
+                             ]
+                            )
+                           )
+                          ]
+                         )
+                        )
+                       ]
+                      )
+                     )
+                    ]
+                   )
+                  )
+                 ]
+                )
+               )
+              ]
+             )
+            )
+           ]
+          )
+         )
+        ]
+       )
+      )
+     ]
+    )
+   )
+  ]
+ )
+)
+                                       ]
+                                      )
+                                     )
+                                    ]
+                                   )
+                                  )
+                                 ]
+                                )
+                               )
+                              ]
+                             )
+                            )
+                           ]
+                          )
+                         )
+                        ]
+                       )
+                      )
+                     ]
+                    )
+                   )
+                  ]
+                 )
+                )
+               ]
+              )
+             )
+            ]
+           )
+          )
+         ]
+        )
+       )
+      ]
+     )
+    )
+   ]
+  )
+ )
+]
+                                       )
+                                      )
+                                     ]
+                                    )
+                                   )
+                                  ]
+                                 )
+                                )
+                               ]
+                              )
+                             )
+                            ]
+                           )
+                          )
+                         ]
+                        )
+                       )
+                      ]
+                     )
+                    )
+                   ]
+                  )
+                 )
+                ]
+               )
+              )
+             ]
+            )
+           )
+          ]
+         )
+        )
+       ]
+      )
+     )
+    ]
+   )
+  )
+ ]
+)
+                                       )
+                                      ]
+                                     )
+                                    )
+                                   ]
+                                  )
+                                 )
+                                ]
+                               )
+                              )
+                             ]
+                            )
+                           )
+                          ]
+                         )
+                        )
+                       ]
+                      )
+                     )
+                    ]
+                   )
+                  )
+                 ]
+                )
+               )
+              ]
+             )
+            )
+           ]
+          )
+         )
+        ]
+       )
+      )
+     ]
+    )
+   )
+  ]
+ )
+)
+                                       ]
+                                      )
+                                     )
+                                    ]
+                                   )
+                                  )
+                                 ]
+                                )
+                               )
+                              ]
+                             )
+                            )
+                           ]
+                          )
+                         )
+                        ]
+                       )
+                      )
+                     ]
+                    )
+                   )
+                  ]
+                 )
+                )
+               ]
+              )
+             )
+            ]
+           )
+          )
+         ]
+        )
+       )
+      ]
+     )
+    )
+   ]
+  )
+ )
+]
+                                       )
+                                      )
+                                     ]
+                                    )
+                                   )
+                                  ]
+                                 )
+                                )
+                               ]
+                              )
+                             )
+                            ]
+                           )
+                          )
+                         ]
+                        )
+                       )
+                      ]
+                     )
+                    )
+                   ]
+                  )
+                 )
+                ]
+               )
+              )
+             ]
+            )
+           )
+          ]
+         )
+        )
+       ]
+      )
+     )
+    ]
+   )
+  )
+ ]
+)
+                                       )
+                                      ]
+                                     )
+                                    )
+                                   ]
+                                  )
+                                 )
+                                ]
+                               )
+                              )
+                             ]
+                            )
+                           )
+                          ]
+                         )
+                        )
+                       ]
+                      )
+                     )
+                    ]
+                   )
+                  )
+                 ]
+                )
+               )
+              ]
+             )
+            )
+           ]
+          )
+         )
+        ]
+       )
+      )
+     ]
+    )
+   )
+  ]
+ )
+)
+                                       ]
+                                      )
+                                     )
+                                    ]
+                                   )
+                                  )
+                                 ]
+                                )
+                               )
+                              ]
+                             )
+                            )
+                           ]
+                          )
+                         )
+                        ]
+                       )
+                      )
+                     ]
+                    )
+                   )
+                  ]
+                 )
+                )
+               ]
+              )
+             )
+            ]
+           )
+          )
+         ]
+        )
+       )
+      ]
+     )
+    )
+   ]
+  )
+ )
+]
+
+(* level 0
+  (* level 1 with "a string \" inside" and 'q' *)
+    (* level 2 opens
+      (* level 3 with "a string \" inside" and 'q' *)
+        (* level 4 opens
+          (* level 5 with "a string \" inside" and 'q' *)
+            (* level 6 opens
+              (* level 7 with "a string \" inside" and 'q' *)
+                (* level 8 opens
+                  (* level 9 with "a string \" inside" and 'q' *)
+(* level 10 opens
+  (* level 11 with "a string \" inside" and 'q' *)
+    (* level 12 opens
+      (* level 13 with "a string \" inside" and 'q' *)
+        (* level 14 opens
+          (* level 15 with "a string \" inside" and 'q' *)
+            (* level 16 opens
+              (* level 17 with "a string \" inside" and 'q' *)
+                (* level 18 opens
+                  (* level 19 with "a string \" inside" and 'q' *)
+(* level 20 opens
+  (* level 21 with "a string \" inside" and 'q' *)
+    (* level 22 opens
+      (* level 23 with "a string \" inside" and 'q' *)
+        (* level 24 opens
+          (* level 25 with "a string \" inside" and 'q' *)
+            (* level 26 opens
+              (* level 27 with "a string \" inside" and 'q' *)
+                (* level 28 opens
+                  (* level 29 with "a string \" inside" and 'q' *)
+(* level 30 opens
+  (* level 31 with "a string \" inside" and 'q' *)
+    (* level 32 opens
+      (* level 33 with "a string \" inside" and 'q' *)
+        (* level 34 opens
+          (* level 35 with "a string \" inside" and 'q' *)
+            (* level 36 opens
+              (* level 37 with "a string \" inside" and 'q' *)
+                (* level 38 opens
+                  (* level 39 with "a string \" inside" and 'q' *)
+(* level 40 opens
+  (* level 41 with "a string \" inside" and 'q' *)
+    (* level 42 opens
+      (* level 43 with "a string \" inside" and 'q' *)
+        (* level 44 opens
+          (* level 45 with "a string \" inside" and 'q' *)
+            (* level 46 opens
+              (* level 47 with "a string \" inside" and 'q' *)
+                (* level 48 opens
+                  (* level 49 with "a string \" inside" and 'q' *)
+(* level 50 opens
+  (* level 51 with "a string \" inside" and 'q' *)
+    (* level 52 opens
+      (* level 53 with "a string \" inside" and 'q' *)
+        (* level 54 opens
+          (* level 55 with "a string \" inside" and 'q' *)
+            (* level 56 opens
+              (* level 57 with "a string \" inside" and 'q' *)
+                (* level 58 opens
+                  (* level 59 with "a string \" inside" and 'q' *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+   closing *)
+ *)
+
+let text = "line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) \
+  line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) line with \"escapes\" \t \\ and (* no comment *) "
+
+let q0 = {id0|{|} |id1} " (* |}|id0}
+let q1 = {id1|{|} |id2} " (* |}|id1}
+let q2 = {id2|{|} |id3} " (* |}|id2}
+let q3 = {id3|{|} |id4} " (* |}|id3}
+let q4 = {id4|{|} |id5} " (* |}|id4}
+let q5 = {id5|{|} |id6} " (* |}|id5}
+let q6 = {id6|{|} |id0} " (* |}|id6}
+let q7 = {id0|{|} |id1} " (* |}|id0}
+let q8 = {id1|{|} |id2} " (* |}|id1}
+let q9 = {id2|{|} |id3} " (* |}|id2}
+let q10 = {id3|{|} |id4} " (* |}|id3}
+let q11 = {id4|{|} |id5} " (* |}|id4}
+let q12 = {id5|{|} |id6} " (* |}|id5}
+let q13 = {id6|{|} |id0} " (* |}|id6}
+let q14 = {id0|{|} |id1} " (* |}|id0}
+let q15 = {id1|{|} |id2} " (* |}|id1}
+let q16 = {id2|{|} |id3} " (* |}|id2}
+let q17 = {id3|{|} |id4} " (* |}|id3}
+let q18 = {id4|{|} |id5} " (* |}|id4}
+let q19 = {id5|{|} |id6} " (* |}|id5}
+let q20 = {id6|{|} |id0} " (* |}|id6}
+let q21 = {id0|{|} |id1} " (* |}|id0}
+let q22 = {id1|{|} |id2} " (* |}|id1}
+let q23 = {id2|{|} |id3} " (* |}|id2}
+let q24 = {id3|{|} |id4} " (* |}|id3}
+let q25 = {id4|{|} |id5} " (* |}|id4}
+let q26 = {id5|{|} |id6} " (* |}|id5}
+let q27 = {id6|{|} |id0} " (* |}|id6}
+let q28 = {id0|{|} |id1} " (* |}|id0}
+let q29 = {id1|{|} |id2} " (* |}|id1}
+let q30 = {id2|{|} |id3} " (* |}|id2}
+let q31 = {id3|{|} |id4} " (* |}|id3}
+let q32 = {id4|{|} |id5} " (* |}|id4}
+let q33 = {id5|{|} |id6} " (* |}|id5}
+let q34 = {id6|{|} |id0} " (* |}|id6}
+let q35 = {id0|{|} |id1} " (* |}|id0}
+let q36 = {id1|{|} |id2} " (* |}|id1}
+let q37 = {id2|{|} |id3} " (* |}|id2}
+let q38 = {id3|{|} |id4} " (* |}|id3}
+let q39 = {id4|{|} |id5} " (* |}|id4}
+let q40 = {id5|{|} |id6} " (* |}|id5}
+let q41 = {id6|{|} |id0} " (* |}|id6}
+let q42 = {id0|{|} |id1} " (* |}|id0}
+let q43 = {id1|{|} |id2} " (* |}|id1}
+let q44 = {id2|{|} |id3} " (* |}|id2}
+let q45 = {id3|{|} |id4} " (* |}|id3}
+let q46 = {id4|{|} |id5} " (* |}|id4}
+let q47 = {id5|{|} |id6} " (* |}|id5}
+let q48 = {id6|{|} |id0} " (* |}|id6}
+let q49 = {id0|{|} |id1} " (* |}|id0}
+let q50 = {id1|{|} |id2} " (* |}|id1}
+let q51 = {id2|{|} |id3} " (* |}|id2}
+let q52 = {id3|{|} |id4} " (* |}|id3}
+let q53 = {id4|{|} |id5} " (* |}|id4}
+let q54 = {id5|{|} |id6} " (* |}|id5}
+let q55 = {id6|{|} |id0} " (* |}|id6}
+let q56 = {id0|{|} |id1} " (* |}|id0}
+let q57 = {id1|{|} |id2} " (* |}|id1}
+let q58 = {id2|{|} |id3} " (* |}|id2}
+let q59 = {id3|{|} |id4} " (* |}|id3}
+let q60 = {id4|{|} |id5} " (* |}|id4}
+let q61 = {id5|{|} |id6} " (* |}|id5}
+let q62 = {id6|{|} |id0} " (* |}|id6}
+let q63 = {id0|{|} |id1} " (* |}|id0}
+let q64 = {id1|{|} |id2} " (* |}|id1}
+let q65 = {id2|{|} |id3} " (* |}|id2}
+let q66 = {id3|{|} |id4} " (* |}|id3}
+let q67 = {id4|{|} |id5} " (* |}|id4}
+let q68 = {id5|{|} |id6} " (* |}|id5}
+let q69 = {id6|{|} |id0} " (* |}|id6}
+let q70 = {id0|{|} |id1} " (* |}|id0}
+let q71 = {id1|{|} |id2} " (* |}|id1}
+let q72 = {id2|{|} |id3} " (* |}|id2}
+let q73 = {id3|{|} |id4} " (* |}|id3}
+let q74 = {id4|{|} |id5} " (* |}|id4}
+let q75 = {id5|{|} |id6} " (* |}|id5}
+let q76 = {id6|{|} |id0} " (* |}|id6}
+let q77 = {id0|{|} |id1} " (* |}|id0}
+let q78 = {id1|{|} |id2} " (* |}|id1}
+let q79 = {id2|{|} |id3} " (* |}|id2}
+let q80 = {id3|{|} |id4} " (* |}|id3}
+let q81 = {id4|{|} |id5} " (* |}|id4}
+let q82 = {id5|{|} |id6} " (* |}|id5}
+let q83 = {id6|{|} |id0} " (* |}|id6}
+let q84 = {id0|{|} |id1} " (* |}|id0}
+let q85 = {id1|{|} |id2} " (* |}|id1}
+let q86 = {id2|{|} |id3} " (* |}|id2}
+let q87 = {id3|{|} |id4} " (* |}|id3}
+let q88 = {id4|{|} |id5} " (* |}|id4}
+let q89 = {id5|{|} |id6} " (* |}|id5}
+let q90 = {id6|{|} |id0} " (* |}|id6}
+let q91 = {id0|{|} |id1} " (* |}|id0}
+let q92 = {id1|{|} |id2} " (* |}|id1}
+let q93 = {id2|{|} |id3} " (* |}|id2}
+let q94 = {id3|{|} |id4} " (* |}|id3}
+let q95 = {id4|{|} |id5} " (* |}|id4}
+let q96 = {id5|{|} |id6} " (* |}|id5}
+let q97 = {id6|{|} |id0} " (* |}|id6}
+let q98 = {id0|{|} |id1} " (* |}|id0}
+let q99 = {id1|{|} |id2} " (* |}|id1}
+let q100 = {id2|{|} |id3} " (* |}|id2}
+let q101 = {id3|{|} |id4} " (* |}|id3}
+let q102 = {id4|{|} |id5} " (* |}|id4}
+let q103 = {id5|{|} |id6} " (* |}|id5}
+let q104 = {id6|{|} |id0} " (* |}|id6}
+let q105 = {id0|{|} |id1} " (* |}|id0}
+let q106 = {id1|{|} |id2} " (* |}|id1}
+let q107 = {id2|{|} |id3} " (* |}|id2}
+let q108 = {id3|{|} |id4} " (* |}|id3}
+let q109 = {id4|{|} |id5} " (* |}|id4}
+let q110 = {id5|{|} |id6} " (* |}|id5}
+let q111 = {id6|{|} |id0} " (* |}|id6}
+let q112 = {id0|{|} |id1} " (* |}|id0}
+let q113 = {id1|{|} |id2} " (* |}|id1}
+let q114 = {id2|{|} |id3} " (* |}|id2}
+let q115 = {id3|{|} |id4} " (* |}|id3}
+let q116 = {id4|{|} |id5} " (* |}|id4}
+let q117 = {id5|{|} |id6} " (* |}|id5}
+let q118 = {id6|{|} |id0} " (* |}|id6}
+let q119 = {id0|{|} |id1} " (* |}|id0}
+let q120 = {id1|{|} |id2} " (* |}|id1}
+let q121 = {id2|{|} |id3} " (* |}|id2}
+let q122 = {id3|{|} |id4} " (* |}|id3}
+let q123 = {id4|{|} |id5} " (* |}|id4}
+let q124 = {id5|{|} |id6} " (* |}|id5}
+let q125 = {id6|{|} |id0} " (* |}|id6}
+let q126 = {id0|{|} |id1} " (* |}|id0}
+let q127 = {id1|{|} |id2} " (* |}|id1}
+let q128 = {id2|{|} |id3} " (* |}|id2}
+let q129 = {id3|{|} |id4} " (* |}|id3}
+let q130 = {id4|{|} |id5} " (* |}|id4}
+let q131 = {id5|{|} |id6} " (* |}|id5}
+let q132 = {id6|{|} |id0} " (* |}|id6}
+let q133 = {id0|{|} |id1} " (* |}|id0}
+let q134 = {id1|{|} |id2} " (* |}|id1}
+let q135 = {id2|{|} |id3} " (* |}|id2}
+let q136 = {id3|{|} |id4} " (* |}|id3}
+let q137 = {id4|{|} |id5} " (* |}|id4}
+let q138 = {id5|{|} |id6} " (* |}|id5}
+let q139 = {id6|{|} |id0} " (* |}|id6}
+let q140 = {id0|{|} |id1} " (* |}|id0}
+let q141 = {id1|{|} |id2} " (* |}|id1}
+let q142 = {id2|{|} |id3} " (* |}|id2}
+let q143 = {id3|{|} |id4} " (* |}|id3}
+let q144 = {id4|{|} |id5} " (* |}|id4}
+let q145 = {id5|{|} |id6} " (* |}|id5}
+let q146 = {id6|{|} |id0} " (* |}|id6}
+let q147 = {id0|{|} |id1} " (* |}|id0}
+let q148 = {id1|{|} |id2} " (* |}|id1}
+let q149 = {id2|{|} |id3} " (* |}|id2}
+let q150 = {id3|{|} |id4} " (* |}|id3}
+let q151 = {id4|{|} |id5} " (* |}|id4}
+let q152 = {id5|{|} |id6} " (* |}|id5}
+let q153 = {id6|{|} |id0} " (* |}|id6}
+let q154 = {id0|{|} |id1} " (* |}|id0}
+let q155 = {id1|{|} |id2} " (* |}|id1}
+let q156 = {id2|{|} |id3} " (* |}|id2}
+let q157 = {id3|{|} |id4} " (* |}|id3}
+let q158 = {id4|{|} |id5} " (* |}|id4}
+let q159 = {id5|{|} |id6} " (* |}|id5}
+let q160 = {id6|{|} |id0} " (* |}|id6}
+let q161 = {id0|{|} |id1} " (* |}|id0}
+let q162 = {id1|{|} |id2} " (* |}|id1}
+let q163 = {id2|{|} |id3} " (* |}|id2}
+let q164 = {id3|{|} |id4} " (* |}|id3}
+let q165 = {id4|{|} |id5} " (* |}|id4}
+let q166 = {id5|{|} |id6} " (* |}|id5}
+let q167 = {id6|{|} |id0} " (* |}|id6}
+let q168 = {id0|{|} |id1} " (* |}|id0}
+let q169 = {id1|{|} |id2} " (* |}|id1}
+let q170 = {id2|{|} |id3} " (* |}|id2}
+let q171 = {id3|{|} |id4} " (* |}|id3}
+let q172 = {id4|{|} |id5} " (* |}|id4}
+let q173 = {id5|{|} |id6} " (* |}|id5}
+let q174 = {id6|{|} |id0} " (* |}|id6}
+let q175 = {id0|{|} |id1} " (* |}|id0}
+let q176 = {id1|{|} |id2} " (* |}|id1}
+let q177 = {id2|{|} |id3} " (* |}|id2}
+let q178 = {id3|{|} |id4} " (* |}|id3}
+let q179 = {id4|{|} |id5} " (* |}|id4}
+let q180 = {id5|{|} |id6} " (* |}|id5}
+let q181 = {id6|{|} |id0} " (* |}|id6}
+let q182 = {id0|{|} |id1} " (* |}|id0}
+let q183 = {id1|{|} |id2} " (* |}|id1}
+let q184 = {id2|{|} |id3} " (* |}|id2}
+let q185 = {id3|{|} |id4} " (* |}|id3}
+let q186 = {id4|{|} |id5} " (* |}|id4}
+let q187 = {id5|{|} |id6} " (* |}|id5}
+let q188 = {id6|{|} |id0} " (* |}|id6}
+let q189 = {id0|{|} |id1} " (* |}|id0}
+let q190 = {id1|{|} |id2} " (* |}|id1}
+let q191 = {id2|{|} |id3} " (* |}|id2}
+let q192 = {id3|{|} |id4} " (* |}|id3}
+let q193 = {id4|{|} |id5} " (* |}|id4}
+let q194 = {id5|{|} |id6} " (* |}|id5}
+let q195 = {id6|{|} |id0} " (* |}|id6}
+let q196 = {id0|{|} |id1} " (* |}|id0}
+let q197 = {id1|{|} |id2} " (* |}|id1}
+let q198 = {id2|{|} |id3} " (* |}|id2}
+let q199 = {id3|{|} |id4} " (* |}|id3}
+
+let labels ~l0:(v0 : 'a0) ~l1:(v1 : 'a1) ~l2:(v2 : 'a2) ~l3:(v3 : 'a3) ~l4:(v4 : 'a4) ~l5:(v5 : 'a5) ~l6:(v6 : 'a6) ~l7:(v7 : 'a7) ~l8:(v8 : 'a8) ~l9:(v9 : 'a9) ~l10:(v10 : 'a10) ~l11:(v11 : 'a11) ~l12:(v12 : 'a12) ~l13:(v13 : 'a13) ~l14:(v14 : 'a14) ~l15:(v15 : 'a15) ~l16:(v16 : 'a16) ~l17:(v17 : 'a17) ~l18:(v18 : 'a18) ~l19:(v19 : 'a19) ~l20:(v20 : 'a20) ~l21:(v21 : 'a21) ~l22:(v22 : 'a22) ~l23:(v23 : 'a23) ~l24:(v24 : 'a24) ~l25:(v25 : 'a25) ~l26:(v26 : 'a0) ~l27:(v27 : 'a1) ~l28:(v28 : 'a2) ~l29:(v29 : 'a3) ~l30:(v30 : 'a4) ~l31:(v31 : 'a5) ~l32:(v32 : 'a6) ~l33:(v33 : 'a7) ~l34:(v34 : 'a8) ~l35:(v35 : 'a9) ~l36:(v36 : 'a10) ~l37:(v37 : 'a11) ~l38:(v38 : 'a12) ~l39:(v39 : 'a13) ~l40:(v40 : 'a14) ~l41:(v41 : 'a15) ~l42:(v42 : 'a16) ~l43:(v43 : 'a17) ~l44:(v44 : 'a18) ~l45:(v45 : 'a19) ~l46:(v46 : 'a20) ~l47:(v47 : 'a21) ~l48:(v48 : 'a22) ~l49:(v49 : 'a23) ~l50:(v50 : 'a24) ~l51:(v51 : 'a25) ~l52:(v52 : 'a0) ~l53:(v53 : 'a1) ~l54:(v54 : 'a2) ~l55:(v55 : 'a3) ~l56:(v56 : 'a4) ~l57:(v57 : 'a5) ~l58:(v58 : 'a6) ~l59:(v59 : 'a7) ~l60:(v60 : 'a8) ~l61:(v61 : 'a9) ~l62:(v62 : 'a10) ~l63:(v63 : 'a11) ~l64:(v64 : 'a12) ~l65:(v65 : 'a13) ~l66:(v66 : 'a14) ~l67:(v67 : 'a15) ~l68:(v68 : 'a16) ~l69:(v69 : 'a17) ~l70:(v70 : 'a18) ~l71:(v71 : 'a19) ~l72:(v72 : 'a20) ~l73:(v73 : 'a21) ~l74:(v74 : 'a22) ~l75:(v75 : 'a23) ~l76:(v76 : 'a24) ~l77:(v77 : 'a25) ~l78:(v78 : 'a0) ~l79:(v79 : 'a1) ~l80:(v80 : 'a2) ~l81:(v81 : 'a3) ~l82:(v82 : 'a4) ~l83:(v83 : 'a5) ~l84:(v84 : 'a6) ~l85:(v85 : 'a7) ~l86:(v86 : 'a8) ~l87:(v87 : 'a9) ~l88:(v88 : 'a10) ~l89:(v89 : 'a11) ~l90:(v90 : 'a12) ~l91:(v91 : 'a13) ~l92:(v92 : 'a14) ~l93:(v93 : 'a15) ~l94:(v94 : 'a16) ~l95:(v95 : 'a17) ~l96:(v96 : 'a18) ~l97:(v97 : 'a19) ~l98:(v98 : 'a20) ~l99:(v99 : 'a21) ~l100:(v100 : 'a22) ~l101:(v101 : 'a23) ~l102:(v102 : 'a24) ~l103:(v103 : 'a25) ~l104:(v104 : 'a0) ~l105:(v105 : 'a1) ~l106:(v106 : 'a2) ~l107:(v107 : 'a3) ~l108:(v108 : 'a4) ~l109:(v109 : 'a5) ~l110:(v110 : 'a6) ~l111:(v111 : 'a7) ~l112:(v112 : 'a8) ~l113:(v113 : 'a9) ~l114:(v114 : 'a10) ~l115:(v115 : 'a11) ~l116:(v116 : 'a12) ~l117:(v117 : 'a13) ~l118:(v118 : 'a14) ~l119:(v119 : 'a15) ~l120:(v120 : 'a16) ~l121:(v121 : 'a17) ~l122:(v122 : 'a18) ~l123:(v123 : 'a19) ~l124:(v124 : 'a20) ~l125:(v125 : 'a21) ~l126:(v126 : 'a22) ~l127:(v127 : 'a23) ~l128:(v128 : 'a24) ~l129:(v129 : 'a25) ~l130:(v130 : 'a0) ~l131:(v131 : 'a1) ~l132:(v132 : 'a2) ~l133:(v133 : 'a3) ~l134:(v134 : 'a4) ~l135:(v135 : 'a5) ~l136:(v136 : 'a6) ~l137:(v137 : 'a7) ~l138:(v138 : 'a8) ~l139:(v139 : 'a9) ~l140:(v140 : 'a10) ~l141:(v141 : 'a11) ~l142:(v142 : 'a12) ~l143:(v143 : 'a13) ~l144:(v144 : 'a14) ~l145:(v145 : 'a15) ~l146:(v146 : 'a16) ~l147:(v147 : 'a17) ~l148:(v148 : 'a18) ~l149:(v149 : 'a19) ~l150:(v150 : 'a20) ~l151:(v151 : 'a21) ~l152:(v152 : 'a22) ~l153:(v153 : 'a23) ~l154:(v154 : 'a24) ~l155:(v155 : 'a25) ~l156:(v156 : 'a0) ~l157:(v157 : 'a1) ~l158:(v158 : 'a2) ~l159:(v159 : 'a3) ~l160:(v160 : 'a4) ~l161:(v161 : 'a5) ~l162:(v162 : 'a6) ~l163:(v163 : 'a7) ~l164:(v164 : 'a8) ~l165:(v165 : 'a9) ~l166:(v166 : 'a10) ~l167:(v167 : 'a11) ~l168:(v168 : 'a12) ~l169:(v169 : 'a13) ~l170:(v170 : 'a14) ~l171:(v171 : 'a15) ~l172:(v172 : 'a16) ~l173:(v173 : 'a17) ~l174:(v174 : 'a18) ~l175:(v175 : 'a19) ~l176:(v176 : 'a20) ~l177:(v177 : 'a21) ~l178:(v178 : 'a22) ~l179:(v179 : 'a23) ~l180:(v180 : 'a24) ~l181:(v181 : 'a25) ~l182:(v182 : 'a0) ~l183:(v183 : 'a1) ~l184:(v184 : 'a2) ~l185:(v185 : 'a3) ~l186:(v186 : 'a4) ~l187:(v187 : 'a5) ~l188:(v188 : 'a6) ~l189:(v189 : 'a7) ~l190:(v190 : 'a8) ~l191:(v191 : 'a9) ~l192:(v192 : 'a10) ~l193:(v193 : 'a11) ~l194:(v194 : 'a12) ~l195:(v195 : 'a13) ~l196:(v196 : 'a14) ~l197:(v197 : 'a15) ~l198:(v198 : 'a16) ~l199:(v199 : 'a17) ~l200:(v200 : 'a18) ~l201:(v201 : 'a19) ~l202:(v202 : 'a20) ~l203:(v203 : 'a21) ~l204:(v204 : 'a22) ~l205:(v205 : 'a23) ~l206:(v206 : 'a24) ~l207:(v207 : 'a25) ~l208:(v208 : 'a0) ~l209:(v209 : 'a1) ~l210:(v210 : 'a2) ~l211:(v211 : 'a3) ~l212:(v212 : 'a4) ~l213:(v213 : 'a5) ~l214:(v214 : 'a6) ~l215:(v215 : 'a7) ~l216:(v216 : 'a8) ~l217:(v217 : 'a9) ~l218:(v218 : 'a10) ~l219:(v219 : 'a11) ~l220:(v220 : 'a12) ~l221:(v221 : 'a13) ~l222:(v222 : 'a14) ~l223:(v223 : 'a15) ~l224:(v224 : 'a16) ~l225:(v225 : 'a17) ~l226:(v226 : 'a18) ~l227:(v227 : 'a19) ~l228:(v228 : 'a20) ~l229:(v229 : 'a21) ~l230:(v230 : 'a22) ~l231:(v231 : 'a23) ~l232:(v232 : 'a24) ~l233:(v233 : 'a25) ~l234:(v234 : 'a0) ~l235:(v235 : 'a1) ~l236:(v236 : 'a2) ~l237:(v237 : 'a3) ~l238:(v238 : 'a4) ~l239:(v239 : 'a5) ~l240:(v240 : 'a6) ~l241:(v241 : 'a7) ~l242:(v242 : 'a8) ~l243:(v243 : 'a9) ~l244:(v244 : 'a10) ~l245:(v245 : 'a11) ~l246:(v246 : 'a12) ~l247:(v247 : 'a13) ~l248:(v248 : 'a14) ~l249:(v249 : 'a15) ~l250:(v250 : 'a16) ~l251:(v251 : 'a17) ~l252:(v252 : 'a18) ~l253:(v253 : 'a19) ~l254:(v254 : 'a20) ~l255:(v255 : 'a21) ~l256:(v256 : 'a22) ~l257:(v257 : 'a23) ~l258:(v258 : 'a24) ~l259:(v259 : 'a25) ~l260:(v260 : 'a0) ~l261:(v261 : 'a1) ~l262:(v262 : 'a2) ~l263:(v263 : 'a3) ~l264:(v264 : 'a4) ~l265:(v265 : 'a5) ~l266:(v266 : 'a6) ~l267:(v267 : 'a7) ~l268:(v268 : 'a8) ~l269:(v269 : 'a9) ~l270:(v270 : 'a10) ~l271:(v271 : 'a11) ~l272:(v272 : 'a12) ~l273:(v273 : 'a13) ~l274:(v274 : 'a14) ~l275:(v275 : 'a15) ~l276:(v276 : 'a16) ~l277:(v277 : 'a17) ~l278:(v278 : 'a18) ~l279:(v279 : 'a19) ~l280:(v280 : 'a20) ~l281:(v281 : 'a21) ~l282:(v282 : 'a22) ~l283:(v283 : 'a23) ~l284:(v284 : 'a24) ~l285:(v285 : 'a25) ~l286:(v286 : 'a0) ~l287:(v287 : 'a1) ~l288:(v288 : 'a2) ~l289:(v289 : 'a3) ~l290:(v290 : 'a4) ~l291:(v291 : 'a5) ~l292:(v292 : 'a6) ~l293:(v293 : 'a7) ~l294:(v294 : 'a8) ~l295:(v295 : 'a9) ~l296:(v296 : 'a10) ~l297:(v297 : 'a11) ~l298:(v298 : 'a12) ~l299:(v299 : 'a13) ~l300:(v300 : 'a14) ~l301:(v301 : 'a15) ~l302:(v302 : 'a16) ~l303:(v303 : 'a17) ~l304:(v304 : 'a18) ~l305:(v305 : 'a19) ~l306:(v306 : 'a20) ~l307:(v307 : 'a21) ~l308:(v308 : 'a22) ~l309:(v309 : 'a23) ~l310:(v310 : 'a24) ~l311:(v311 : 'a25) ~l312:(v312 : 'a0) ~l313:(v313 : 'a1) ~l314:(v314 : 'a2) ~l315:(v315 : 'a3) ~l316:(v316 : 'a4) ~l317:(v317 : 'a5) ~l318:(v318 : 'a6) ~l319:(v319 : 'a7) ~l320:(v320 : 'a8) ~l321:(v321 : 'a9) ~l322:(v322 : 'a10) ~l323:(v323 : 'a11) ~l324:(v324 : 'a12) ~l325:(v325 : 'a13) ~l326:(v326 : 'a14) ~l327:(v327 : 'a15) ~l328:(v328 : 'a16) ~l329:(v329 : 'a17) ~l330:(v330 : 'a18) ~l331:(v331 : 'a19) ~l332:(v332 : 'a20) ~l333:(v333 : 'a21) ~l334:(v334 : 'a22) ~l335:(v335 : 'a23) ~l336:(v336 : 'a24) ~l337:(v337 : 'a25) ~l338:(v338 : 'a0) ~l339:(v339 : 'a1) ~l340:(v340 : 'a2) ~l341:(v341 : 'a3) ~l342:(v342 : 'a4) ~l343:(v343 : 'a5) ~l344:(v344 : 'a6) ~l345:(v345 : 'a7) ~l346:(v346 : 'a8) ~l347:(v347 : 'a9) ~l348:(v348 : 'a10) ~l349:(v349 : 'a11) ~l350:(v350 : 'a12) ~l351:(v351 : 'a13) ~l352:(v352 : 'a14) ~l353:(v353 : 'a15) ~l354:(v354 : 'a16) ~l355:(v355 : 'a17) ~l356:(v356 : 'a18) ~l357:(v357 : 'a19) ~l358:(v358 : 'a20) ~l359:(v359 : 'a21) ~l360:(v360 : 'a22) ~l361:(v361 : 'a23) ~l362:(v362 : 'a24) ~l363:(v363 : 'a25) ~l364:(v364 : 'a0) ~l365:(v365 : 'a1) ~l366:(v366 : 'a2) ~l367:(v367 : 'a3) ~l368:(v368 : 'a4) ~l369:(v369 : 'a5) ~l370:(v370 : 'a6) ~l371:(v371 : 'a7) ~l372:(v372 : 'a8) ~l373:(v373 : 'a9) ~l374:(v374 : 'a10) ~l375:(v375 : 'a11) ~l376:(v376 : 'a12) ~l377:(v377 : 'a13) ~l378:(v378 : 'a14) ~l379:(v379 : 'a15) ~l380:(v380 : 'a16) ~l381:(v381 : 'a17) ~l382:(v382 : 'a18) ~l383:(v383 : 'a19) ~l384:(v384 : 'a20) ~l385:(v385 : 'a21) ~l386:(v386 : 'a22) ~l387:(v387 : 'a23) ~l388:(v388 : 'a24) ~l389:(v389 : 'a25) ~l390:(v390 : 'a0) ~l391:(v391 : 'a1) ~l392:(v392 : 'a2) ~l393:(v393 : 'a3) ~l394:(v394 : 'a4) ~l395:(v395 : 'a5) ~l396:(v396 : 'a6) ~l397:(v397 : 'a7) ~l398:(v398 : 'a8) ~l399:(v399 : 'a9) ~l400:(v400 : 'a10) ~l401:(v401 : 'a11) ~l402:(v402 : 'a12) ~l403:(v403 : 'a13) ~l404:(v404 : 'a14) ~l405:(v405 : 'a15) ~l406:(v406 : 'a16) ~l407:(v407 : 'a17) ~l408:(v408 : 'a18) ~l409:(v409 : 'a19) ~l410:(v410 : 'a20) ~l411:(v411 : 'a21) ~l412:(v412 : 'a22) ~l413:(v413 : 'a23) ~l414:(v414 : 'a24) ~l415:(v415 : 'a25) ~l416:(v416 : 'a0) ~l417:(v417 : 'a1) ~l418:(v418 : 'a2) ~l419:(v419 : 'a3) ~l420:(v420 : 'a4) ~l421:(v421 : 'a5) ~l422:(v422 : 'a6) ~l423:(v423 : 'a7) ~l424:(v424 : 'a8) ~l425:(v425 : 'a9) ~l426:(v426 : 'a10) ~l427:(v427 : 'a11) ~l428:(v428 : 'a12) ~l429:(v429 : 'a13) ~l430:(v430 : 'a14) ~l431:(v431 : 'a15) ~l432:(v432 : 'a16) ~l433:(v433 : 'a17) ~l434:(v434 : 'a18) ~l435:(v435 : 'a19) ~l436:(v436 : 'a20) ~l437:(v437 : 'a21) ~l438:(v438 : 'a22) ~l439:(v439 : 'a23) ~l440:(v440 : 'a24) ~l441:(v441 : 'a25) ~l442:(v442 : 'a0) ~l443:(v443 : 'a1) ~l444:(v444 : 'a2) ~l445:(v445 : 'a3) ~l446:(v446 : 'a4) ~l447:(v447 : 'a5) ~l448:(v448 : 'a6) ~l449:(v449 : 'a7) ~l450:(v450 : 'a8) ~l451:(v451 : 'a9) ~l452:(v452 : 'a10) ~l453:(v453 : 'a11) ~l454:(v454 : 'a12) ~l455:(v455 : 'a13) ~l456:(v456 : 'a14) ~l457:(v457 : 'a15) ~l458:(v458 : 'a16) ~l459:(v459 : 'a17) ~l460:(v460 : 'a18) ~l461:(v461 : 'a19) ~l462:(v462 : 'a20) ~l463:(v463 : 'a21) ~l464:(v464 : 'a22) ~l465:(v465 : 'a23) ~l466:(v466 : 'a24) ~l467:(v467 : 'a25) ~l468:(v468 : 'a0) ~l469:(v469 : 'a1) ~l470:(v470 : 'a2) ~l471:(v471 : 'a3) ~l472:(v472 : 'a4) ~l473:(v473 : 'a5) ~l474:(v474 : 'a6) ~l475:(v475 : 'a7) ~l476:(v476 : 'a8) ~l477:(v477 : 'a9) ~l478:(v478 : 'a10) ~l479:(v479 : 'a11) ~l480:(v480 : 'a12) ~l481:(v481 : 'a13) ~l482:(v482 : 'a14) ~l483:(v483 : 'a15) ~l484:(v484 : 'a16) ~l485:(v485 : 'a17) ~l486:(v486 : 'a18) ~l487:(v487 : 'a19) ~l488:(v488 : 'a20) ~l489:(v489 : 'a21) ~l490:(v490 : 'a22) ~l491:(v491 : 'a23) ~l492:(v492 : 'a24) ~l493:(v493 : 'a25) ~l494:(v494 : 'a0) ~l495:(v495 : 'a1) ~l496:(v496 : 'a2) ~l497:(v497 : 'a3) ~l498:(v498 : 'a4) ~l499:(v499 : 'a5) = `Done
+let variants = [`Tag_0 of_0; `Tag_1 of_1; `Tag_2 of_2; `Tag_3 of_3; `Tag_4 of_4; `Tag_5 of_5; `Tag_6 of_6; `Tag_7 of_7; `Tag_8 of_8; `Tag_9 of_9; `Tag_10 of_10; `Tag_11 of_11; `Tag_12 of_12; `Tag_13 of_13; `Tag_14 of_14; `Tag_15 of_15; `Tag_16 of_16; `Tag_17 of_17; `Tag_18 of_18; `Tag_19 of_19; `Tag_20 of_20; `Tag_21 of_21; `Tag_22 of_22; `Tag_23 of_23; `Tag_24 of_24; `Tag_25 of_25; `Tag_26 of_26; `Tag_27 of_27; `Tag_28 of_28; `Tag_29 of_29; `Tag_30 of_30; `Tag_31 of_31; `Tag_32 of_32; `Tag_33 of_33; `Tag_34 of_34; `Tag_35 of_35; `Tag_36 of_36; `Tag_37 of_37; `Tag_38 of_38; `Tag_39 of_39; `Tag_40 of_40; `Tag_41 of_41; `Tag_42 of_42; `Tag_43 of_43; `Tag_44 of_44; `Tag_45 of_45; `Tag_46 of_46; `Tag_47 of_47; `Tag_48 of_48; `Tag_49 of_49; `Tag_50 of_50; `Tag_51 of_51; `Tag_52 of_52; `Tag_53 of_53; `Tag_54 of_54; `Tag_55 of_55; `Tag_56 of_56; `Tag_57 of_57; `Tag_58 of_58; `Tag_59 of_59; `Tag_60 of_60; `Tag_61 of_61; `Tag_62 of_62; `Tag_63 of_63; `Tag_64 of_64; `Tag_65 of_65; `Tag_66 of_66; `Tag_67 of_67; `Tag_68 of_68; `Tag_69 of_69; `Tag_70 of_70; `Tag_71 of_71; `Tag_72 of_72; `Tag_73 of_73; `Tag_74 of_74; `Tag_75 of_75; `Tag_76 of_76; `Tag_77 of_77; `Tag_78 of_78; `Tag_79 of_79; `Tag_80 of_80; `Tag_81 of_81; `Tag_82 of_82; `Tag_83 of_83; `Tag_84 of_84; `Tag_85 of_85; `Tag_86 of_86; `Tag_87 of_87; `Tag_88 of_88; `Tag_89 of_89; `Tag_90 of_90; `Tag_91 of_91; `Tag_92 of_92; `Tag_93 of_93; `Tag_94 of_94; `Tag_95 of_95; `Tag_96 of_96; `Tag_97 of_97; `Tag_98 of_98; `Tag_99 of_99; `Tag_100 of_100; `Tag_101 of_101; `Tag_102 of_102; `Tag_103 of_103; `Tag_104 of_104; `Tag_105 of_105; `Tag_106 of_106; `Tag_107 of_107; `Tag_108 of_108; `Tag_109 of_109; `Tag_110 of_110; `Tag_111 of_111; `Tag_112 of_112; `Tag_113 of_113; `Tag_114 of_114; `Tag_115 of_115; `Tag_116 of_116; `Tag_117 of_117; `Tag_118 of_118; `Tag_119 of_119; `Tag_120 of_120; `Tag_121 of_121; `Tag_122 of_122; `Tag_123 of_123; `Tag_124 of_124; `Tag_125 of_125; `Tag_126 of_126; `Tag_127 of_127; `Tag_128 of_128; `Tag_129 of_129; `Tag_130 of_130; `Tag_131 of_131; `Tag_132 of_132; `Tag_133 of_133; `Tag_134 of_134; `Tag_135 of_135; `Tag_136 of_136; `Tag_137 of_137; `Tag_138 of_138; `Tag_139 of_139; `Tag_140 of_140; `Tag_141 of_141; `Tag_142 of_142; `Tag_143 of_143; `Tag_144 of_144; `Tag_145 of_145; `Tag_146 of_146; `Tag_147 of_147; `Tag_148 of_148; `Tag_149 of_149; `Tag_150 of_150; `Tag_151 of_151; `Tag_152 of_152; `Tag_153 of_153; `Tag_154 of_154; `Tag_155 of_155; `Tag_156 of_156; `Tag_157 of_157; `Tag_158 of_158; `Tag_159 of_159; `Tag_160 of_160; `Tag_161 of_161; `Tag_162 of_162; `Tag_163 of_163; `Tag_164 of_164; `Tag_165 of_165; `Tag_166 of_166; `Tag_167 of_167; `Tag_168 of_168; `Tag_169 of_169; `Tag_170 of_170; `Tag_171 of_171; `Tag_172 of_172; `Tag_173 of_173; `Tag_174 of_174; `Tag_175 of_175; `Tag_176 of_176; `Tag_177 of_177; `Tag_178 of_178; `Tag_179 of_179; `Tag_180 of_180; `Tag_181 of_181; `Tag_182 of_182; `Tag_183 of_183; `Tag_184 of_184; `Tag_185 of_185; `Tag_186 of_186; `Tag_187 of_187; `Tag_188 of_188; `Tag_189 of_189; `Tag_190 of_190; `Tag_191 of_191; `Tag_192 of_192; `Tag_193 of_193; `Tag_194 of_194; `Tag_195 of_195; `Tag_196 of_196; `Tag_197 of_197; `Tag_198 of_198; `Tag_199 of_199; `Tag_200 of_200; `Tag_201 of_201; `Tag_202 of_202; `Tag_203 of_203; `Tag_204 of_204; `Tag_205 of_205; `Tag_206 of_206; `Tag_207 of_207; `Tag_208 of_208; `Tag_209 of_209; `Tag_210 of_210; `Tag_211 of_211; `Tag_212 of_212; `Tag_213 of_213; `Tag_214 of_214; `Tag_215 of_215; `Tag_216 of_216; `Tag_217 of_217; `Tag_218 of_218; `Tag_219 of_219; `Tag_220 of_220; `Tag_221 of_221; `Tag_222 of_222; `Tag_223 of_223; `Tag_224 of_224; `Tag_225 of_225; `Tag_226 of_226; `Tag_227 of_227; `Tag_228 of_228; `Tag_229 of_229; `Tag_230 of_230; `Tag_231 of_231; `Tag_232 of_232; `Tag_233 of_233; `Tag_234 of_234; `Tag_235 of_235; `Tag_236 of_236; `Tag_237 of_237; `Tag_238 of_238; `Tag_239 of_239; `Tag_240 of_240; `Tag_241 of_241; `Tag_242 of_242; `Tag_243 of_243; `Tag_244 of_244; `Tag_245 of_245; `Tag_246 of_246; `Tag_247 of_247; `Tag_248 of_248; `Tag_249 of_249; `Tag_250 of_250; `Tag_251 of_251; `Tag_252 of_252; `Tag_253 of_253; `Tag_254 of_254; `Tag_255 of_255; `Tag_256 of_256; `Tag_257 of_257; `Tag_258 of_258; `Tag_259 of_259; `Tag_260 of_260; `Tag_261 of_261; `Tag_262 of_262; `Tag_263 of_263; `Tag_264 of_264; `Tag_265 of_265; `Tag_266 of_266; `Tag_267 of_267; `Tag_268 of_268; `Tag_269 of_269; `Tag_270 of_270; `Tag_271 of_271; `Tag_272 of_272; `Tag_273 of_273; `Tag_274 of_274; `Tag_275 of_275; `Tag_276 of_276; `Tag_277 of_277; `Tag_278 of_278; `Tag_279 of_279; `Tag_280 of_280; `Tag_281 of_281; `Tag_282 of_282; `Tag_283 of_283; `Tag_284 of_284; `Tag_285 of_285; `Tag_286 of_286; `Tag_287 of_287; `Tag_288 of_288; `Tag_289 of_289; `Tag_290 of_290; `Tag_291 of_291; `Tag_292 of_292; `Tag_293 of_293; `Tag_294 of_294; `Tag_295 of_295; `Tag_296 of_296; `Tag_297 of_297; `Tag_298 of_298; `Tag_299 of_299; `Tag_300 of_300; `Tag_301 of_301; `Tag_302 of_302; `Tag_303 of_303; `Tag_304 of_304; `Tag_305 of_305; `Tag_306 of_306; `Tag_307 of_307; `Tag_308 of_308; `Tag_309 of_309; `Tag_310 of_310; `Tag_311 of_311; `Tag_312 of_312; `Tag_313 of_313; `Tag_314 of_314; `Tag_315 of_315; `Tag_316 of_316; `Tag_317 of_317; `Tag_318 of_318; `Tag_319 of_319; `Tag_320 of_320; `Tag_321 of_321; `Tag_322 of_322; `Tag_323 of_323; `Tag_324 of_324; `Tag_325 of_325; `Tag_326 of_326; `Tag_327 of_327; `Tag_328 of_328; `Tag_329 of_329; `Tag_330 of_330; `Tag_331 of_331; `Tag_332 of_332; `Tag_333 of_333; `Tag_334 of_334; `Tag_335 of_335; `Tag_336 of_336; `Tag_337 of_337; `Tag_338 of_338; `Tag_339 of_339; `Tag_340 of_340; `Tag_341 of_341; `Tag_342 of_342; `Tag_343 of_343; `Tag_344 of_344; `Tag_345 of_345; `Tag_346 of_346; `Tag_347 of_347; `Tag_348 of_348; `Tag_349 of_349; `Tag_350 of_350; `Tag_351 of_351; `Tag_352 of_352; `Tag_353 of_353; `Tag_354 of_354; `Tag_355 of_355; `Tag_356 of_356; `Tag_357 of_357; `Tag_358 of_358; `Tag_359 of_359; `Tag_360 of_360; `Tag_361 of_361; `Tag_362 of_362; `Tag_363 of_363; `Tag_364 of_364; `Tag_365 of_365; `Tag_366 of_366; `Tag_367 of_367; `Tag_368 of_368; `Tag_369 of_369; `Tag_370 of_370; `Tag_371 of_371; `Tag_372 of_372; `Tag_373 of_373; `Tag_374 of_374; `Tag_375 of_375; `Tag_376 of_376; `Tag_377 of_377; `Tag_378 of_378; `Tag_379 of_379; `Tag_380 of_380; `Tag_381 of_381; `Tag_382 of_382; `Tag_383 of_383; `Tag_384 of_384; `Tag_385 of_385; `Tag_386 of_386; `Tag_387 of_387; `Tag_388 of_388; `Tag_389 of_389; `Tag_390 of_390; `Tag_391 of_391; `Tag_392 of_392; `Tag_393 of_393; `Tag_394 of_394; `Tag_395 of_395; `Tag_396 of_396; `Tag_397 of_397; `Tag_398 of_398; `Tag_399 of_399; `Tag_400 of_400; `Tag_401 of_401; `Tag_402 of_402; `Tag_403 of_403; `Tag_404 of_404; `Tag_405 of_405; `Tag_406 of_406; `Tag_407 of_407; `Tag_408 of_408; `Tag_409 of_409; `Tag_410 of_410; `Tag_411 of_411; `Tag_412 of_412; `Tag_413 of_413; `Tag_414 of_414; `Tag_415 of_415; `Tag_416 of_416; `Tag_417 of_417; `Tag_418 of_418; `Tag_419 of_419; `Tag_420 of_420; `Tag_421 of_421; `Tag_422 of_422; `Tag_423 of_423; `Tag_424 of_424; `Tag_425 of_425; `Tag_426 of_426; `Tag_427 of_427; `Tag_428 of_428; `Tag_429 of_429; `Tag_430 of_430; `Tag_431 of_431; `Tag_432 of_432; `Tag_433 of_433; `Tag_434 of_434; `Tag_435 of_435; `Tag_436 of_436; `Tag_437 of_437; `Tag_438 of_438; `Tag_439 of_439; `Tag_440 of_440; `Tag_441 of_441; `Tag_442 of_442; `Tag_443 of_443; `Tag_444 of_444; `Tag_445 of_445; `Tag_446 of_446; `Tag_447 of_447; `Tag_448 of_448; `Tag_449 of_449; `Tag_450 of_450; `Tag_451 of_451; `Tag_452 of_452; `Tag_453 of_453; `Tag_454 of_454; `Tag_455 of_455; `Tag_456 of_456; `Tag_457 of_457; `Tag_458 of_458; `Tag_459 of_459; `Tag_460 of_460; `Tag_461 of_461; `Tag_462 of_462; `Tag_463 of_463; `Tag_464 of_464; `Tag_465 of_465; `Tag_466 of_466; `Tag_467 of_467; `Tag_468 of_468; `Tag_469 of_469; `Tag_470 of_470; `Tag_471 of_471; `Tag_472 of_472; `Tag_473 of_473; `Tag_474 of_474; `Tag_475 of_475; `Tag_476 of_476; `Tag_477 of_477; `Tag_478 of_478; `Tag_479 of_479; `Tag_480 of_480; `Tag_481 of_481; `Tag_482 of_482; `Tag_483 of_483; `Tag_484 of_484; `Tag_485 of_485; `Tag_486 of_486; `Tag_487 of_487; `Tag_488 of_488; `Tag_489 of_489; `Tag_490 of_490; `Tag_491 of_491; `Tag_492 of_492; `Tag_493 of_493; `Tag_494 of_494; `Tag_495 of_495; `Tag_496 of_496; `Tag_497 of_497; `Tag_498 of_498; `Tag_499 of_499; `Tag_500 of_500; `Tag_501 of_501; `Tag_502 of_502; `Tag_503 of_503; `Tag_504 of_504; `Tag_505 of_505; `Tag_506 of_506; `Tag_507 of_507; `Tag_508 of_508; `Tag_509 of_509; `Tag_510 of_510; `Tag_511 of_511; `Tag_512 of_512; `Tag_513 of_513; `Tag_514 of_514; `Tag_515 of_515; `Tag_516 of_516; `Tag_517 of_517; `Tag_518 of_518; `Tag_519 of_519; `Tag_520 of_520; `Tag_521 of_521; `Tag_522 of_522; `Tag_523 of_523; `Tag_524 of_524; `Tag_525 of_525; `Tag_526 of_526; `Tag_527 of_527; `Tag_528 of_528; `Tag_529 of_529; `Tag_530 of_530; `Tag_531 of_531; `Tag_532 of_532; `Tag_533 of_533; `Tag_534 of_534; `Tag_535 of_535; `Tag_536 of_536; `Tag_537 of_537; `Tag_538 of_538; `Tag_539 of_539; `Tag_540 of_540; `Tag_541 of_541; `Tag_542 of_542; `Tag_543 of_543; `Tag_544 of_544; `Tag_545 of_545; `Tag_546 of_546; `Tag_547 of_547; `Tag_548 of_548; `Tag_549 of_549; `Tag_550 of_550; `Tag_551 of_551; `Tag_552 of_552; `Tag_553 of_553; `Tag_554 of_554; `Tag_555 of_555; `Tag_556 of_556; `Tag_557 of_557; `Tag_558 of_558; `Tag_559 of_559; `Tag_560 of_560; `Tag_561 of_561; `Tag_562 of_562; `Tag_563 of_563; `Tag_564 of_564; `Tag_565 of_565; `Tag_566 of_566; `Tag_567 of_567; `Tag_568 of_568; `Tag_569 of_569; `Tag_570 of_570; `Tag_571 of_571; `Tag_572 of_572; `Tag_573 of_573; `Tag_574 of_574; `Tag_575 of_575; `Tag_576 of_576; `Tag_577 of_577; `Tag_578 of_578; `Tag_579 of_579; `Tag_580 of_580; `Tag_581 of_581; `Tag_582 of_582; `Tag_583 of_583; `Tag_584 of_584; `Tag_585 of_585; `Tag_586 of_586; `Tag_587 of_587; `Tag_588 of_588; `Tag_589 of_589; `Tag_590 of_590; `Tag_591 of_591; `Tag_592 of_592; `Tag_593 of_593; `Tag_594 of_594; `Tag_595 of_595; `Tag_596 of_596; `Tag_597 of_597; `Tag_598 of_598; `Tag_599 of_599; `Tag_600 of_600; `Tag_601 of_601; `Tag_602 of_602; `Tag_603 of_603; `Tag_604 of_604; `Tag_605 of_605; `Tag_606 of_606; `Tag_607 of_607; `Tag_608 of_608; `Tag_609 of_609; `Tag_610 of_610; `Tag_611 of_611; `Tag_612 of_612; `Tag_613 of_613; `Tag_614 of_614; `Tag_615 of_615; `Tag_616 of_616; `Tag_617 of_617; `Tag_618 of_618; `Tag_619 of_619; `Tag_620 of_620; `Tag_621 of_621; `Tag_622 of_622; `Tag_623 of_623; `Tag_624 of_624; `Tag_625 of_625; `Tag_626 of_626; `Tag_627 of_627; `Tag_628 of_628; `Tag_629 of_629; `Tag_630 of_630; `Tag_631 of_631; `Tag_632 of_632; `Tag_633 of_633; `Tag_634 of_634; `Tag_635 of_635; `Tag_636 of_636; `Tag_637 of_637; `Tag_638 of_638; `Tag_639 of_639; `Tag_640 of_640; `Tag_641 of_641; `Tag_642 of_642; `Tag_643 of_643; `Tag_644 of_644; `Tag_645 of_645; `Tag_646 of_646; `Tag_647 of_647; `Tag_648 of_648; `Tag_649 of_649; `Tag_650 of_650; `Tag_651 of_651; `Tag_652 of_652; `Tag_653 of_653; `Tag_654 of_654; `Tag_655 of_655; `Tag_656 of_656; `Tag_657 of_657; `Tag_658 of_658; `Tag_659 of_659; `Tag_660 of_660; `Tag_661 of_661; `Tag_662 of_662; `Tag_663 of_663; `Tag_664 of_664; `Tag_665 of_665; `Tag_666 of_666; `Tag_667 of_667; `Tag_668 of_668; `Tag_669 of_669; `Tag_670 of_670; `Tag_671 of_671; `Tag_672 of_672; `Tag_673 of_673; `Tag_674 of_674; `Tag_675 of_675; `Tag_676 of_676; `Tag_677 of_677; `Tag_678 of_678; `Tag_679 of_679; `Tag_680 of_680; `Tag_681 of_681; `Tag_682 of_682; `Tag_683 of_683; `Tag_684 of_684; `Tag_685 of_685; `Tag_686 of_686; `Tag_687 of_687; `Tag_688 of_688; `Tag_689 of_689; `Tag_690 of_690; `Tag_691 of_691; `Tag_692 of_692; `Tag_693 of_693; `Tag_694 of_694; `Tag_695 of_695; `Tag_696 of_696; `Tag_697 of_697; `Tag_698 of_698; `Tag_699 of_699; `Tag_700 of_700; `Tag_701 of_701; `Tag_702 of_702; `Tag_703 of_703; `Tag_704 of_704; `Tag_705 of_705; `Tag_706 of_706; `Tag_707 of_707; `Tag_708 of_708; `Tag_709 of_709; `Tag_710 of_710; `Tag_711 of_711; `Tag_712 of_712; `Tag_713 of_713; `Tag_714 of_714; `Tag_715 of_715; `Tag_716 of_716; `Tag_717 of_717; `Tag_718 of_718; `Tag_719 of_719; `Tag_720 of_720; `Tag_721 of_721; `Tag_722 of_722; `Tag_723 of_723; `Tag_724 of_724; `Tag_725 of_725; `Tag_726 of_726; `Tag_727 of_727; `Tag_728 of_728; `Tag_729 of_729; `Tag_730 of_730; `Tag_731 of_731; `Tag_732 of_732; `Tag_733 of_733; `Tag_734 of_734; `Tag_735 of_735; `Tag_736 of_736; `Tag_737 of_737; `Tag_738 of_738; `Tag_739 of_739; `Tag_740 of_740; `Tag_741 of_741; `Tag_742 of_742; `Tag_743 of_743; `Tag_744 of_744; `Tag_745 of_745; `Tag_746 of_746; `Tag_747 of_747; `Tag_748 of_748; `Tag_749 of_749; `Tag_750 of_750; `Tag_751 of_751; `Tag_752 of_752; `Tag_753 of_753; `Tag_754 of_754; `Tag_755 of_755; `Tag_756 of_756; `Tag_757 of_757; `Tag_758 of_758; `Tag_759 of_759; `Tag_760 of_760; `Tag_761 of_761; `Tag_762 of_762; `Tag_763 of_763; `Tag_764 of_764; `Tag_765 of_765; `Tag_766 of_766; `Tag_767 of_767; `Tag_768 of_768; `Tag_769 of_769; `Tag_770 of_770; `Tag_771 of_771; `Tag_772 of_772; `Tag_773 of_773; `Tag_774 of_774; `Tag_775 of_775; `Tag_776 of_776; `Tag_777 of_777; `Tag_778 of_778; `Tag_779 of_779; `Tag_780 of_780; `Tag_781 of_781; `Tag_782 of_782; `Tag_783 of_783; `Tag_784 of_784; `Tag_785 of_785; `Tag_786 of_786; `Tag_787 of_787; `Tag_788 of_788; `Tag_789 of_789; `Tag_790 of_790; `Tag_791 of_791; `Tag_792 of_792; `Tag_793 of_793; `Tag_794 of_794; `Tag_795 of_795; `Tag_796 of_796; `Tag_797 of_797; `Tag_798 of_798; `Tag_799 of_799; `Tag_800 of_800; `Tag_801 of_801; `Tag_802 of_802; `Tag_803 of_803; `Tag_804 of_804; `Tag_805 of_805; `Tag_806 of_806; `Tag_807 of_807; `Tag_808 of_808; `Tag_809 of_809; `Tag_810 of_810; `Tag_811 of_811; `Tag_812 of_812; `Tag_813 of_813; `Tag_814 of_814; `Tag_815 of_815; `Tag_816 of_816; `Tag_817 of_817; `Tag_818 of_818; `Tag_819 of_819; `Tag_820 of_820; `Tag_821 of_821; `Tag_822 of_822; `Tag_823 of_823; `Tag_824 of_824; `Tag_825 of_825; `Tag_826 of_826; `Tag_827 of_827; `Tag_828 of_828; `Tag_829 of_829; `Tag_830 of_830; `Tag_831 of_831; `Tag_832 of_832; `Tag_833 of_833; `Tag_834 of_834; `Tag_835 of_835; `Tag_836 of_836; `Tag_837 of_837; `Tag_838 of_838; `Tag_839 of_839; `Tag_840 of_840; `Tag_841 of_841; `Tag_842 of_842; `Tag_843 of_843; `Tag_844 of_844; `Tag_845 of_845; `Tag_846 of_846; `Tag_847 of_847; `Tag_848 of_848; `Tag_849 of_849; `Tag_850 of_850; `Tag_851 of_851; `Tag_852 of_852; `Tag_853 of_853; `Tag_854 of_854; `Tag_855 of_855; `Tag_856 of_856; `Tag_857 of_857; `Tag_858 of_858; `Tag_859 of_859; `Tag_860 of_860; `Tag_861 of_861; `Tag_862 of_862; `Tag_863 of_863; `Tag_864 of_864; `Tag_865 of_865; `Tag_866 of_866; `Tag_867 of_867; `Tag_868 of_868; `Tag_869 of_869; `Tag_870 of_870; `Tag_871 of_871; `Tag_872 of_872; `Tag_873 of_873; `Tag_874 of_874; `Tag_875 of_875; `Tag_876 of_876; `Tag_877 of_877; `Tag_878 of_878; `Tag_879 of_879; `Tag_880 of_880; `Tag_881 of_881; `Tag_882 of_882; `Tag_883 of_883; `Tag_884 of_884; `Tag_885 of_885; `Tag_886 of_886; `Tag_887 of_887; `Tag_888 of_888; `Tag_889 of_889; `Tag_890 of_890; `Tag_891 of_891; `Tag_892 of_892; `Tag_893 of_893; `Tag_894 of_894; `Tag_895 of_895; `Tag_896 of_896; `Tag_897 of_897; `Tag_898 of_898; `Tag_899 of_899; `Tag_900 of_900; `Tag_901 of_901; `Tag_902 of_902; `Tag_903 of_903; `Tag_904 of_904; `Tag_905 of_905; `Tag_906 of_906; `Tag_907 of_907; `Tag_908 of_908; `Tag_909 of_909; `Tag_910 of_910; `Tag_911 of_911; `Tag_912 of_912; `Tag_913 of_913; `Tag_914 of_914; `Tag_915 of_915; `Tag_916 of_916; `Tag_917 of_917; `Tag_918 of_918; `Tag_919 of_919; `Tag_920 of_920; `Tag_921 of_921; `Tag_922 of_922; `Tag_923 of_923; `Tag_924 of_924; `Tag_925 of_925; `Tag_926 of_926; `Tag_927 of_927; `Tag_928 of_928; `Tag_929 of_929; `Tag_930 of_930; `Tag_931 of_931; `Tag_932 of_932; `Tag_933 of_933; `Tag_934 of_934; `Tag_935 of_935; `Tag_936 of_936; `Tag_937 of_937; `Tag_938 of_938; `Tag_939 of_939; `Tag_940 of_940; `Tag_941 of_941; `Tag_942 of_942; `Tag_943 of_943; `Tag_944 of_944; `Tag_945 of_945; `Tag_946 of_946; `Tag_947 of_947; `Tag_948 of_948; `Tag_949 of_949; `Tag_950 of_950; `Tag_951 of_951; `Tag_952 of_952; `Tag_953 of_953; `Tag_954 of_954; `Tag_955 of_955; `Tag_956 of_956; `Tag_957 of_957; `Tag_958 of_958; `Tag_959 of_959; `Tag_960 of_960; `Tag_961 of_961; `Tag_962 of_962; `Tag_963 of_963; `Tag_964 of_964; `Tag_965 of_965; `Tag_966 of_966; `Tag_967 of_967; `Tag_968 of_968; `Tag_969 of_969; `Tag_970 of_970; `Tag_971 of_971; `Tag_972 of_972; `Tag_973 of_973; `Tag_974 of_974; `Tag_975 of_975; `Tag_976 of_976; `Tag_977 of_977; `Tag_978 of_978; `Tag_979 of_979; `Tag_980 of_980; `Tag_981 of_981; `Tag_982 of_982; `Tag_983 of_983; `Tag_984 of_984; `Tag_985 of_985; `Tag_986 of_986; `Tag_987 of_987; `Tag_988 of_988; `Tag_989 of_989; `Tag_990 of_990; `Tag_991 of_991; `Tag_992 of_992; `Tag_993 of_993; `Tag_994 of_994; `Tag_995 of_995; `Tag_996 of_996; `Tag_997 of_997; `Tag_998 of_998; `Tag_999 of_999; `Tag_1000 of_1000; `Tag_1001 of_1001; `Tag_1002 of_1002; `Tag_1003 of_1003; `Tag_1004 of_1004; `Tag_1005 of_1005; `Tag_1006 of_1006; `Tag_1007 of_1007; `Tag_1008 of_1008; `Tag_1009 of_1009; `Tag_1010 of_1010; `Tag_1011 of_1011; `Tag_1012 of_1012; `Tag_1013 of_1013; `Tag_1014 of_1014; `Tag_1015 of_1015; `Tag_1016 of_1016; `Tag_1017 of_1017; `Tag_1018 of_1018; `Tag_1019 of_1019; `Tag_1020 of_1020; `Tag_1021 of_1021; `Tag_1022 of_1022; `Tag_1023 of_1023; `Tag_1024 of_1024; `Tag_1025 of_1025; `Tag_1026 of_1026; `Tag_1027 of_1027; `Tag_1028 of_1028; `Tag_1029 of_1029; `Tag_1030 of_1030; `Tag_1031 of_1031; `Tag_1032 of_1032; `Tag_1033 of_1033; `Tag_1034 of_1034; `Tag_1035 of_1035; `Tag_1036 of_1036; `Tag_1037 of_1037; `Tag_1038 of_1038; `Tag_1039 of_1039; `Tag_1040 of_1040; `Tag_1041 of_1041; `Tag_1042 of_1042; `Tag_1043 of_1043; `Tag_1044 of_1044; `Tag_1045 of_1045; `Tag_1046 of_1046; `Tag_1047 of_1047; `Tag_1048 of_1048; `Tag_1049 of_1049; `Tag_1050 of_1050; `Tag_1051 of_1051; `Tag_1052 of_1052; `Tag_1053 of_1053; `Tag_1054 of_1054; `Tag_1055 of_1055; `Tag_1056 of_1056; `Tag_1057 of_1057; `Tag_1058 of_1058; `Tag_1059 of_1059; `Tag_1060 of_1060; `Tag_1061 of_1061; `Tag_1062 of_1062; `Tag_1063 of_1063; `Tag_1064 of_1064; `Tag_1065 of_1065; `Tag_1066 of_1066; `Tag_1067 of_1067; `Tag_1068 of_1068; `Tag_1069 of_1069; `Tag_1070 of_1070; `Tag_1071 of_1071; `Tag_1072 of_1072; `Tag_1073 of_1073; `Tag_1074 of_1074; `Tag_1075 of_1075; `Tag_1076 of_1076; `Tag_1077 of_1077; `Tag_1078 of_1078; `Tag_1079 of_1079; `Tag_1080 of_1080; `Tag_1081 of_1081; `Tag_1082 of_1082; `Tag_1083 of_1083; `Tag_1084 of_1084; `Tag_1085 of_1085; `Tag_1086 of_1086; `Tag_1087 of_1087; `Tag_1088 of_1088; `Tag_1089 of_1089; `Tag_1090 of_1090; `Tag_1091 of_1091; `Tag_1092 of_1092; `Tag_1093 of_1093; `Tag_1094 of_1094; `Tag_1095 of_1095; `Tag_1096 of_1096; `Tag_1097 of_1097; `Tag_1098 of_1098; `Tag_1099 of_1099; `Tag_1100 of_1100; `Tag_1101 of_1101; `Tag_1102 of_1102; `Tag_1103 of_1103; `Tag_1104 of_1104; `Tag_1105 of_1105; `Tag_1106 of_1106; `Tag_1107 of_1107; `Tag_1108 of_1108; `Tag_1109 of_1109; `Tag_1110 of_1110; `Tag_1111 of_1111; `Tag_1112 of_1112; `Tag_1113 of_1113; `Tag_1114 of_1114; `Tag_1115 of_1115; `Tag_1116 of_1116; `Tag_1117 of_1117; `Tag_1118 of_1118; `Tag_1119 of_1119; `Tag_1120 of_1120; `Tag_1121 of_1121; `Tag_1122 of_1122; `Tag_1123 of_1123; `Tag_1124 of_1124; `Tag_1125 of_1125; `Tag_1126 of_1126; `Tag_1127 of_1127; `Tag_1128 of_1128; `Tag_1129 of_1129; `Tag_1130 of_1130; `Tag_1131 of_1131; `Tag_1132 of_1132; `Tag_1133 of_1133; `Tag_1134 of_1134; `Tag_1135 of_1135; `Tag_1136 of_1136; `Tag_1137 of_1137; `Tag_1138 of_1138; `Tag_1139 of_1139; `Tag_1140 of_1140; `Tag_1141 of_1141; `Tag_1142 of_1142; `Tag_1143 of_1143; `Tag_1144 of_1144; `Tag_1145 of_1145; `Tag_1146 of_1146; `Tag_1147 of_1147; `Tag_1148 of_1148; `Tag_1149 of_1149; `Tag_1150 of_1150; `Tag_1151 of_1151; `Tag_1152 of_1152; `Tag_1153 of_1153; `Tag_1154 of_1154; `Tag_1155 of_1155; `Tag_1156 of_1156; `Tag_1157 of_1157; `Tag_1158 of_1158; `Tag_1159 of_1159; `Tag_1160 of_1160; `Tag_1161 of_1161; `Tag_1162 of_1162; `Tag_1163 of_1163; `Tag_1164 of_1164; `Tag_1165 of_1165; `Tag_1166 of_1166; `Tag_1167 of_1167; `Tag_1168 of_1168; `Tag_1169 of_1169; `Tag_1170 of_1170; `Tag_1171 of_1171; `Tag_1172 of_1172; `Tag_1173 of_1173; `Tag_1174 of_1174; `Tag_1175 of_1175; `Tag_1176 of_1176; `Tag_1177 of_1177; `Tag_1178 of_1178; `Tag_1179 of_1179; `Tag_1180 of_1180; `Tag_1181 of_1181; `Tag_1182 of_1182; `Tag_1183 of_1183; `Tag_1184 of_1184; `Tag_1185 of_1185; `Tag_1186 of_1186; `Tag_1187 of_1187; `Tag_1188 of_1188; `Tag_1189 of_1189; `Tag_1190 of_1190; `Tag_1191 of_1191; `Tag_1192 of_1192; `Tag_1193 of_1193; `Tag_1194 of_1194; `Tag_1195 of_1195; `Tag_1196 of_1196; `Tag_1197 of_1197; `Tag_1198 of_1198; `Tag_1199 of_1199; `Tag_1200 of_1200; `Tag_1201 of_1201; `Tag_1202 of_1202; `Tag_1203 of_1203; `Tag_1204 of_1204; `Tag_1205 of_1205; `Tag_1206 of_1206; `Tag_1207 of_1207; `Tag_1208 of_1208; `Tag_1209 of_1209; `Tag_1210 of_1210; `Tag_1211 of_1211; `Tag_1212 of_1212; `Tag_1213 of_1213; `Tag_1214 of_1214; `Tag_1215 of_1215; `Tag_1216 of_1216; `Tag_1217 of_1217; `Tag_1218 of_1218; `Tag_1219 of_1219; `Tag_1220 of_1220; `Tag_1221 of_1221; `Tag_1222 of_1222; `Tag_1223 of_1223; `Tag_1224 of_1224; `Tag_1225 of_1225; `Tag_1226 of_1226; `Tag_1227 of_1227; `Tag_1228 of_1228; `Tag_1229 of_1229; `Tag_1230 of_1230; `Tag_1231 of_1231; `Tag_1232 of_1232; `Tag_1233 of_1233; `Tag_1234 of_1234; `Tag_1235 of_1235; `Tag_1236 of_1236; `Tag_1237 of_1237; `Tag_1238 of_1238; `Tag_1239 of_1239; `Tag_1240 of_1240; `Tag_1241 of_1241; `Tag_1242 of_1242; `Tag_1243 of_1243; `Tag_1244 of_1244; `Tag_1245 of_1245; `Tag_1246 of_1246; `Tag_1247 of_1247; `Tag_1248 of_1248; `Tag_1249 of_1249; `Tag_1250 of_1250; `Tag_1251 of_1251; `Tag_1252 of_1252; `Tag_1253 of_1253; `Tag_1254 of_1254; `Tag_1255 of_1255; `Tag_1256 of_1256; `Tag_1257 of_1257; `Tag_1258 of_1258; `Tag_1259 of_1259; `Tag_1260 of_1260; `Tag_1261 of_1261; `Tag_1262 of_1262; `Tag_1263 of_1263; `Tag_1264 of_1264; `Tag_1265 of_1265; `Tag_1266 of_1266; `Tag_1267 of_1267; `Tag_1268 of_1268; `Tag_1269 of_1269; `Tag_1270 of_1270; `Tag_1271 of_1271; `Tag_1272 of_1272; `Tag_1273 of_1273; `Tag_1274 of_1274; `Tag_1275 of_1275; `Tag_1276 of_1276; `Tag_1277 of_1277; `Tag_1278 of_1278; `Tag_1279 of_1279; `Tag_1280 of_1280; `Tag_1281 of_1281; `Tag_1282 of_1282; `Tag_1283 of_1283; `Tag_1284 of_1284; `Tag_1285 of_1285; `Tag_1286 of_1286; `Tag_1287 of_1287; `Tag_1288 of_1288; `Tag_1289 of_1289; `Tag_1290 of_1290; `Tag_1291 of_1291; `Tag_1292 of_1292; `Tag_1293 of_1293; `Tag_1294 of_1294; `Tag_1295 of_1295; `Tag_1296 of_1296; `Tag_1297 of_1297; `Tag_1298 of_1298; `Tag_1299 of_1299; `Tag_1300 of_1300; `Tag_1301 of_1301; `Tag_1302 of_1302; `Tag_1303 of_1303; `Tag_1304 of_1304; `Tag_1305 of_1305; `Tag_1306 of_1306; `Tag_1307 of_1307; `Tag_1308 of_1308; `Tag_1309 of_1309; `Tag_1310 of_1310; `Tag_1311 of_1311; `Tag_1312 of_1312; `Tag_1313 of_1313; `Tag_1314 of_1314; `Tag_1315 of_1315; `Tag_1316 of_1316; `Tag_1317 of_1317; `Tag_1318 of_1318; `Tag_1319 of_1319; `Tag_1320 of_1320; `Tag_1321 of_1321; `Tag_1322 of_1322; `Tag_1323 of_1323; `Tag_1324 of_1324; `Tag_1325 of_1325; `Tag_1326 of_1326; `Tag_1327 of_1327; `Tag_1328 of_1328; `Tag_1329 of_1329; `Tag_1330 of_1330; `Tag_1331 of_1331; `Tag_1332 of_1332; `Tag_1333 of_1333; `Tag_1334 of_1334; `Tag_1335 of_1335; `Tag_1336 of_1336; `Tag_1337 of_1337; `Tag_1338 of_1338; `Tag_1339 of_1339; `Tag_1340 of_1340; `Tag_1341 of_1341; `Tag_1342 of_1342; `Tag_1343 of_1343; `Tag_1344 of_1344; `Tag_1345 of_1345; `Tag_1346 of_1346; `Tag_1347 of_1347; `Tag_1348 of_1348; `Tag_1349 of_1349; `Tag_1350 of_1350; `Tag_1351 of_1351; `Tag_1352 of_1352; `Tag_1353 of_1353; `Tag_1354 of_1354; `Tag_1355 of_1355; `Tag_1356 of_1356; `Tag_1357 of_1357; `Tag_1358 of_1358; `Tag_1359 of_1359; `Tag_1360 of_1360; `Tag_1361 of_1361; `Tag_1362 of_1362; `Tag_1363 of_1363; `Tag_1364 of_1364; `Tag_1365 of_1365; `Tag_1366 of_1366; `Tag_1367 of_1367; `Tag_1368 of_1368; `Tag_1369 of_1369; `Tag_1370 of_1370; `Tag_1371 of_1371; `Tag_1372 of_1372; `Tag_1373 of_1373; `Tag_1374 of_1374; `Tag_1375 of_1375; `Tag_1376 of_1376; `Tag_1377 of_1377; `Tag_1378 of_1378; `Tag_1379 of_1379; `Tag_1380 of_1380; `Tag_1381 of_1381; `Tag_1382 of_1382; `Tag_1383 of_1383; `Tag_1384 of_1384; `Tag_1385 of_1385; `Tag_1386 of_1386; `Tag_1387 of_1387; `Tag_1388 of_1388; `Tag_1389 of_1389; `Tag_1390 of_1390; `Tag_1391 of_1391; `Tag_1392 of_1392; `Tag_1393 of_1393; `Tag_1394 of_1394; `Tag_1395 of_1395; `Tag_1396 of_1396; `Tag_1397 of_1397; `Tag_1398 of_1398; `Tag_1399 of_1399; `Tag_1400 of_1400; `Tag_1401 of_1401; `Tag_1402 of_1402; `Tag_1403 of_1403; `Tag_1404 of_1404; `Tag_1405 of_1405; `Tag_1406 of_1406; `Tag_1407 of_1407; `Tag_1408 of_1408; `Tag_1409 of_1409; `Tag_1410 of_1410; `Tag_1411 of_1411; `Tag_1412 of_1412; `Tag_1413 of_1413; `Tag_1414 of_1414; `Tag_1415 of_1415; `Tag_1416 of_1416; `Tag_1417 of_1417; `Tag_1418 of_1418; `Tag_1419 of_1419; `Tag_1420 of_1420; `Tag_1421 of_1421; `Tag_1422 of_1422; `Tag_1423 of_1423; `Tag_1424 of_1424; `Tag_1425 of_1425; `Tag_1426 of_1426; `Tag_1427 of_1427; `Tag_1428 of_1428; `Tag_1429 of_1429; `Tag_1430 of_1430; `Tag_1431 of_1431; `Tag_1432 of_1432; `Tag_1433 of_1433; `Tag_1434 of_1434; `Tag_1435 of_1435; `Tag_1436 of_1436; `Tag_1437 of_1437; `Tag_1438 of_1438; `Tag_1439 of_1439; `Tag_1440 of_1440; `Tag_1441 of_1441; `Tag_1442 of_1442; `Tag_1443 of_1443; `Tag_1444 of_1444; `Tag_1445 of_1445; `Tag_1446 of_1446; `Tag_1447 of_1447; `Tag_1448 of_1448; `Tag_1449 of_1449; `Tag_1450 of_1450; `Tag_1451 of_1451; `Tag_1452 of_1452; `Tag_1453 of_1453; `Tag_1454 of_1454; `Tag_1455 of_1455; `Tag_1456 of_1456; `Tag_1457 of_1457; `Tag_1458 of_1458; `Tag_1459 of_1459; `Tag_1460 of_1460; `Tag_1461 of_1461; `Tag_1462 of_1462; `Tag_1463 of_1463; `Tag_1464 of_1464; `Tag_1465 of_1465; `Tag_1466 of_1466; `Tag_1467 of_1467; `Tag_1468 of_1468; `Tag_1469 of_1469; `Tag_1470 of_1470; `Tag_1471 of_1471; `Tag_1472 of_1472; `Tag_1473 of_1473; `Tag_1474 of_1474; `Tag_1475 of_1475; `Tag_1476 of_1476; `Tag_1477 of_1477; `Tag_1478 of_1478; `Tag_1479 of_1479; `Tag_1480 of_1480; `Tag_1481 of_1481; `Tag_1482 of_1482; `Tag_1483 of_1483; `Tag_1484 of_1484; `Tag_1485 of_1485; `Tag_1486 of_1486; `Tag_1487 of_1487; `Tag_1488 of_1488; `Tag_1489 of_1489; `Tag_1490 of_1490; `Tag_1491 of_1491; `Tag_1492 of_1492; `Tag_1493 of_1493; `Tag_1494 of_1494; `Tag_1495 of_1495; `Tag_1496 of_1496; `Tag_1497 of_1497; `Tag_1498 of_1498; `Tag_1499 of_1499]
+
+let ( |>>= ) = ( @@ ) let ops = x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;;  x >>= y <*> z <|> !w := a.(b).{c} <- d ;; 
+
+                                                                                                                                                                                                        let pad0 = 0																																																		
+                                                                                                                                                                                                        let pad1 = 1																																																		
+                                                                                                                                                                                                        let pad2 = 2																																																		
+                                                                                                                                                                                                        let pad3 = 3																																																		
+                                                                                                                                                                                                        let pad4 = 4																																																		
+                                                                                                                                                                                                        let pad5 = 5																																																		
+                                                                                                                                                                                                        let pad6 = 6																																																		
+                                                                                                                                                                                                        let pad7 = 7																																																		
+                                                                                                                                                                                                        let pad8 = 8																																																		
+                                                                                                                                                                                                        let pad9 = 9																																																		
+                                                                                                                                                                                                        let pad10 = 10																																																		
+                                                                                                                                                                                                        let pad11 = 11																																																		
+                                                                                                                                                                                                        let pad12 = 12																																																		
+                                                                                                                                                                                                        let pad13 = 13																																																		
+                                                                                                                                                                                                        let pad14 = 14																																																		
+                                                                                                                                                                                                        let pad15 = 15																																																		
+                                                                                                                                                                                                        let pad16 = 16																																																		
+                                                                                                                                                                                                        let pad17 = 17																																																		
+                                                                                                                                                                                                        let pad18 = 18																																																		
+                                                                                                                                                                                                        let pad19 = 19																																																		
+                                                                                                                                                                                                        let pad20 = 20																																																		
+                                                                                                                                                                                                        let pad21 = 21																																																		
+                                                                                                                                                                                                        let pad22 = 22																																																		
+                                                                                                                                                                                                        let pad23 = 23																																																		
+                                                                                                                                                                                                        let pad24 = 24																																																		
+                                                                                                                                                                                                        let pad25 = 25																																																		
+                                                                                                                                                                                                        let pad26 = 26																																																		
+                                                                                                                                                                                                        let pad27 = 27																																																		
+                                                                                                                                                                                                        let pad28 = 28																																																		
+                                                                                                                                                                                                        let pad29 = 29																																																		
+                                                                                                                                                                                                        let pad30 = 30																																																		
+                                                                                                                                                                                                        let pad31 = 31																																																		
+                                                                                                                                                                                                        let pad32 = 32																																																		
+                                                                                                                                                                                                        let pad33 = 33																																																		
+                                                                                                                                                                                                        let pad34 = 34																																																		
+                                                                                                                                                                                                        let pad35 = 35																																																		
+                                                                                                                                                                                                        let pad36 = 36																																																		
+                                                                                                                                                                                                        let pad37 = 37																																																		
+                                                                                                                                                                                                        let pad38 = 38																																																		
+                                                                                                                                                                                                        let pad39 = 39																																																		
+                                                                                                                                                                                                        let pad40 = 40																																																		
+                                                                                                                                                                                                        let pad41 = 41																																																		
+                                                                                                                                                                                                        let pad42 = 42																																																		
+                                                                                                                                                                                                        let pad43 = 43																																																		
+                                                                                                                                                                                                        let pad44 = 44																																																		
+                                                                                                                                                                                                        let pad45 = 45																																																		
+                                                                                                                                                                                                        let pad46 = 46																																																		
+                                                                                                                                                                                                        let pad47 = 47																																																		
+                                                                                                                                                                                                        let pad48 = 48																																																		
+                                                                                                                                                                                                        let pad49 = 49																																																		
+                                                                                                                                                                                                        let pad50 = 50																																																		
+                                                                                                                                                                                                        let pad51 = 51																																																		
+                                                                                                                                                                                                        let pad52 = 52																																																		
+                                                                                                                                                                                                        let pad53 = 53																																																		
+                                                                                                                                                                                                        let pad54 = 54																																																		
+                                                                                                                                                                                                        let pad55 = 55																																																		
+                                                                                                                                                                                                        let pad56 = 56																																																		
+                                                                                                                                                                                                        let pad57 = 57																																																		
+                                                                                                                                                                                                        let pad58 = 58																																																		
+                                                                                                                                                                                                        let pad59 = 59																																																		
+                                                                                                                                                                                                        let pad60 = 60																																																		
+                                                                                                                                                                                                        let pad61 = 61																																																		
+                                                                                                                                                                                                        let pad62 = 62																																																		
+                                                                                                                                                                                                        let pad63 = 63																																																		
+                                                                                                                                                                                                        let pad64 = 64																																																		
+                                                                                                                                                                                                        let pad65 = 65																																																		
+                                                                                                                                                                                                        let pad66 = 66																																																		
+                                                                                                                                                                                                        let pad67 = 67																																																		
+                                                                                                                                                                                                        let pad68 = 68																																																		
+                                                                                                                                                                                                        let pad69 = 69																																																		
+                                                                                                                                                                                                        let pad70 = 70																																																		
+                                                                                                                                                                                                        let pad71 = 71																																																		
+                                                                                                                                                                                                        let pad72 = 72																																																		
+                                                                                                                                                                                                        let pad73 = 73																																																		
+                                                                                                                                                                                                        let pad74 = 74																																																		
+                                                                                                                                                                                                        let pad75 = 75																																																		
+                                                                                                                                                                                                        let pad76 = 76																																																		
+                                                                                                                                                                                                        let pad77 = 77																																																		
+                                                                                                                                                                                                        let pad78 = 78																																																		
+                                                                                                                                                                                                        let pad79 = 79																																																		
+                                                                                                                                                                                                        let pad80 = 80																																																		
+                                                                                                                                                                                                        let pad81 = 81																																																		
+                                                                                                                                                                                                        let pad82 = 82																																																		
+                                                                                                                                                                                                        let pad83 = 83																																																		
+                                                                                                                                                                                                        let pad84 = 84																																																		
+                                                                                                                                                                                                        let pad85 = 85																																																		
+                                                                                                                                                                                                        let pad86 = 86																																																		
+                                                                                                                                                                                                        let pad87 = 87																																																		
+                                                                                                                                                                                                        let pad88 = 88																																																		
+                                                                                                                                                                                                        let pad89 = 89																																																		
+                                                                                                                                                                                                        let pad90 = 90																																																		
+                                                                                                                                                                                                        let pad91 = 91																																																		
+                                                                                                                                                                                                        let pad92 = 92																																																		
+                                                                                                                                                                                                        let pad93 = 93																																																		
+                                                                                                                                                                                                        let pad94 = 94																																																		
+                                                                                                                                                                                                        let pad95 = 95																																																		
+                                                                                                                                                                                                        let pad96 = 96																																																		
+                                                                                                                                                                                                        let pad97 = 97																																																		
+                                                                                                                                                                                                        let pad98 = 98																																																		
+                                                                                                                                                                                                        let pad99 = 99																																																		
+
+let identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier_identifier = 0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff + 1_000_000.00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000e+10
+
+module M0 = struct let x = begin if true then begin 0 end else 0 end end
+module M1 = struct let x = begin if true then begin 1 end else 1 end end
+module M2 = struct let x = begin if true then begin 2 end else 2 end end
+module M3 = struct let x = begin if true then begin 3 end else 3 end end
+module M4 = struct let x = begin if true then begin 4 end else 4 end end
+module M5 = struct let x = begin if true then begin 5 end else 5 end end
+module M6 = struct let x = begin if true then begin 6 end else 6 end end
+module M7 = struct let x = begin if true then begin 7 end else 7 end end
+module M8 = struct let x = begin if true then begin 8 end else 8 end end
+module M9 = struct let x = begin if true then begin 9 end else 9 end end
+module M10 = struct let x = begin if true then begin 10 end else 10 end end
+module M11 = struct let x = begin if true then begin 11 end else 11 end end
+module M12 = struct let x = begin if true then begin 12 end else 12 end end
+module M13 = struct let x = begin if true then begin 13 end else 13 end end
+module M14 = struct let x = begin if true then begin 14 end else 14 end end
+module M15 = struct let x = begin if true then begin 15 end else 15 end end
+module M16 = struct let x = begin if true then begin 16 end else 16 end end
+module M17 = struct let x = begin if true then begin 17 end else 17 end end
+module M18 = struct let x = begin if true then begin 18 end else 18 end end
+module M19 = struct let x = begin if true then begin 19 end else 19 end end
+module M20 = struct let x = begin if true then begin 20 end else 20 end end
+module M21 = struct let x = begin if true then begin 21 end else 21 end end
+module M22 = struct let x = begin if true then begin 22 end else 22 end end
+module M23 = struct let x = begin if true then begin 23 end else 23 end end
+module M24 = struct let x = begin if true then begin 24 end else 24 end end
+module M25 = struct let x = begin if true then begin 25 end else 25 end end
+module M26 = struct let x = begin if true then begin 26 end else 26 end end
+module M27 = struct let x = begin if true then begin 27 end else 27 end end
+module M28 = struct let x = begin if true then begin 28 end else 28 end end
+module M29 = struct let x = begin if true then begin 29 end else 29 end end
+module M30 = struct let x = begin if true then begin 30 end else 30 end end
+module M31 = struct let x = begin if true then begin 31 end else 31 end end
+module M32 = struct let x = begin if true then begin 32 end else 32 end end
+module M33 = struct let x = begin if true then begin 33 end else 33 end end
+module M34 = struct let x = begin if true then begin 34 end else 34 end end
+module M35 = struct let x = begin if true then begin 35 end else 35 end end
+module M36 = struct let x = begin if true then begin 36 end else 36 end end
+module M37 = struct let x = begin if true then begin 37 end else 37 end end
+module M38 = struct let x = begin if true then begin 38 end else 38 end end
+module M39 = struct let x = begin if true then begin 39 end else 39 end end
+module M40 = struct let x = begin if true then begin 40 end else 40 end end
+module M41 = struct let x = begin if true then begin 41 end else 41 end end
+module M42 = struct let x = begin if true then begin 42 end else 42 end end
+module M43 = struct let x = begin if true then begin 43 end else 43 end end
+module M44 = struct let x = begin if true then begin 44 end else 44 end end
+module M45 = struct let x = begin if true then begin 45 end else 45 end end
+module M46 = struct let x = begin if true then begin 46 end else 46 end end
+module M47 = struct let x = begin if true then begin 47 end else 47 end end
+module M48 = struct let x = begin if true then begin 48 end else 48 end end
+module M49 = struct let x = begin if true then begin 49 end else 49 end end
+module M50 = struct let x = begin if true then begin 50 end else 50 end end
+module M51 = struct let x = begin if true then begin 51 end else 51 end end
+module M52 = struct let x = begin if true then begin 52 end else 52 end end
+module M53 = struct let x = begin if true then begin 53 end else 53 end end
+module M54 = struct let x = begin if true then begin 54 end else 54 end end
+module M55 = struct let x = begin if true then begin 55 end else 55 end end
+module M56 = struct let x = begin if true then begin 56 end else 56 end end
+module M57 = struct let x = begin if true then begin 57 end else 57 end end
+module M58 = struct let x = begin if true then begin 58 end else 58 end end
+module M59 = struct let x = begin if true then begin 59 end else 59 end end
+module M60 = struct let x = begin if true then begin 60 end else 60 end end
+module M61 = struct let x = begin if true then begin 61 end else 61 end end
+module M62 = struct let x = begin if true then begin 62 end else 62 end end
+module M63 = struct let x = begin if true then begin 63 end else 63 end end
+module M64 = struct let x = begin if true then begin 64 end else 64 end end
+module M65 = struct let x = begin if true then begin 65 end else 65 end end
+module M66 = struct let x = begin if true then begin 66 end else 66 end end
+module M67 = struct let x = begin if true then begin 67 end else 67 end end
+module M68 = struct let x = begin if true then begin 68 end else 68 end end
+module M69 = struct let x = begin if true then begin 69 end else 69 end end
+module M70 = struct let x = begin if true then begin 70 end else 70 end end
+module M71 = struct let x = begin if true then begin 71 end else 71 end end
+module M72 = struct let x = begin if true then begin 72 end else 72 end end
+module M73 = struct let x = begin if true then begin 73 end else 73 end end
+module M74 = struct let x = begin if true then begin 74 end else 74 end end
+module M75 = struct let x = begin if true then begin 75 end else 75 end end
+module M76 = struct let x = begin if true then begin 76 end else 76 end end
+module M77 = struct let x = begin if true then begin 77 end else 77 end end
+module M78 = struct let x = begin if true then begin 78 end else 78 end end
+module M79 = struct let x = begin if true then begin 79 end else 79 end end
+module M80 = struct let x = begin if true then begin 80 end else 80 end end
+module M81 = struct let x = begin if true then begin 81 end else 81 end end
+module M82 = struct let x = begin if true then begin 82 end else 82 end end
+module M83 = struct let x = begin if true then begin 83 end else 83 end end
+module M84 = struct let x = begin if true then begin 84 end else 84 end end
+module M85 = struct let x = begin if true then begin 85 end else 85 end end
+module M86 = struct let x = begin if true then begin 86 end else 86 end end
+module M87 = struct let x = begin if true then begin 87 end else 87 end end
+module M88 = struct let x = begin if true then begin 88 end else 88 end end
+module M89 = struct let x = begin if true then begin 89 end else 89 end end
+module M90 = struct let x = begin if true then begin 90 end else 90 end end
+module M91 = struct let x = begin if true then begin 91 end else 91 end end
+module M92 = struct let x = begin if true then begin 92 end else 92 end end
+module M93 = struct let x = begin if true then begin 93 end else 93 end end
+module M94 = struct let x = begin if true then begin 94 end else 94 end end
+module M95 = struct let x = begin if true then begin 95 end else 95 end end
+module M96 = struct let x = begin if true then begin 96 end else 96 end end
+module M97 = struct let x = begin if true then begin 97 end else 97 end end
+module M98 = struct let x = begin if true then begin 98 end else 98 end end
+module M99 = struct let x = begin if true then begin 99 end else 99 end end
+module M100 = struct let x = begin if true then begin 100 end else 100 end end
+module M101 = struct let x = begin if true then begin 101 end else 101 end end
+module M102 = struct let x = begin if true then begin 102 end else 102 end end
+module M103 = struct let x = begin if true then begin 103 end else 103 end end
+module M104 = struct let x = begin if true then begin 104 end else 104 end end
+module M105 = struct let x = begin if true then begin 105 end else 105 end end
+module M106 = struct let x = begin if true then begin 106 end else 106 end end
+module M107 = struct let x = begin if true then begin 107 end else 107 end end
+module M108 = struct let x = begin if true then begin 108 end else 108 end end
+module M109 = struct let x = begin if true then begin 109 end else 109 end end
+module M110 = struct let x = begin if true then begin 110 end else 110 end end
+module M111 = struct let x = begin if true then begin 111 end else 111 end end
+module M112 = struct let x = begin if true then begin 112 end else 112 end end
+module M113 = struct let x = begin if true then begin 113 end else 113 end end
+module M114 = struct let x = begin if true then begin 114 end else 114 end end
+module M115 = struct let x = begin if true then begin 115 end else 115 end end
+module M116 = struct let x = begin if true then begin 116 end else 116 end end
+module M117 = struct let x = begin if true then begin 117 end else 117 end end
+module M118 = struct let x = begin if true then begin 118 end else 118 end end
+module M119 = struct let x = begin if true then begin 119 end else 119 end end
+module M120 = struct let x = begin if true then begin 120 end else 120 end end
+module M121 = struct let x = begin if true then begin 121 end else 121 end end
+module M122 = struct let x = begin if true then begin 122 end else 122 end end
+module M123 = struct let x = begin if true then begin 123 end else 123 end end
+module M124 = struct let x = begin if true then begin 124 end else 124 end end
+module M125 = struct let x = begin if true then begin 125 end else 125 end end
+module M126 = struct let x = begin if true then begin 126 end else 126 end end
+module M127 = struct let x = begin if true then begin 127 end else 127 end end
+module M128 = struct let x = begin if true then begin 128 end else 128 end end
+module M129 = struct let x = begin if true then begin 129 end else 129 end end
+module M130 = struct let x = begin if true then begin 130 end else 130 end end
+module M131 = struct let x = begin if true then begin 131 end else 131 end end
+module M132 = struct let x = begin if true then begin 132 end else 132 end end
+module M133 = struct let x = begin if true then begin 133 end else 133 end end
+module M134 = struct let x = begin if true then begin 134 end else 134 end end
+module M135 = struct let x = begin if true then begin 135 end else 135 end end
+module M136 = struct let x = begin if true then begin 136 end else 136 end end
+module M137 = struct let x = begin if true then begin 137 end else 137 end end
+module M138 = struct let x = begin if true then begin 138 end else 138 end end
+module M139 = struct let x = begin if true then begin 139 end else 139 end end
+module M140 = struct let x = begin if true then begin 140 end else 140 end end
+module M141 = struct let x = begin if true then begin 141 end else 141 end end
+module M142 = struct let x = begin if true then begin 142 end else 142 end end
+module M143 = struct let x = begin if true then begin 143 end else 143 end end
+module M144 = struct let x = begin if true then begin 144 end else 144 end end
+module M145 = struct let x = begin if true then begin 145 end else 145 end end
+module M146 = struct let x = begin if true then begin 146 end else 146 end end
+module M147 = struct let x = begin if true then begin 147 end else 147 end end
+module M148 = struct let x = begin if true then begin 148 end else 148 end end
+module M149 = struct let x = begin if true then begin 149 end else 149 end end
+module M150 = struct let x = begin if true then begin 150 end else 150 end end
+module M151 = struct let x = begin if true then begin 151 end else 151 end end
+module M152 = struct let x = begin if true then begin 152 end else 152 end end
+module M153 = struct let x = begin if true then begin 153 end else 153 end end
+module M154 = struct let x = begin if true then begin 154 end else 154 end end
+module M155 = struct let x = begin if true then begin 155 end else 155 end end
+module M156 = struct let x = begin if true then begin 156 end else 156 end end
+module M157 = struct let x = begin if true then begin 157 end else 157 end end
+module M158 = struct let x = begin if true then begin 158 end else 158 end end
+module M159 = struct let x = begin if true then begin 159 end else 159 end end
+module M160 = struct let x = begin if true then begin 160 end else 160 end end
+module M161 = struct let x = begin if true then begin 161 end else 161 end end
+module M162 = struct let x = begin if true then begin 162 end else 162 end end
+module M163 = struct let x = begin if true then begin 163 end else 163 end end
+module M164 = struct let x = begin if true then begin 164 end else 164 end end
+module M165 = struct let x = begin if true then begin 165 end else 165 end end
+module M166 = struct let x = begin if true then begin 166 end else 166 end end
+module M167 = struct let x = begin if true then begin 167 end else 167 end end
+module M168 = struct let x = begin if true then begin 168 end else 168 end end
+module M169 = struct let x = begin if true then begin 169 end else 169 end end
+module M170 = struct let x = begin if true then begin 170 end else 170 end end
+module M171 = struct let x = begin if true then begin 171 end else 171 end end
+module M172 = struct let x = begin if true then begin 172 end else 172 end end
+module M173 = struct let x = begin if true then begin 173 end else 173 end end
+module M174 = struct let x = begin if true then begin 174 end else 174 end end
+module M175 = struct let x = begin if true then begin 175 end else 175 end end
+module M176 = struct let x = begin if true then begin 176 end else 176 end end
+module M177 = struct let x = begin if true then begin 177 end else 177 end end
+module M178 = struct let x = begin if true then begin 178 end else 178 end end
+module M179 = struct let x = begin if true then begin 179 end else 179 end end
+module M180 = struct let x = begin if true then begin 180 end else 180 end end
+module M181 = struct let x = begin if true then begin 181 end else 181 end end
+module M182 = struct let x = begin if true then begin 182 end else 182 end end
+module M183 = struct let x = begin if true then begin 183 end else 183 end end
+module M184 = struct let x = begin if true then begin 184 end else 184 end end
+module M185 = struct let x = begin if true then begin 185 end else 185 end end
+module M186 = struct let x = begin if true then begin 186 end else 186 end end
+module M187 = struct let x = begin if true then begin 187 end else 187 end end
+module M188 = struct let x = begin if true then begin 188 end else 188 end end
+module M189 = struct let x = begin if true then begin 189 end else 189 end end
+module M190 = struct let x = begin if true then begin 190 end else 190 end end
+module M191 = struct let x = begin if true then begin 191 end else 191 end end
+module M192 = struct let x = begin if true then begin 192 end else 192 end end
+module M193 = struct let x = begin if true then begin 193 end else 193 end end
+module M194 = struct let x = begin if true then begin 194 end else 194 end end
+module M195 = struct let x = begin if true then begin 195 end else 195 end end
+module M196 = struct let x = begin if true then begin 196 end else 196 end end
+module M197 = struct let x = begin if true then begin 197 end else 197 end end
+module M198 = struct let x = begin if true then begin 198 end else 198 end end
+module M199 = struct let x = begin if true then begin 199 end else 199 end end
+module M200 = struct let x = begin if true then begin 200 end else 200 end end
+module M201 = struct let x = begin if true then begin 201 end else 201 end end
+module M202 = struct let x = begin if true then begin 202 end else 202 end end
+module M203 = struct let x = begin if true then begin 203 end else 203 end end
+module M204 = struct let x = begin if true then begin 204 end else 204 end end
+module M205 = struct let x = begin if true then begin 205 end else 205 end end
+module M206 = struct let x = begin if true then begin 206 end else 206 end end
+module M207 = struct let x = begin if true then begin 207 end else 207 end end
+module M208 = struct let x = begin if true then begin 208 end else 208 end end
+module M209 = struct let x = begin if true then begin 209 end else 209 end end
+module M210 = struct let x = begin if true then begin 210 end else 210 end end
+module M211 = struct let x = begin if true then begin 211 end else 211 end end
+module M212 = struct let x = begin if true then begin 212 end else 212 end end
+module M213 = struct let x = begin if true then begin 213 end else 213 end end
+module M214 = struct let x = begin if true then begin 214 end else 214 end end
+module M215 = struct let x = begin if true then begin 215 end else 215 end end
+module M216 = struct let x = begin if true then begin 216 end else 216 end end
+module M217 = struct let x = begin if true then begin 217 end else 217 end end
+module M218 = struct let x = begin if true then begin 218 end else 218 end end
+module M219 = struct let x = begin if true then begin 219 end else 219 end end
+module M220 = struct let x = begin if true then begin 220 end else 220 end end
+module M221 = struct let x = begin if true then begin 221 end else 221 end end
+module M222 = struct let x = begin if true then begin 222 end else 222 end end
+module M223 = struct let x = begin if true then begin 223 end else 223 end end
+module M224 = struct let x = begin if true then begin 224 end else 224 end end
+module M225 = struct let x = begin if true then begin 225 end else 225 end end
+module M226 = struct let x = begin if true then begin 226 end else 226 end end
+module M227 = struct let x = begin if true then begin 227 end else 227 end end
+module M228 = struct let x = begin if true then begin 228 end else 228 end end
+module M229 = struct let x = begin if true then begin 229 end else 229 end end
+module M230 = struct let x = begin if true then begin 230 end else 230 end end
+module M231 = struct let x = begin if true then begin 231 end else 231 end end
+module M232 = struct let x = begin if true then begin 232 end else 232 end end
+module M233 = struct let x = begin if true then begin 233 end else 233 end end
+module M234 = struct let x = begin if true then begin 234 end else 234 end end
+module M235 = struct let x = begin if true then begin 235 end else 235 end end
+module M236 = struct let x = begin if true then begin 236 end else 236 end end
+module M237 = struct let x = begin if true then begin 237 end else 237 end end
+module M238 = struct let x = begin if true then begin 238 end else 238 end end
+module M239 = struct let x = begin if true then begin 239 end else 239 end end
+module M240 = struct let x = begin if true then begin 240 end else 240 end end
+module M241 = struct let x = begin if true then begin 241 end else 241 end end
+module M242 = struct let x = begin if true then begin 242 end else 242 end end
+module M243 = struct let x = begin if true then begin 243 end else 243 end end
+module M244 = struct let x = begin if true then begin 244 end else 244 end end
+module M245 = struct let x = begin if true then begin 245 end else 245 end end
+module M246 = struct let x = begin if true then begin 246 end else 246 end end
+module M247 = struct let x = begin if true then begin 247 end else 247 end end
+module M248 = struct let x = begin if true then begin 248 end else 248 end end
+module M249 = struct let x = begin if true then begin 249 end else 249 end end
+module M250 = struct let x = begin if true then begin 250 end else 250 end end
+module M251 = struct let x = begin if true then begin 251 end else 251 end end
+module M252 = struct let x = begin if true then begin 252 end else 252 end end
+module M253 = struct let x = begin if true then begin 253 end else 253 end end
+module M254 = struct let x = begin if true then begin 254 end else 254 end end
+module M255 = struct let x = begin if true then begin 255 end else 255 end end
+module M256 = struct let x = begin if true then begin 256 end else 256 end end
+module M257 = struct let x = begin if true then begin 257 end else 257 end end
+module M258 = struct let x = begin if true then begin 258 end else 258 end end
+module M259 = struct let x = begin if true then begin 259 end else 259 end end
+module M260 = struct let x = begin if true then begin 260 end else 260 end end
+module M261 = struct let x = begin if true then begin 261 end else 261 end end
+module M262 = struct let x = begin if true then begin 262 end else 262 end end
+module M263 = struct let x = begin if true then begin 263 end else 263 end end
+module M264 = struct let x = begin if true then begin 264 end else 264 end end
+module M265 = struct let x = begin if true then begin 265 end else 265 end end
+module M266 = struct let x = begin if true then begin 266 end else 266 end end
+module M267 = struct let x = begin if true then begin 267 end else 267 end end
+module M268 = struct let x = begin if true then begin 268 end else 268 end end
+module M269 = struct let x = begin if true then begin 269 end else 269 end end
+module M270 = struct let x = begin if true then begin 270 end else 270 end end
+module M271 = struct let x = begin if true then begin 271 end else 271 end end
+module M272 = struct let x = begin if true then begin 272 end else 272 end end
+module M273 = struct let x = begin if true then begin 273 end else 273 end end
+module M274 = struct let x = begin if true then begin 274 end else 274 end end
+module M275 = struct let x = begin if true then begin 275 end else 275 end end
+module M276 = struct let x = begin if true then begin 276 end else 276 end end
+module M277 = struct let x = begin if true then begin 277 end else 277 end end
+module M278 = struct let x = begin if true then begin 278 end else 278 end end
+module M279 = struct let x = begin if true then begin 279 end else 279 end end
+module M280 = struct let x = begin if true then begin 280 end else 280 end end
+module M281 = struct let x = begin if true then begin 281 end else 281 end end
+module M282 = struct let x = begin if true then begin 282 end else 282 end end
+module M283 = struct let x = begin if true then begin 283 end else 283 end end
+module M284 = struct let x = begin if true then begin 284 end else 284 end end
+module M285 = struct let x = begin if true then begin 285 end else 285 end end
+module M286 = struct let x = begin if true then begin 286 end else 286 end end
+module M287 = struct let x = begin if true then begin 287 end else 287 end end
+module M288 = struct let x = begin if true then begin 288 end else 288 end end
+module M289 = struct let x = begin if true then begin 289 end else 289 end end
+module M290 = struct let x = begin if true then begin 290 end else 290 end end
+module M291 = struct let x = begin if true then begin 291 end else 291 end end
+module M292 = struct let x = begin if true then begin 292 end else 292 end end
+module M293 = struct let x = begin if true then begin 293 end else 293 end end
+module M294 = struct let x = begin if true then begin 294 end else 294 end end
+module M295 = struct let x = begin if true then begin 295 end else 295 end end
+module M296 = struct let x = begin if true then begin 296 end else 296 end end
+module M297 = struct let x = begin if true then begin 297 end else 297 end end
+module M298 = struct let x = begin if true then begin 298 end else 298 end end
+module M299 = struct let x = begin if true then begin 299 end else 299 end end
+(* unterminated
+   line 0 "of a (* comment *) that never" ends
+   line 1 "of a (* comment *) that never" ends
+   line 2 "of a (* comment *) that never" ends
+   line 3 "of a (* comment *) that never" ends
+   line 4 "of a (* comment *) that never" ends
+   line 5 "of a (* comment *) that never" ends
+   line 6 "of a (* comment *) that never" ends
+   line 7 "of a (* comment *) that never" ends
+   line 8 "of a (* comment *) that never" ends
+   line 9 "of a (* comment *) that never" ends
+   line 10 "of a (* comment *) that never" ends
+   line 11 "of a (* comment *) that never" ends
+   line 12 "of a (* comment *) that never" ends
+   line 13 "of a (* comment *) that never" ends
+   line 14 "of a (* comment *) that never" ends
+   line 15 "of a (* comment *) that never" ends
+   line 16 "of a (* comment *) that never" ends
+   line 17 "of a (* comment *) that never" ends
+   line 18 "of a (* comment *) that never" ends
+   line 19 "of a (* comment *) that never" ends
+   line 20 "of a (* comment *) that never" ends
+   line 21 "of a (* comment *) that never" ends
+   line 22 "of a (* comment *) that never" ends
+   line 23 "of a (* comment *) that never" ends
+   line 24 "of a (* comment *) that never" ends
+   line 25 "of a (* comment *) that never" ends
+   line 26 "of a (* comment *) that never" ends
+   line 27 "of a (* comment *) that never" ends
+   line 28 "of a (* comment *) that never" ends
+   line 29 "of a (* comment *) that never" ends
+   line 30 "of a (* comment *) that never" ends
+   line 31 "of a (* comment *) that never" ends
+   line 32 "of a (* comment *) that never" ends
+   line 33 "of a (* comment *) that never" ends
+   line 34 "of a (* comment *) that never" ends
+   line 35 "of a (* comment *) that never" ends
+   line 36 "of a (* comment *) that never" ends
+   line 37 "of a (* comment *) that never" ends
+   line 38 "of a (* comment *) that never" ends
+   line 39 "of a (* comment *) that never" ends
+   line 40 "of a (* comment *) that never" ends
+   line 41 "of a (* comment *) that never" ends
+   line 42 "of a (* comment *) that never" ends
+   line 43 "of a (* comment *) that never" ends
+   line 44 "of a (* comment *) that never" ends
+   line 45 "of a (* comment *) that never" ends
+   line 46 "of a (* comment *) that never" ends
+   line 47 "of a (* comment *) that never" ends
+   line 48 "of a (* comment *) that never" ends
+   line 49 "of a (* comment *) that never" ends
+   line 50 "of a (* comment *) that never" ends
+   line 51 "of a (* comment *) that never" ends
+   line 52 "of a (* comment *) that never" ends
+   line 53 "of a (* comment *) that never" ends
+   line 54 "of a (* comment *) that never" ends
+   line 55 "of a (* comment *) that never" ends
+   line 56 "of a (* comment *) that never" ends
+   line 57 "of a (* comment *) that never" ends
+   line 58 "of a (* comment *) that never" ends
+   line 59 "of a (* comment *) that never" ends
+   line 60 "of a (* comment *) that never" ends
+   line 61 "of a (* comment *) that never" ends
+   line 62 "of a (* comment *) that never" ends
+   line 63 "of a (* comment *) that never" ends
+   line 64 "of a (* comment *) that never" ends
+   line 65 "of a (* comment *) that never" ends
+   line 66 "of a (* comment *) that never" ends
+   line 67 "of a (* comment *) that never" ends
+   line 68 "of a (* comment *) that never" ends
+   line 69 "of a (* comment *) that never" ends
+   line 70 "of a (* comment *) that never" ends
+   line 71 "of a (* comment *) that never" ends
+   line 72 "of a (* comment *) that never" ends
+   line 73 "of a (* comment *) that never" ends
+   line 74 "of a (* comment *) that never" ends
+   line 75 "of a (* comment *) that never" ends
+   line 76 "of a (* comment *) that never" ends
+   line 77 "of a (* comment *) that never" ends
+   line 78 "of a (* comment *) that never" ends
+   line 79 "of a (* comment *) that never" ends
+   line 80 "of a (* comment *) that never" ends
+   line 81 "of a (* comment *) that never" ends
+   line 82 "of a (* comment *) that never" ends
+   line 83 "of a (* comment *) that never" ends
+   line 84 "of a (* comment *) that never" ends
+   line 85 "of a (* comment *) that never" ends
+   line 86 "of a (* comment *) that never" ends
+   line 87 "of a (* comment *) that never" ends
+   line 88 "of a (* comment *) that never" ends
+   line 89 "of a (* comment *) that never" ends
+   line 90 "of a (* comment *) that never" ends
+   line 91 "of a (* comment *) that never" ends
+   line 92 "of a (* comment *) that never" ends
+   line 93 "of a (* comment *) that never" ends
+   line 94 "of a (* comment *) that never" ends
+   line 95 "of a (* comment *) that never" ends
+   line 96 "of a (* comment *) that never" ends
+   line 97 "of a (* comment *) that never" ends
+   line 98 "of a (* comment *) that never" ends
+   line 99 "of a (* comment *) that never" ends
+   line 100 "of a (* comment *) that never" ends
+   line 101 "of a (* comment *) that never" ends
+   line 102 "of a (* comment *) that never" ends
+   line 103 "of a (* comment *) that never" ends
+   line 104 "of a (* comment *) that never" ends
+   line 105 "of a (* comment *) that never" ends
+   line 106 "of a (* comment *) that never" ends
+   line 107 "of a (* comment *) that never" ends
+   line 108 "of a (* comment *) that never" ends
+   line 109 "of a (* comment *) that never" ends
+   line 110 "of a (* comment *) that never" ends
+   line 111 "of a (* comment *) that never" ends
+   line 112 "of a (* comment *) that never" ends
+   line 113 "of a (* comment *) that never" ends
+   line 114 "of a (* comment *) that never" ends
+   line 115 "of a (* comment *) that never" ends
+   line 116 "of a (* comment *) that never" ends
+   line 117 "of a (* comment *) that never" ends
+   line 118 "of a (* comment *) that never" ends
+   line 119 "of a (* comment *) that never" ends
+   line 120 "of a (* comment *) that never" ends
+   line 121 "of a (* comment *) that never" ends
+   line 122 "of a (* comment *) that never" ends
+   line 123 "of a (* comment *) that never" ends
+   line 124 "of a (* comment *) that never" ends
+   line 125 "of a (* comment *) that never" ends
+   line 126 "of a (* comment *) that never" ends
+   line 127 "of a (* comment *) that never" ends
+   line 128 "of a (* comment *) that never" ends
+   line 129 "of a (* comment *) that never" ends
+   line 130 "of a (* comment *) that never" ends
+   line 131 "of a (* comment *) that never" ends
+   line 132 "of a (* comment *) that never" ends
+   line 133 "of a (* comment *) that never" ends
+   line 134 "of a (* comment *) that never" ends
+   line 135 "of a (* comment *) that never" ends
+   line 136 "of a (* comment *) that never" ends
+   line 137 "of a (* comment *) that never" ends
+   line 138 "of a (* comment *) that never" ends
+   line 139 "of a (* comment *) that never" ends
+   line 140 "of a (* comment *) that never" ends
+   line 141 "of a (* comment *) that never" ends
+   line 142 "of a (* comment *) that never" ends
+   line 143 "of a (* comment *) that never" ends
+   line 144 "of a (* comment *) that never" ends
+   line 145 "of a (* comment *) that never" ends
+   line 146 "of a (* comment *) that never" ends
+   line 147 "of a (* comment *) that never" ends
+   line 148 "of a (* comment *) that never" ends
+   line 149 "of a (* comment *) that never" ends
+   line 150 "of a (* comment *) that never" ends
+   line 151 "of a (* comment *) that never" ends
+   line 152 "of a (* comment *) that never" ends
+   line 153 "of a (* comment *) that never" ends
+   line 154 "of a (* comment *) that never" ends
+   line 155 "of a (* comment *) that never" ends
+   line 156 "of a (* comment *) that never" ends
+   line 157 "of a (* comment *) that never" ends
+   line 158 "of a (* comment *) that never" ends
+   line 159 "of a (* comment *) that never" ends
+   line 160 "of a (* comment *) that never" ends
+   line 161 "of a (* comment *) that never" ends
+   line 162 "of a (* comment *) that never" ends
+   line 163 "of a (* comment *) that never" ends
+   line 164 "of a (* comment *) that never" ends
+   line 165 "of a (* comment *) that never" ends
+   line 166 "of a (* comment *) that never" ends
+   line 167 "of a (* comment *) that never" ends
+   line 168 "of a (* comment *) that never" ends
+   line 169 "of a (* comment *) that never" ends
+   line 170 "of a (* comment *) that never" ends
+   line 171 "of a (* comment *) that never" ends
+   line 172 "of a (* comment *) that never" ends
+   line 173 "of a (* comment *) that never" ends
+   line 174 "of a (* comment *) that never" ends
+   line 175 "of a (* comment *) that never" ends
+   line 176 "of a (* comment *) that never" ends
+   line 177 "of a (* comment *) that never" ends
+   line 178 "of a (* comment *) that never" ends
+   line 179 "of a (* comment *) that never" ends
+   line 180 "of a (* comment *) that never" ends
+   line 181 "of a (* comment *) that never" ends
+   line 182 "of a (* comment *) that never" ends
+   line 183 "of a (* comment *) that never" ends
+   line 184 "of a (* comment *) that never" ends
+   line 185 "of a (* comment *) that never" ends
+   line 186 "of a (* comment *) that never" ends
+   line 187 "of a (* comment *) that never" ends
+   line 188 "of a (* comment *) that never" ends
+   line 189 "of a (* comment *) that never" ends
+   line 190 "of a (* comment *) that never" ends
+   line 191 "of a (* comment *) that never" ends
+   line 192 "of a (* comment *) that never" ends
+   line 193 "of a (* comment *) that never" ends
+   line 194 "of a (* comment *) that never" ends
+   line 195 "of a (* comment *) that never" ends
+   line 196 "of a (* comment *) that never" ends
+   line 197 "of a (* comment *) that never" ends
+   line 198 "of a (* comment *) that never" ends
+   line 199 "of a (* comment *) that never" ends
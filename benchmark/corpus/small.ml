@@ -0,0 +1,116 @@
+(** Priority queues as leftist heaps, and a small tokenizer using them to
+    merge token streams by position. *)
+
+open Printf
+
+module type ORDERED = sig
+  type t
+  val compare : t -> t -> int
+end
+
+module Heap (O : ORDERED) : sig
+  type elt = O.t
+  type t
+  val empty : t
+  val is_empty : t -> bool
+  val insert : elt -> t -> t
+  val find_min : t -> elt option
+  val delete_min : t -> t
+  val of_list : elt list -> t
+  val to_sorted_list : t -> elt list
+end = struct
+  type elt = O.t
+  type t = Leaf | Node of int * elt * t * t
+
+  let empty = Leaf
+
+  let is_empty = function Leaf -> true | Node _ -> false
+
+  let rank = function Leaf -> 0 | Node (r, _, _, _) -> r
+
+  let make x a b =
+    if rank a >= rank b then Node (rank b + 1, x, a, b)
+    else Node (rank a + 1, x, b, a)
+
+  let rec merge h1 h2 =
+    match h1, h2 with
+    | Leaf, h | h, Leaf -> h
+    | Node (_, x, a1, b1), Node (_, y, a2, b2) ->
+      if O.compare x y <= 0 then make x a1 (merge b1 h2)
+      else make y a2 (merge h1 b2)
+
+  let insert x h = merge (Node (1, x, Leaf, Leaf)) h
+
+  let find_min = function Leaf -> None | Node (_, x, _, _) -> Some x
+
+  let delete_min = function
+    | Leaf -> Leaf
+    | Node (_, _, a, b) -> merge a b
+
+  let of_list l = List.fold_left (fun h x -> insert x h) empty l
+
+  let to_sorted_list h =
+    let rec go acc h =
+      match find_min h with
+      | None -> List.rev acc
+      | Some x -> go (x :: acc) (delete_min h)
+    in
+    go [] h
+end
+
+type token =
+  | Word of string
+  | Number of int
+  | Punct of char
+  | Eof
+
+type located = { pos : int; token : token }
+
+module LocatedHeap = Heap (struct
+    type t = located
+    let compare a b = compare a.pos b.pos
+  end)
+
+exception Lexing_error of int * string
+
+let is_digit c = c >= '0' && c <= '9'
+let is_alpha c = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c = '_'
+
+(* Splits [s] in tokens, positions are byte offsets. *)
+let tokenize ?(start = 0) s =
+  let n = String.length s in
+  let rec go i acc =
+    if i >= n then List.rev ({ pos = i + start; token = Eof } :: acc)
+    else
+      let c = s.[i] in
+      if c = ' ' || c = '\t' || c = '\n' then go (i + 1) acc
+      else if is_digit c then begin
+        let j = ref i in
+        while !j < n && is_digit s.[!j] do incr j done;
+        let value = int_of_string (String.sub s i (!j - i)) in
+        go !j ({ pos = i + start; token = Number value } :: acc)
+      end else if is_alpha c then begin
+        let j = ref i in
+        while !j < n && (is_alpha s.[!j] || is_digit s.[!j]) do incr j done;
+        go !j ({ pos = i + start; token = Word (String.sub s i (!j - i)) } :: acc)
+      end else if String.contains "()[]{};,.+-*/=<>" c then
+        go (i + 1) ({ pos = i + start; token = Punct c } :: acc)
+      else raise (Lexing_error (i + start, sprintf "unexpected %C" c))
+  in
+  go 0 []
+
+let merge_streams streams =
+  let heap = List.fold_left (fun h l -> List.fold_left (fun h t -> LocatedHeap.insert t h) h l)
+      LocatedHeap.empty streams in
+  LocatedHeap.to_sorted_list heap
+
+let string_of_token = function
+  | Word w -> sprintf "word %S" w
+  | Number n -> sprintf "number %d" n
+  | Punct c -> sprintf "punct %C" c
+  | Eof -> "end of input"
+
+let () =
+  let streams = [ tokenize "let x = 42 in x + 1"; tokenize ~start:100 "(f [a; b])" ] in
+  List.iter (fun { pos; token } -> printf "%4d: %s\n" pos (string_of_token token))
+    (merge_streams streams)
@@ -0,0 +1,93 @@
+#include "OCamlBlockData.h"
+
+#include <algorithm>
+
+namespace OCamlCreator {
+namespace OCaml {
+
+BlockData *BlockData::of(const QTextBlock &block)
+{
+    TextEditor::TextBlockUserData *userData = TextEditor::TextDocumentLayout::userData(block);
+    auto data = static_cast<BlockData *>(userData->codeFormatterData());
+    if (!data) {
+        data = new BlockData;
+        userData->setCodeFormatterData(data);
+    }
+    return data;
+}
+
+BlockData *BlockData::current(const QTextBlock &block)
+{
+    TextEditor::TextBlockUserData *userData = TextEditor::TextDocumentLayout::testUserData(block);
+    if (!userData)
+        return nullptr;
+    auto data = static_cast<BlockData *>(userData->codeFormatterData());
+    if (!data || data->revision != block.revision() || data->startState != stateAfter(block.previous()))
+        return nullptr;
+    return data;
+}
+
+int BlockData::stateAfter(const QTextBlock &block)
+{
+    if (!block.isValid() || block.userState() == -1)
+        return 0;
+    return block.userState() & Lexer::StateMask;
+}
+
+const BlockData *BlockData::indentContext(const QTextBlock &block)
+{
+    TextEditor::TextBlockUserData *userData = TextEditor::TextDocumentLayout::testUserData(block);
+    if (!userData)
+        return nullptr;
+    auto data = static_cast<const BlockData *>(userData->codeFormatterData());
+    if (!data || data->indentRevision != block.revision())
+        return nullptr;
+    return data;
+}
+
+bool BlockData::isHighlightPending(const QTextBlock &block)
+{
+    TextEditor::TextBlockUserData *userData = TextEditor::TextDocumentLayout::testUserData(block);
+    if (!userData)
+        return true;
+    auto data = static_cast<const BlockData *>(userData->codeFormatterData());
+    return !data || !data->highlighted;
+}
+
+QVector<Token> blockTokens(const QTextBlock &block)
+{
+    if (const BlockData *data = BlockData::current(block))
+        return data->tokens;
+
+    const QString text = block.text();
+    Lexer lexer(&text);
+    lexer.setState(BlockData::stateAfter(block.previous()));
+    QVector<Token> tokens;
+    Token token;
+    while ((token = lexer.read()).kind != Token::EndOfText)
+        tokens << token;
+    return tokens;
+}
+
+bool isInCommentOrString(const QTextBlock &block, int position)
+{
+    const QString text = block.text().left(position);
+    Lexer lexer(&text);
+    lexer.setState(BlockData::stateAfter(block.previous()));
+    while (lexer.read().kind != Token::EndOfText) {}
+    return lexer.state() != 0;
+}
+
+Token tokenAt(const QTextBlock &block, int position)
+{
+    const QVector<Token> tokens = blockTokens(block);
+    const auto it = std::partition_point(tokens.begin(), tokens.end(), [position](const Token &token) {
+        return token.position + token.length < position;
+    });
+    if (it == tokens.end() || it->position >= position)
+        return Token();
+    return *it;
+}
+
+}
+}
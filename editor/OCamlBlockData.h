@@ -0,0 +1,66 @@
+#ifndef OCaml_BlockData_h
+#define OCaml_BlockData_h
+
+#include "OCamlLexer.h"
+
+#include <texteditor/textdocumentlayout.h>
+
+#include <QTextBlock>
+#include <QVector>
+
+namespace OCamlCreator {
+namespace OCaml {
+
+// What the highlighter found on a block, kept in the block user data so that
+// the indenter, completion and quick fixes don't lex the line again. The
+// tokens are only current while the block revision and the lexer state the
+// line started in are the ones they were read with.
+class BlockData : public TextEditor::CodeFormatterData
+{
+public:
+    // The data of block, created if it has none yet.
+    static BlockData *of(const QTextBlock &block);
+    // The data of block if the tokens in it are current, nullptr otherwise.
+    static BlockData *current(const QTextBlock &block);
+
+    // Lexer state at the end of block as the highlighter left it.
+    static int stateAfter(const QTextBlock &block);
+
+    // Whether the highlighter only computed the state of block so far, see
+    // Highlighter. Blocks without data are.
+    static bool isHighlightPending(const QTextBlock &block);
+
+    // The data of block if its indentation context is current, nullptr
+    // otherwise. Unlike the tokens it is kept for blocks whose highlighting is
+    // pending too.
+    static const BlockData *indentContext(const QTextBlock &block);
+
+    int revision = -1;
+    int startState = 0;
+    bool highlighted = false;
+    QVector<Token> tokens;
+
+    // Indentation context: the nesting depth at the start of the line and
+    // whether its first token closes a level, see Indenter.
+    int indentRevision = -1;
+    int startDepth = 0;
+    bool startsWithCloser = false;
+};
+
+// Tokens of block, from the cache or lexed again when it is out of date, e.g.
+// in the copy of the document asynchronous assists work on.
+QVector<Token> blockTokens(const QTextBlock &block);
+
+// Whether position, relative to block, is inside a comment or a string, the
+// line being read from the state the previous line ended in. Needs the
+// states the highlighter keeps, not a copy of the document.
+bool isInCommentOrString(const QTextBlock &block, int position);
+
+// Token around position, relative to the block, whose text ends at or after
+// position and starts before it. EndOfText when there is none.
+Token tokenAt(const QTextBlock &block, int position);
+
+}
+}
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef OCaml_CodeModelData_h
+#define OCaml_CodeModelData_h
+
+#include "RubyCodeModel.h"
+#include "OCamlStringTable.h"
+#include "OCamlDeclarationScanner.h"
+
+#include <QDateTime>
+#include <QVector>
+
+// Internal to the code model: per-file index data shared by the scanner,
+// the model itself and the on-disk index.
+
+namespace OCamlCreator {
+
+// Rough heap cost of a QString with the given length, used by the memory report.
+inline qint64 stringBytes(int length)
+{
+    return sizeof(QArrayData) + (length + 1) * sizeof(QChar);
+}
+
+// Rough heap cost of the QSet<QString> the model used to keep.
+inline qint64 legacySetBytes(const QVector<StringTable::Id> &ids)
+{
+    const qint64 nodeSize = sizeof(void*) + sizeof(uint) + sizeof(QString);
+    StringTable *strings = StringTable::instance();
+    qint64 bytes = 0;
+    for (StringTable::Id id : ids)
+        bytes += nodeSize + sizeof(void*) + stringBytes(strings->string(id).size());
+    return bytes;
+}
+
+// Symbols of one kind in one file, stored as a structure of arrays.
+class SymbolTable
+{
+public:
+    typedef StringTable::Id Id;
+
+    int size() const { return m_names.size(); }
+
+    void append(Id name, Id detail, Id context, int line, int column, Symbol::Kind kind)
+    {
+        m_names << name;
+        m_details << detail;
+        m_contexts << context;
+        m_lines << line;
+        m_columns << column;
+        m_kinds << quint8(kind);
+    }
+
+    void reserve(int size)
+    {
+        m_names.reserve(size);
+        m_details.reserve(size);
+        m_contexts.reserve(size);
+        m_lines.reserve(size);
+        m_columns.reserve(size);
+        m_kinds.reserve(size);
+    }
+
+    void squeeze()
+    {
+        m_names.squeeze();
+        m_details.squeeze();
+        m_contexts.squeeze();
+        m_lines.squeeze();
+        m_columns.squeeze();
+        m_kinds.squeeze();
+    }
+
+    // Appends the symbols of other found on lines [firstLine, lastLine], moved by lineDelta.
+    void appendLines(const SymbolTable &other, int firstLine, int lastLine, int lineDelta = 0)
+    {
+        for (int i = 0; i < other.size(); ++i) {
+            const int line = other.m_lines.at(i);
+            if (line >= firstLine && line <= lastLine) {
+                append(other.m_names.at(i), other.m_details.at(i), other.m_contexts.at(i),
+                       line + lineDelta, other.m_columns.at(i), other.kind(i));
+            }
+        }
+    }
+
+    Id name(int i) const { return m_names.at(i); }
+    Id detail(int i) const { return m_details.at(i); }
+    Id context(int i) const { return m_contexts.at(i); }
+    int line(int i) const { return m_lines.at(i); }
+    int column(int i) const { return m_columns.at(i); }
+    Symbol::Kind kind(int i) const { return Symbol::Kind(m_kinds.at(i)); }
+
+    Symbol symbol(int i, const QString &file) const
+    {
+        StringTable *strings = StringTable::instance();
+        Symbol sym(file);
+        sym.name = strings->string(m_names.at(i));
+        if (m_details.at(i) != StringTable::EmptyId)
+            sym.name += strings->string(m_details.at(i));
+        sym.context = strings->string(m_contexts.at(i));
+        sym.line = m_lines.at(i);
+        sym.column = m_columns.at(i);
+        sym.kind = kind(i);
+        return sym;
+    }
+
+    void appendTo(QList<Symbol> &list, const QString &file) const
+    {
+        list.reserve(list.size() + size());
+        for (int i = 0; i < size(); ++i)
+            list << symbol(i, file);
+    }
+
+    qint64 memoryUsage() const
+    {
+        return m_names.capacity() * sizeof(Id) * 3 + m_lines.capacity() * sizeof(int) * 2
+                + m_kinds.capacity();
+    }
+
+    qint64 legacyMemoryUsage() const
+    {
+        const qint64 symbolSize = sizeof(void*) + 2 * sizeof(QString) + 2 * sizeof(int);
+        StringTable *strings = StringTable::instance();
+        qint64 bytes = 0;
+        for (int i = 0; i < size(); ++i) {
+            const int nameLength = strings->string(m_names.at(i)).size()
+                    + strings->string(m_details.at(i)).size();
+            bytes += sizeof(void*) + symbolSize + stringBytes(nameLength)
+                    + stringBytes(strings->string(m_contexts.at(i)).size());
+        }
+        return bytes;
+    }
+
+private:
+    QVector<Id> m_names;
+    QVector<Id> m_details;
+    QVector<Id> m_contexts;
+    QVector<int> m_lines;
+    QVector<int> m_columns;
+    QVector<quint8> m_kinds;
+};
+
+class CodeModel::Data
+{
+    Q_DISABLE_COPY(Data)
+
+public:
+    typedef StringTable::Id Id;
+
+    Data(const QString &fileName = QString()) : fileName(fileName), fileSize(-1), lineCount(0) {}
+
+    qint64 memoryUsage() const
+    {
+        return sizeof(Data) + stringBytes(fileName.size())
+                + methods.memoryUsage() + classes.memoryUsage() + constantsDecl.memoryUsage()
+                + (identifiers.capacity() + constants.capacity() + symbols.capacity()) * sizeof(Id);
+    }
+
+    qint64 legacyMemoryUsage() const
+    {
+        return sizeof(Data) + stringBytes(fileName.size())
+                + methods.legacyMemoryUsage() + classes.legacyMemoryUsage()
+                + constantsDecl.legacyMemoryUsage()
+                + legacySetBytes(identifiers) + legacySetBytes(constants) + legacySetBytes(symbols);
+    }
+
+    QDateTime lastUpdate;
+    QString fileName;
+    // State of the file on disk when it was scanned, fileSize is -1 when the
+    // data comes from an editor buffer and must not be persisted.
+    QDateTime lastModified;
+    qint64 fileSize;
+
+    SymbolTable methods;
+    SymbolTable classes;
+    SymbolTable constantsDecl;
+    // Sorted ids into the StringTable
+    QVector<Id> identifiers;
+    QVector<Id> constants;
+    QVector<Id> symbols;
+
+    // Where scanning can be restarted from, sorted by line. Empty for data loaded
+    // from the on-disk index, which then needs a full scan on the first edit.
+    int lineCount;
+    QVector<OCaml::DeclarationScanner::Checkpoint> checkpoints;
+};
+
+}
+
+#endif
@@ -9,12 +9,15 @@
 #include <texteditor/codeassist/iassistproposalmodel.h>
 #include <texteditor/codeassist/assistinterface.h>
 #include <texteditor/codeassist/assistenums.h>
+#include <texteditor/codeassist/assistproposalitem.h>
+#include <texteditor/codeassist/genericproposal.h>
 
 #include <QtGui/QTextDocument>
 #include <QtGui/QTextBlock>
 #include <QtGui/QIcon>
 
 #include "RubyRubocopHighlighter.h"
+#include "RubyCodeModel.h"
 
 namespace OCamlCreator {
 
@@ -35,6 +38,44 @@ TextEditor::IAssistProcessor *OCamlCompletionAssistProvider::createProcessor() c
 /* ************************************************************************** */
 
 /* ************************************************************************** */
+// Answers from the local index while merlin is busy with another request.
+// prefix is the whole dotted path typed so far, e.g. "List.ma".
+static TextEditor::IAssistProposal *localProposal(const QString &fileName, const QString &prefix,
+                                                  int startPosition)
+{
+    const int dot = prefix.lastIndexOf(QLatin1Char('.'));
+    const QString modulePath = dot < 0 ? QString() : prefix.left(dot);
+    const QString namePrefix = prefix.mid(dot + 1);
+    if (namePrefix.isEmpty() && modulePath.isEmpty())
+        return nullptr;
+
+    QList<TextEditor::AssistProposalItemInterface *> items;
+    QSet<QString> seen;
+    auto add = [&](const QString &name, const QString &detail) {
+        if (seen.contains(name))
+            return;
+        seen << name;
+        auto item = new TextEditor::AssistProposalItem;
+        item->setText(name);
+        item->setDetail(detail);
+        items << item;
+    };
+
+    CodeModel *model = CodeModel::instance();
+    for (const Symbol &symbol : model->declarationsStartingWith(namePrefix, modulePath))
+        add(symbol.name, symbol.context);
+    if (modulePath.isEmpty()) {
+        for (const QString &name : model->identifiersIn(fileName)) {
+            if (name.startsWith(namePrefix))
+                add(name, QString());
+        }
+    }
+
+    if (items.isEmpty())
+        return nullptr;
+    return new TextEditor::GenericProposal(startPosition, items);
+}
+
 CompletionAssistProcessor::CompletionAssistProcessor()
 {}
 
@@ -46,10 +87,15 @@ TextEditor::IAssistProposal *CompletionAssistProcessor::perform(const TextEditor
     if (interface->reason() == TextEditor::IdleEditor)
         return nullptr;
 
-    setPerformWasApplicable(true);
-
     int curPosition = interface->position();
 
+    // Nothing to complete in comments and strings.
+    auto completionInterface = dynamic_cast<const CompletionAssistInterface *>(interface);
+    if (completionInterface && completionInterface->isInCommentOrString())
+        return nullptr;
+
+    setPerformWasApplicable(true);
+
     int askedLine, askedCol, prefixLine, prefixCol;
     TextEditor::Convenience::convertPosition(interface->textDocument(), curPosition, &askedLine, &askedCol);
     //const int startPosition = findStartOfName();
@@ -57,13 +103,16 @@ TextEditor::IAssistProposal *CompletionAssistProcessor::perform(const TextEditor
     findPrefixes(-1, startPosition, qtcPos);
     TextEditor::Convenience::convertPosition(interface->textDocument(), startPosition, &prefixLine, &prefixCol);
 //    qDebug() << QString("prefix(Line,Col) = (%1, %2)").arg(prefixLine).arg(prefixCol);
-    // FIXME: We should check the block status in case of multi-line tokens
     const QString prefix =
             interface->textAt(startPosition, curPosition-startPosition);
 //    const QString qtcPrefix =
 //            interface->textAt(qtcPos, curPosition-qtcPos);
 //    qDebug() << QString("QtC prefix = `%1`").arg(qtcPrefix);
 
+    // Do not queue behind a running request, the local index answers right away.
+    if (RubocopHighlighter::instance()->isBusy())
+        return localProposal(interface->fileName(), prefix, qtcPos);
+
     RubocopHighlighter::instance()->performCompletion(
                 interface->textDocument(),
                 prefix,
@@ -4,6 +4,7 @@
 #include <texteditor/codeassist/completionassistprovider.h>
 #include <texteditor/codeassist/iassistprocessor.h>
 #include <texteditor/codeassist/assistproposaliteminterface.h>
+#include <texteditor/codeassist/assistinterface.h>
 
 namespace OCamlCreator {
 
@@ -19,6 +20,24 @@ public:
     bool isActivationCharSequence(const QString &sequence) const override;
 };
 
+// Knows whether the cursor is in a comment or a string. The processor works on
+// a copy of the document without the highlighter states, the editor finds it
+// out on the document itself.
+class CompletionAssistInterface : public TextEditor::AssistInterface
+{
+public:
+    CompletionAssistInterface(QTextDocument *textDocument, int position, const QString &fileName,
+                              TextEditor::AssistReason reason, bool inCommentOrString)
+        : TextEditor::AssistInterface(textDocument, position, fileName, reason)
+        , m_inCommentOrString(inCommentOrString)
+    {}
+
+    bool isInCommentOrString() const { return m_inCommentOrString; }
+
+private:
+    bool m_inCommentOrString;
+};
+
 class CompletionAssistProcessor : public TextEditor::IAssistProcessor
 {
 public:
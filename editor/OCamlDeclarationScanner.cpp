@@ -0,0 +1,403 @@
+#include "OCamlDeclarationScanner.h"
+
+#include <QFileInfo>
+#include <QStringList>
+
+namespace OCamlCreator {
+namespace OCaml {
+
+template <typename Stream>
+BasicDeclarationScanner<Stream>::BasicDeclarationScanner(const Stream &src, const QString &moduleName)
+    : m_lexer(src)
+    , m_expect(ExpectNothing)
+    , m_expectDepth(0)
+    , m_expectKind(Symbol::Value)
+    , m_previousKind(Token::EndOfText)
+    , m_previousEndsExpression(false)
+    , m_declaration(-1)
+{
+    m_frames << Frame(Frame::Structure, moduleName);
+}
+
+template <typename Stream>
+void BasicDeclarationScanner<Stream>::restore(const Checkpoint &checkpoint)
+{
+    m_lexer.setLine(checkpoint.line);
+    m_lexer.setState(checkpoint.lexerState);
+    m_frames = checkpoint.frames;
+    m_expect = Expect(checkpoint.expect);
+    m_expectDepth = checkpoint.expectDepth;
+    m_expectKind = Symbol::Kind(checkpoint.expectKind);
+    m_previousKind = Token::Kind(checkpoint.previousKind);
+    m_previousEndsExpression = checkpoint.previousEndsExpression;
+}
+
+template <typename Stream>
+DeclarationScannerBase::Checkpoint BasicDeclarationScanner<Stream>::checkpoint() const
+{
+    Checkpoint checkpoint;
+    checkpoint.line = m_lexer.currentLine();
+    checkpoint.lexerState = m_lexer.state();
+    checkpoint.frames = m_frames;
+    checkpoint.expect = m_expect;
+    checkpoint.expectDepth = m_expectDepth;
+    checkpoint.expectKind = m_expectKind;
+    checkpoint.previousKind = m_previousKind;
+    checkpoint.previousEndsExpression = m_previousEndsExpression;
+    return checkpoint;
+}
+
+QString DeclarationScannerBase::moduleNameFor(const QString &fileName)
+{
+    QString name = QFileInfo(fileName).baseName();
+    if (!name.isEmpty())
+        name[0] = name.at(0).toUpper();
+    return name;
+}
+
+template <typename Stream>
+QString BasicDeclarationScanner<Stream>::contextName() const
+{
+    QStringList names;
+    for (const Frame &frame : m_frames) {
+        if (!frame.name.isEmpty())
+            names << frame.name;
+    }
+    return names.join(QLatin1Char('.'));
+}
+
+template <typename Stream>
+Token BasicDeclarationScanner<Stream>::read()
+{
+    m_declaration = -1;
+    const Token token = m_lexer.read();
+    switch (token.kind) {
+    case Token::Whitespace:
+    case Token::Comment:
+    case Token::EndOfText:
+        return token;
+    default:
+        break;
+    }
+
+    if (m_expect == ExpectNothing || !handleExpectation(token)) {
+        m_expect = ExpectNothing;
+        handleStructure(token);
+    }
+
+    m_previousKind = token.kind;
+    m_previousEndsExpression = endsExpression(token);
+    return token;
+}
+
+// Returns false when the token is not part of the expected declaration header.
+template <typename Stream>
+bool BasicDeclarationScanner<Stream>::handleExpectation(const Token &token)
+{
+    const int depth = m_frames.size();
+
+    switch (m_expect) {
+    case ExpectValueName:
+        if (token.kind == Token::KeywordRec || token.kind == Token::KeywordModifier)
+            return true;
+        if (token.kind == Token::Identifier) {
+            if (!m_lexer.textIs(token, "_"))
+                m_declaration = m_expectKind;
+            m_expect = ExpectNothing;
+            return true;
+        }
+        if (token.kind == Token::OpenParen) {
+            push(Frame::Paren);
+            m_expect = ExpectOperatorName;
+            m_expectDepth = m_frames.size();
+            return true;
+        }
+        break;
+    case ExpectOperatorName:
+        // let ( +! ) a b = ..., val ( mod ) : ...
+        if (depth == m_expectDepth && (token.kind == Token::Operator || token.kind == Token::Equal
+                                       || token.kind == Token::Bar || token.kind == Token::Colon
+                                       || token.kind == Token::Keyword)) {
+            m_declaration = m_expectKind;
+            m_expect = ExpectNothing;
+            return true;
+        }
+        break;
+    case ExpectTypeName:
+    case ExpectClassName:
+        // Skip the parameters: type ('a, 'b) t, class ['a] c
+        if (depth > m_expectDepth) {
+            handleStructure(token);
+            return true;
+        }
+        switch (token.kind) {
+        case Token::Identifier:
+            m_declaration = m_expectKind;
+            if (m_expect == ExpectClassName)
+                m_frames.last().pendingName = m_lexer.text(token);
+            m_expect = ExpectNothing;
+            return true;
+        case Token::OpenParen:
+            push(Frame::Paren);
+            return true;
+        case Token::OpenBracket:
+            push(Frame::Bracket);
+            return true;
+        case Token::TypeVariable:
+        case Token::Operator:
+        case Token::KeywordModifier:
+        case Token::KeywordType:
+        case Token::Capitalized:
+        case Token::Dot:
+            return true;
+        default:
+            break;
+        }
+        break;
+    case ExpectModuleName:
+        if (token.kind == Token::KeywordRec)
+            return true;
+        if (token.kind == Token::KeywordType) {
+            m_expectKind = Symbol::ModuleType;
+            return true;
+        }
+        if (token.kind == Token::Capitalized) {
+            m_declaration = m_expectKind;
+            m_frames.last().pendingName = m_lexer.text(token);
+            m_expect = ExpectNothing;
+            return true;
+        }
+        break;
+    case ExpectExceptionName:
+        if (token.kind == Token::Capitalized) {
+            m_declaration = m_expectKind;
+            m_expect = ExpectNothing;
+            return true;
+        }
+        break;
+    case ExpectNothing:
+        break;
+    }
+    return false;
+}
+
+template <typename Stream>
+void BasicDeclarationScanner<Stream>::handleStructure(const Token &token)
+{
+    Frame &frame = m_frames.last();
+    const Token::Kind previous = m_previousKind;
+
+    switch (token.kind) {
+    case Token::KeywordLet:
+        if (isToplevelLet()) {
+            startItem(Symbol::Value);
+            frame.inDefinition = true;
+            expect(ExpectValueName, Symbol::Value);
+        } else {
+            ++frame.localLets;
+        }
+        break;
+    case Token::KeywordAnd:
+        if (!atItemLevel() || previous == Token::KeywordWith)
+            break;
+        switch (frame.andKind) {
+        case Symbol::Value:
+            expect(ExpectValueName, Symbol::Value);
+            break;
+        case Symbol::Type:
+            expect(ExpectTypeName, Symbol::Type);
+            break;
+        case Symbol::Module:
+            expect(ExpectModuleName, Symbol::Module);
+            break;
+        case Symbol::Class:
+            expect(ExpectClassName, Symbol::Class);
+            break;
+        default:
+            break;
+        }
+        break;
+    case Token::KeywordIn:
+        if (frame.localLets > 0)
+            --frame.localLets;
+        break;
+    case Token::KeywordType:
+        // Not: (type a), let f : type a. ..., with type t = ..., module type of
+        if (atItemLevel() && previous != Token::OpenParen && previous != Token::Colon
+                && previous != Token::KeywordWith && previous != Token::KeywordAnd
+                && previous != Token::KeywordModule && previous != Token::KeywordClass) {
+            startItem(Symbol::Type);
+            expect(ExpectTypeName, Symbol::Type);
+        }
+        break;
+    case Token::KeywordModule:
+        // Not: let module, (module M : S), with module, include module type of
+        if (atItemLevel() && previous != Token::KeywordLet && previous != Token::OpenParen
+                && previous != Token::Colon && previous != Token::KeywordWith
+                && previous != Token::KeywordAnd && previous != Token::KeywordInclude) {
+            startItem(Symbol::Module);
+            expect(ExpectModuleName, Symbol::Module);
+        }
+        break;
+    case Token::KeywordVal:
+        if (atItemLevel()) {
+            startItem(-1);
+            expect(ExpectValueName, Symbol::Value);
+        }
+        break;
+    case Token::KeywordExternal:
+        if (atItemLevel()) {
+            startItem(-1);
+            expect(ExpectValueName, Symbol::External);
+        }
+        break;
+    case Token::KeywordException:
+        // Not: let exception E in, | exception E ->
+        if (atItemLevel() && previous != Token::KeywordLet && previous != Token::Bar
+                && previous != Token::KeywordWith) {
+            startItem(-1);
+            expect(ExpectExceptionName, Symbol::Exception);
+        }
+        break;
+    case Token::KeywordClass:
+        if (atItemLevel()) {
+            // class c x = let y = ... in object ... end
+            startItem(Symbol::Class);
+            frame.inDefinition = true;
+            expect(ExpectClassName, Symbol::Class);
+        }
+        break;
+    case Token::KeywordOpen:
+    case Token::KeywordInclude:
+        if (atItemLevel() && previous != Token::KeywordLet)
+            startItem(-1);
+        break;
+    case Token::KeywordStruct:
+        push(Frame::Structure, frame.pendingName);
+        break;
+    case Token::KeywordSig:
+        push(Frame::Signature, frame.pendingName);
+        break;
+    case Token::KeywordObject:
+        push(Frame::Object, frame.pendingName);
+        break;
+    case Token::KeywordBegin:
+        push(Frame::Begin);
+        break;
+    case Token::KeywordEnd:
+        pop(Frame::Structure);
+        break;
+    case Token::OpenParen:
+        push(Frame::Paren);
+        break;
+    case Token::OpenBracket:
+        push(Frame::Bracket);
+        break;
+    case Token::OpenBrace:
+        push(Frame::Brace);
+        break;
+    case Token::CloseParen:
+        pop(Frame::Paren);
+        break;
+    case Token::CloseBracket:
+        pop(Frame::Bracket);
+        break;
+    case Token::CloseBrace:
+        pop(Frame::Brace);
+        break;
+    case Token::DoubleSemicolon:
+        frame.localLets = 0;
+        startItem(-1);
+        break;
+    default:
+        break;
+    }
+}
+
+template <typename Stream>
+void BasicDeclarationScanner<Stream>::expect(Expect what, Symbol::Kind kind)
+{
+    m_expect = what;
+    m_expectKind = kind;
+    m_expectDepth = m_frames.size();
+}
+
+// Declarations are only looked for directly in a structure, signature or object.
+template <typename Stream>
+bool BasicDeclarationScanner<Stream>::atItemLevel() const
+{
+    const Frame &frame = m_frames.last();
+    return frame.kind <= Frame::Object && frame.localLets == 0;
+}
+
+template <typename Stream>
+bool BasicDeclarationScanner<Stream>::isToplevelLet() const
+{
+    const Frame &frame = m_frames.last();
+    if (!atItemLevel() || frame.kind == Frame::Object)
+        return false;
+    return !frame.inDefinition || m_previousEndsExpression;
+}
+
+template <typename Stream>
+void BasicDeclarationScanner<Stream>::startItem(int andKind)
+{
+    Frame &frame = m_frames.last();
+    frame.inDefinition = false;
+    frame.andKind = andKind;
+    frame.pendingName.clear();
+}
+
+template <typename Stream>
+void BasicDeclarationScanner<Stream>::push(Frame::Kind kind, const QString &name)
+{
+    m_frames << Frame(kind, name);
+}
+
+// "end" closes the innermost struct, sig, object or begin together with the
+// brackets left open in it, a bracket only closes its own kind and never
+// crosses a block. The root frame is never closed.
+template <typename Stream>
+void BasicDeclarationScanner<Stream>::pop(Frame::Kind kind)
+{
+    const bool block = kind <= Frame::Begin;
+    for (int i = m_frames.size() - 1; i > 0; --i) {
+        const Frame::Kind current = m_frames.at(i).kind;
+        if (block ? current <= Frame::Begin : current == kind) {
+            m_frames.resize(i);
+            return;
+        }
+        if (!block && current <= Frame::Begin)
+            return;
+    }
+}
+
+template <typename Stream>
+bool BasicDeclarationScanner<Stream>::endsExpression(const Token &token) const
+{
+    switch (token.kind) {
+    case Token::Identifier:
+    case Token::Capitalized:
+    case Token::Number:
+    case Token::String:
+    case Token::Char:
+    case Token::PolyVariant:
+    case Token::Label:
+    case Token::TypeVariable:
+    case Token::CloseParen:
+    case Token::CloseBracket:
+    case Token::CloseBrace:
+    case Token::KeywordEnd:
+        return true;
+    case Token::Keyword:
+        return m_lexer.textIs(token, "done") || m_lexer.textIs(token, "true")
+                || m_lexer.textIs(token, "false");
+    default:
+        return false;
+    }
+}
+template class BasicDeclarationScanner<SourceCodeStream>;
+template class BasicDeclarationScanner<Utf8SourceCodeStream>;
+
+}
+}
@@ -0,0 +1,149 @@
+#ifndef OCaml_DeclarationScanner_h
+#define OCaml_DeclarationScanner_h
+
+#include "OCamlLexer.h"
+#include "RubySymbol.h"
+
+#include <QString>
+#include <QVector>
+
+namespace OCamlCreator {
+namespace OCaml {
+
+// What the declaration scanners have in common whatever text they read, so
+// that checkpoints taken by one can be restored by the other.
+class DeclarationScannerBase
+{
+public:
+    struct Frame
+    {
+        enum Kind { Structure, Signature, Object, Begin, Paren, Bracket, Brace };
+
+        Frame(Kind kind = Structure, const QString &name = QString())
+            : kind(kind), name(name), localLets(0), inDefinition(false), andKind(-1)
+        {}
+
+        bool operator==(const Frame &other) const
+        {
+            return kind == other.kind && name == other.name && localLets == other.localLets
+                    && inDefinition == other.inDefinition && andKind == other.andKind
+                    && pendingName == other.pendingName;
+        }
+
+        Kind kind;
+        QString name;
+        // "let" waiting for their "in".
+        int localLets;
+        // A toplevel let is being defined, another let is local unless it follows
+        // something that ends an expression.
+        bool inDefinition;
+        // Kind of declaration a toplevel "and" continues, -1 when none.
+        int andKind;
+        // Name of the module or class declared last, for the struct/sig/object that follows.
+        QString pendingName;
+    };
+
+    // Scanner state at the end of a line, used to restart scanning there.
+    struct Checkpoint
+    {
+        int line = 0;
+        int lexerState = 0;
+        QVector<Frame> frames;
+        int expect = 0;
+        int expectDepth = 0;
+        int expectKind = 0;
+        int previousKind = Token::EndOfText;
+        bool previousEndsExpression = false;
+
+        // Two checkpoints are equivalent when scanning from them gives the same result,
+        // no matter on which line they are.
+        bool operator==(const Checkpoint &other) const
+        {
+            return lexerState == other.lexerState && frames == other.frames
+                    && expect == other.expect && expectDepth == other.expectDepth
+                    && expectKind == other.expectKind
+                    && previousKind == other.previousKind
+                    && previousEndsExpression == other.previousEndsExpression;
+        }
+        bool operator!=(const Checkpoint &other) const { return !(*this == other); }
+    };
+
+    // "foo_bar.ml" -> "Foo_bar"
+    static QString moduleNameFor(const QString &fileName);
+};
+
+// Reads the tokens of an OCaml file and tells which of them are the names of
+// let, type, module, module type, val, external, exception and class
+// declarations, keeping track of the module path they are declared in.
+// This is a heuristic, it does not parse OCaml: local lets are told apart
+// from toplevel ones by what precedes them and by their matching "in".
+template <typename Stream>
+class BasicDeclarationScanner : public DeclarationScannerBase
+{
+    Q_DISABLE_COPY(BasicDeclarationScanner)
+
+public:
+    typedef typename Stream::Char Char;
+
+    // moduleName is the module the file defines, the root of every context.
+    BasicDeclarationScanner(const Stream &src, const QString &moduleName = QString());
+
+    // The text must start with the line feed the checkpoint was taken at.
+    void restore(const Checkpoint &checkpoint);
+    Checkpoint checkpoint() const;
+
+    Token read();
+
+    // Whether the last token read is the name of a declaration.
+    bool isDeclaration() const { return m_declaration >= 0; }
+    Symbol::Kind declarationKind() const { return Symbol::Kind(m_declaration); }
+    // Module path the last token is in, e.g. "Foo.Bar".
+    QString contextName() const;
+
+    int currentLine() const { return m_lexer.currentLine(); }
+    int currentColumn(const Token &token) const { return m_lexer.currentColumn(token); }
+    bool atLineEnd() const { return m_lexer.atLineEnd(); }
+    // Characters of a token, in the encoding of the stream.
+    const Char *tokenData(const Token &token) const { return m_lexer.constData() + token.position; }
+
+private:
+    enum Expect {
+        ExpectNothing,
+        ExpectValueName,
+        ExpectOperatorName,
+        ExpectTypeName,
+        ExpectModuleName,
+        ExpectExceptionName,
+        ExpectClassName
+    };
+
+    bool handleExpectation(const Token &token);
+    void handleStructure(const Token &token);
+    void expect(Expect what, Symbol::Kind kind);
+    bool atItemLevel() const;
+    bool isToplevelLet() const;
+    void startItem(int andKind);
+    void push(Frame::Kind kind, const QString &name = QString());
+    void pop(Frame::Kind kind);
+    bool endsExpression(const Token &token) const;
+
+    BasicLexer<Stream> m_lexer;
+    QVector<Frame> m_frames;
+    Expect m_expect;
+    int m_expectDepth;
+    Symbol::Kind m_expectKind;
+    Token::Kind m_previousKind;
+    bool m_previousEndsExpression;
+    int m_declaration;
+};
+
+typedef BasicDeclarationScanner<SourceCodeStream> DeclarationScanner;
+typedef BasicDeclarationScanner<Utf8SourceCodeStream> Utf8DeclarationScanner;
+
+extern template class BasicDeclarationScanner<SourceCodeStream>;
+extern template class BasicDeclarationScanner<Utf8SourceCodeStream>;
+
+}
+}
+
+#endif
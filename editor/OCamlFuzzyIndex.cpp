@@ -0,0 +1,189 @@
+#include "OCamlFuzzyIndex.h"
+
+#include <QVarLengthArray>
+
+#include <algorithm>
+
+namespace OCamlCreator {
+
+enum {
+    ScoreMatch = 16,
+    BonusFirst = 24,
+    BonusWordStart = 16,
+    BonusConsecutive = 12,
+    BonusExact = 32,
+    PenaltyGap = 6,
+    MaxLengthPenalty = 8,
+    CancelCheckInterval = 4096
+};
+
+static const int NoMatch = -(1 << 20);
+
+FuzzyIndex::FuzzyIndex(const QList<Symbol> &symbols)
+    : m_symbols(symbols)
+{
+    m_entries.reserve(m_symbols.size());
+    for (const Symbol &symbol : m_symbols) {
+        Entry entry;
+        entry.lowerName = symbol.name.toLower();
+        entry.chars = charMask(entry.lowerName);
+        entry.wordStarts = wordStarts(symbol.name);
+        m_entries << entry;
+    }
+}
+
+// One bit per ASCII letter, digit, '_' and '.', anything else shares the
+// remaining bits. A name can only match when it has every bit of the query.
+quint64 FuzzyIndex::charMask(const QString &lowerText)
+{
+    quint64 mask = 0;
+    for (const QChar c : lowerText) {
+        const ushort u = c.unicode();
+        int bit;
+        if (u >= 'a' && u <= 'z')
+            bit = u - 'a';
+        else if (u >= '0' && u <= '9')
+            bit = 26 + u - '0';
+        else if (u == '_')
+            bit = 36;
+        else if (u == '.')
+            bit = 37;
+        else
+            bit = 38 + u % 26;
+        mask |= quint64(1) << bit;
+    }
+    return mask;
+}
+
+// Bit i is set when a word starts at i: foo_bar, fooBar, Foo.bar, foo2
+quint64 FuzzyIndex::wordStarts(const QString &name)
+{
+    quint64 starts = name.isEmpty() ? 0 : 1;
+    const int length = qMin(name.size(), 64);
+    for (int i = 1; i < length; ++i) {
+        const QChar previous = name.at(i - 1);
+        const QChar c = name.at(i);
+        if (!previous.isLetterOrNumber() || (previous.isLower() && c.isUpper())
+                || (!previous.isDigit() && c.isDigit())) {
+            starts |= quint64(1) << i;
+        }
+    }
+    return starts;
+}
+
+int FuzzyIndex::score(const QString &query, const QString &name)
+{
+    return score(query.toLower(), name.toLower(), wordStarts(name));
+}
+
+// Best placement of the query characters in the name: every matched character
+// scores, more so at a word start, a run of consecutive characters adds to it
+// and every gap costs. Quadratic in the worst case but names and queries are short.
+int FuzzyIndex::score(const QString &lowerQuery, const QString &lowerName, quint64 wordStarts)
+{
+    const int queryLength = lowerQuery.size();
+    const int length = lowerName.size();
+    if (queryLength == 0)
+        return 0;
+    if (queryLength > length)
+        return -1;
+
+    auto charScore = [wordStarts](int i) -> int {
+        if (i == 0)
+            return ScoreMatch + BonusFirst;
+        if (i < 64 && (wordStarts >> i) & 1)
+            return ScoreMatch + BonusWordStart;
+        return ScoreMatch;
+    };
+
+    // previous[i]: best score with the previous query character at i.
+    QVarLengthArray<int, 64> previous(length);
+    QVarLengthArray<int, 64> current(length);
+    const QChar first = lowerQuery.at(0);
+    for (int i = 0; i < length; ++i)
+        previous[i] = lowerName.at(i) == first ? charScore(i) : NoMatch;
+
+    for (int q = 1; q < queryLength; ++q) {
+        const QChar c = lowerQuery.at(q);
+        int bestBefore = NoMatch; // best of previous[0 .. i - 2]
+        bool found = false;
+        for (int i = 0; i < length; ++i) {
+            if (i >= 2)
+                bestBefore = qMax(bestBefore, previous[i - 2]);
+            current[i] = NoMatch;
+            if (i == 0 || lowerName.at(i) != c)
+                continue;
+            const int best = qMax(previous[i - 1] + BonusConsecutive, bestBefore - PenaltyGap);
+            if (best > NoMatch / 2) {
+                current[i] = best + charScore(i);
+                found = true;
+            }
+        }
+        if (!found)
+            return -1;
+        std::swap(previous, current);
+    }
+
+    int result = NoMatch;
+    for (int i = queryLength - 1; i < length; ++i)
+        result = qMax(result, previous[i]);
+    if (result <= NoMatch / 2)
+        return -1;
+
+    if (queryLength == length)
+        result += BonusExact;
+    result -= qMin(length - queryLength, int(MaxLengthPenalty));
+    return qMax(result, 0);
+}
+
+QVector<FuzzyIndex::Match> FuzzyIndex::search(const QString &query, int limit,
+                                              const std::function<bool()> &isCanceled) const
+{
+    QVector<Match> best;
+    if (limit <= 0)
+        return best;
+
+    const QString lowerQuery = query.toLower();
+    const quint64 queryChars = charMask(lowerQuery);
+
+    // Higher score first, then shorter and alphabetically first names.
+    auto isBetter = [this](const Match &a, const Match &b) {
+        if (a.score != b.score)
+            return a.score > b.score;
+        const QString &aName = m_entries.at(a.index).lowerName;
+        const QString &bName = m_entries.at(b.index).lowerName;
+        if (aName.size() != bName.size())
+            return aName.size() < bName.size();
+        const int order = aName.compare(bName);
+        return order != 0 ? order < 0 : a.index < b.index;
+    };
+
+    // Keep the best limit matches in a heap with the worst of them on top.
+    best.reserve(qMin(limit, m_entries.size()) + 1);
+    for (int i = 0; i < m_entries.size(); ++i) {
+        if (i % CancelCheckInterval == 0 && isCanceled && isCanceled())
+            return QVector<Match>();
+
+        const Entry &entry = m_entries.at(i);
+        if ((entry.chars & queryChars) != queryChars)
+            continue;
+        const int s = score(lowerQuery, entry.lowerName, entry.wordStarts);
+        if (s < 0)
+            continue;
+
+        const Match match = { i, s };
+        if (best.size() < limit) {
+            best << match;
+            std::push_heap(best.begin(), best.end(), isBetter);
+        } else if (isBetter(match, best.first())) {
+            std::pop_heap(best.begin(), best.end(), isBetter);
+            best.last() = match;
+            std::push_heap(best.begin(), best.end(), isBetter);
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end(), isBetter);
+    return best;
+}
+
+}
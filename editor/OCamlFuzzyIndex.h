@@ -0,0 +1,60 @@
+#ifndef OCaml_FuzzyIndex_h
+#define OCaml_FuzzyIndex_h
+
+#include "RubySymbol.h"
+
+#include <QList>
+#include <QString>
+#include <QVector>
+
+#include <functional>
+
+namespace OCamlCreator {
+
+// Symbols prepared for fuzzy matching: names are lower cased once, and every
+// name keeps a bit mask of the characters it contains and of where its words
+// start, so most candidates are rejected without looking at their text.
+// Immutable once built, can be searched from several threads.
+class FuzzyIndex
+{
+public:
+    struct Match
+    {
+        int index;
+        int score;
+    };
+
+    explicit FuzzyIndex(const QList<Symbol> &symbols);
+
+    int size() const { return m_symbols.size(); }
+    const Symbol &symbol(int index) const { return m_symbols.at(index); }
+
+    // The best limit matches for query, best first. Returns nothing when
+    // isCanceled() says so, it is checked every few thousand candidates.
+    QVector<Match> search(const QString &query, int limit,
+                         const std::function<bool()> &isCanceled = std::function<bool()>()) const;
+
+    // Score of query against name, -1 when the characters of query do not all
+    // appear in order in name. Word starts (after '_', '.', or a lower to upper
+    // case change) and consecutive characters score higher.
+    static int score(const QString &query, const QString &name);
+
+private:
+    struct Entry
+    {
+        QString lowerName;
+        quint64 chars;
+        quint64 wordStarts;
+    };
+
+    static quint64 charMask(const QString &lowerText);
+    static quint64 wordStarts(const QString &name);
+    static int score(const QString &lowerQuery, const QString &lowerName, quint64 wordStarts);
+
+    QList<Symbol> m_symbols;
+    QVector<Entry> m_entries;
+};
+
+}
+
+#endif
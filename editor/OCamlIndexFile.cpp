@@ -0,0 +1,342 @@
+#include "OCamlIndexFile.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QDebug>
+
+#include <algorithm>
+#include <cstring>
+
+namespace OCamlCreator {
+
+typedef StringTable::Id Id;
+
+// Layout, all in host byte order and 8 bytes aligned:
+//   Header
+//   quint32 string offsets[stringCount + 1], in QChars from the string data
+//   UTF-16 string data
+//   Entry files[fileCount]
+//   quint32 arrays referenced by the entries
+// String 0 is always the empty string.
+static const char IndexMagic[4] = { 'O', 'C', 'I', 'X' };
+static const quint32 IndexVersion = 2;
+static const quint32 IndexByteOrder = 0x01020304;
+
+struct CodeModel::IndexFile::Header
+{
+    char magic[4];
+    quint32 version;
+    quint32 byteOrder;
+    quint32 stringCount;
+    quint32 fileCount;
+    quint32 padding;
+    quint64 stringOffsetsOffset;
+    quint64 stringDataOffset;
+    quint64 filesOffset;
+};
+
+struct CodeModel::IndexFile::Entry
+{
+    enum { Methods, Classes, ConstantsDecl, Identifiers, Constants, Symbols, CountsSize };
+
+    qint64 lastModified;
+    qint64 size;
+    quint64 dataOffset;
+    quint32 path;
+    quint32 counts[CountsSize];
+    quint32 padding;
+
+    quint64 dataSize() const
+    {
+        return sizeof(quint32) * (6 * (quint64(counts[Methods]) + counts[Classes] + counts[ConstantsDecl])
+                                  + counts[Identifiers] + counts[Constants] + counts[Symbols]);
+    }
+};
+
+CodeModel::IndexFile::IndexFile(const QString &path)
+    : m_file(path)
+    , m_data(nullptr)
+    , m_size(0)
+    , m_header(nullptr)
+    , m_stringOffsets(nullptr)
+    , m_stringData(nullptr)
+{
+    Q_STATIC_ASSERT(sizeof(Header) == 48);
+    Q_STATIC_ASSERT(sizeof(Entry) == 56);
+
+    if (!m_file.open(QFile::ReadOnly))
+        return;
+    m_size = m_file.size();
+    if (m_size < qint64(sizeof(Header)))
+        return;
+    m_data = m_file.map(0, m_size);
+    if (!m_data)
+        return;
+
+    const Header *header = reinterpret_cast<const Header*>(m_data);
+    if (std::memcmp(header->magic, IndexMagic, sizeof(IndexMagic))
+            || header->version != IndexVersion
+            || header->byteOrder != IndexByteOrder
+            || header->stringCount == 0
+            || !checkRange(header->stringOffsetsOffset, (quint64(header->stringCount) + 1) * sizeof(quint32))
+            || !checkRange(header->filesOffset, quint64(header->fileCount) * sizeof(Entry))) {
+        qWarning() << "Ignoring incompatible code model index" << path;
+        return;
+    }
+
+    m_stringOffsets = reinterpret_cast<const quint32*>(m_data + header->stringOffsetsOffset);
+    m_stringData = reinterpret_cast<const QChar*>(m_data + header->stringDataOffset);
+    const quint32 stringDataSize = m_stringOffsets[header->stringCount];
+    if (!checkRange(header->stringDataOffset, quint64(stringDataSize) * sizeof(QChar)))
+        return;
+    for (quint32 i = 0; i < header->stringCount; ++i) {
+        if (m_stringOffsets[i] > m_stringOffsets[i + 1])
+            return;
+    }
+
+    const Entry *entries = reinterpret_cast<const Entry*>(m_data + header->filesOffset);
+    m_entries.reserve(header->fileCount);
+    for (quint32 i = 0; i < header->fileCount; ++i) {
+        const Entry &entry = entries[i];
+        if (entry.path >= header->stringCount || !checkRange(entry.dataOffset, entry.dataSize())) {
+            m_entries.clear();
+            return;
+        }
+        const quint32 begin = m_stringOffsets[entry.path];
+        m_entries.insert(QString(m_stringData + begin, m_stringOffsets[entry.path + 1] - begin), &entry);
+    }
+
+    m_header = header;
+}
+
+bool CodeModel::IndexFile::checkRange(quint64 offset, quint64 size) const
+{
+    return offset % sizeof(quint32) == 0 && offset <= quint64(m_size) && size <= quint64(m_size) - offset;
+}
+
+Id CodeModel::IndexFile::stringId(quint32 index, bool *ok) const
+{
+    if (index == 0)
+        return StringTable::EmptyId;
+    if (index >= m_header->stringCount) {
+        *ok = false;
+        return StringTable::EmptyId;
+    }
+    const quint32 begin = m_stringOffsets[index];
+    return StringTable::instance()->intern(m_stringData + begin, m_stringOffsets[index + 1] - begin);
+}
+
+const quint32 *CodeModel::IndexFile::readSymbols(const quint32 *src, quint32 count,
+                                                 SymbolTable &table, bool *ok) const
+{
+    const quint32 *names = src;
+    const quint32 *details = names + count;
+    const quint32 *contexts = details + count;
+    const quint32 *lines = contexts + count;
+    const quint32 *columns = lines + count;
+    const quint32 *kinds = columns + count;
+
+    table.reserve(count);
+    for (quint32 i = 0; i < count; ++i) {
+        if (kinds[i] > Symbol::Class)
+            *ok = false;
+        table.append(stringId(names[i], ok), stringId(details[i], ok), stringId(contexts[i], ok),
+                     int(lines[i]), int(columns[i]), Symbol::Kind(kinds[i]));
+    }
+    return kinds + count;
+}
+
+const quint32 *CodeModel::IndexFile::readIds(const quint32 *src, quint32 count,
+                                             QVector<Id> &ids, bool *ok) const
+{
+    ids.reserve(count);
+    for (quint32 i = 0; i < count; ++i)
+        ids << stringId(src[i], ok);
+    // Ids are process local, the order on disk means nothing here.
+    std::sort(ids.begin(), ids.end());
+    return src + count;
+}
+
+CodeModel::DataPtr CodeModel::IndexFile::load(const QString &file, const QFileInfo &info) const
+{
+    const Entry *entry = m_header ? m_entries.value(file) : nullptr;
+    if (!entry
+            || entry->size != info.size()
+            || entry->lastModified != info.lastModified().toMSecsSinceEpoch()) {
+        return DataPtr();
+    }
+
+    auto data = std::make_shared<Data>(file);
+    data->lastUpdate = QDateTime::currentDateTime();
+    data->lastModified = info.lastModified();
+    data->fileSize = info.size();
+
+    bool ok = true;
+    const quint32 *src = reinterpret_cast<const quint32*>(m_data + entry->dataOffset);
+    src = readSymbols(src, entry->counts[Entry::Methods], data->methods, &ok);
+    src = readSymbols(src, entry->counts[Entry::Classes], data->classes, &ok);
+    src = readSymbols(src, entry->counts[Entry::ConstantsDecl], data->constantsDecl, &ok);
+    src = readIds(src, entry->counts[Entry::Identifiers], data->identifiers, &ok);
+    src = readIds(src, entry->counts[Entry::Constants], data->constants, &ok);
+    readIds(src, entry->counts[Entry::Symbols], data->symbols, &ok);
+
+    return ok ? data : DataPtr();
+}
+
+namespace {
+
+class IndexWriter
+{
+public:
+    IndexWriter()
+    {
+        m_strings << StringTable::EmptyId;
+        m_localIds.insert(StringTable::EmptyId, 0);
+    }
+
+    quint32 local(Id id)
+    {
+        auto it = m_localIds.constFind(id);
+        if (it != m_localIds.constEnd())
+            return it.value();
+        const quint32 index = m_strings.size();
+        m_strings << id;
+        m_localIds.insert(id, index);
+        return index;
+    }
+
+    void append(quint32 value)
+    {
+        m_arrays.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void appendIds(const QVector<Id> &ids)
+    {
+        for (Id id : ids)
+            append(local(id));
+    }
+
+    void appendSymbols(const SymbolTable &table)
+    {
+        const int count = table.size();
+        for (int i = 0; i < count; ++i)
+            append(local(table.name(i)));
+        for (int i = 0; i < count; ++i)
+            append(local(table.detail(i)));
+        for (int i = 0; i < count; ++i)
+            append(local(table.context(i)));
+        for (int i = 0; i < count; ++i)
+            append(quint32(table.line(i)));
+        for (int i = 0; i < count; ++i)
+            append(quint32(table.column(i)));
+        for (int i = 0; i < count; ++i)
+            append(quint32(table.kind(i)));
+    }
+
+    quint64 arraysSize() const { return m_arrays.size(); }
+    const QByteArray &arrays() const { return m_arrays; }
+    const QVector<Id> &strings() const { return m_strings; }
+
+private:
+    QHash<Id, quint32> m_localIds;
+    QVector<Id> m_strings;
+    QByteArray m_arrays;
+};
+
+template <typename T>
+void appendRaw(QByteArray &out, const T &value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void alignTo8(QByteArray &out)
+{
+    while (out.size() % 8)
+        out.append('\0');
+}
+
+}
+
+bool CodeModel::IndexFile::save(const QString &path, const QList<DataPtr> &files)
+{
+    IndexWriter writer;
+    QVector<Entry> entries;
+    entries.reserve(files.size());
+
+    StringTable *strings = StringTable::instance();
+    for (const DataPtr &data : files) {
+        // Editor buffers do not match anything on disk.
+        if (!data || data->fileSize < 0)
+            continue;
+
+        Entry entry;
+        std::memset(&entry, 0, sizeof(entry));
+        entry.lastModified = data->lastModified.toMSecsSinceEpoch();
+        entry.size = data->fileSize;
+        entry.dataOffset = writer.arraysSize();
+        entry.path = writer.local(strings->intern(data->fileName));
+        entry.counts[Entry::Methods] = data->methods.size();
+        entry.counts[Entry::Classes] = data->classes.size();
+        entry.counts[Entry::ConstantsDecl] = data->constantsDecl.size();
+        entry.counts[Entry::Identifiers] = data->identifiers.size();
+        entry.counts[Entry::Constants] = data->constants.size();
+        entry.counts[Entry::Symbols] = data->symbols.size();
+
+        writer.appendSymbols(data->methods);
+        writer.appendSymbols(data->classes);
+        writer.appendSymbols(data->constantsDecl);
+        writer.appendIds(data->identifiers);
+        writer.appendIds(data->constants);
+        writer.appendIds(data->symbols);
+        entries << entry;
+    }
+
+    QByteArray stringData;
+    QVector<quint32> stringOffsets;
+    stringOffsets.reserve(writer.strings().size() + 1);
+    for (Id id : writer.strings()) {
+        stringOffsets << quint32(stringData.size() / sizeof(QChar));
+        const QString str = strings->string(id);
+        stringData.append(reinterpret_cast<const char*>(str.constData()), str.size() * sizeof(QChar));
+    }
+    stringOffsets << quint32(stringData.size() / sizeof(QChar));
+
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, IndexMagic, sizeof(IndexMagic));
+    header.version = IndexVersion;
+    header.byteOrder = IndexByteOrder;
+    header.stringCount = writer.strings().size();
+    header.fileCount = entries.size();
+
+    QByteArray out;
+    out.reserve(sizeof(Header) + stringOffsets.size() * sizeof(quint32) + stringData.size()
+                + entries.size() * sizeof(Entry) + writer.arraysSize() + 32);
+    out.append(sizeof(Header), '\0');
+
+    header.stringOffsetsOffset = out.size();
+    out.append(reinterpret_cast<const char*>(stringOffsets.constData()), stringOffsets.size() * sizeof(quint32));
+    alignTo8(out);
+    header.stringDataOffset = out.size();
+    out.append(stringData);
+    alignTo8(out);
+    header.filesOffset = out.size();
+    const quint64 arraysOffset = header.filesOffset + entries.size() * sizeof(Entry);
+    for (Entry &entry : entries) {
+        entry.dataOffset += arraysOffset;
+        appendRaw(out, entry);
+    }
+    out.append(writer.arrays());
+    std::memcpy(out.data(), &header, sizeof(header));
+
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile file(path);
+    if (!file.open(QFile::WriteOnly) || file.write(out) != out.size() || !file.commit()) {
+        qWarning() << "Could not write the code model index" << path << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+}
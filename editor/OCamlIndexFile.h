@@ -0,0 +1,51 @@
+#ifndef OCaml_IndexFile_h
+#define OCaml_IndexFile_h
+
+#include "OCamlCodeModelData.h"
+
+#include <QFile>
+#include <QHash>
+
+QT_FORWARD_DECLARE_CLASS(QFileInfo)
+
+namespace OCamlCreator {
+
+// Versioned on-disk copy of the code model, memory mapped when loaded.
+// Entries are keyed by path, modification time and size: a file that changed
+// since it was saved is not found and has to be scanned again.
+class CodeModel::IndexFile
+{
+    Q_DISABLE_COPY(IndexFile)
+
+public:
+    explicit IndexFile(const QString &path);
+
+    bool isValid() const { return m_header; }
+    int fileCount() const { return m_entries.size(); }
+
+    // Thread safe. Returns null if the file is not indexed or was modified.
+    DataPtr load(const QString &file, const QFileInfo &info) const;
+
+    static bool save(const QString &path, const QList<DataPtr> &files);
+
+private:
+    struct Header;
+    struct Entry;
+
+    bool checkRange(quint64 offset, quint64 size) const;
+    const quint32 *readSymbols(const quint32 *src, quint32 count, SymbolTable &table, bool *ok) const;
+    const quint32 *readIds(const quint32 *src, quint32 count, QVector<StringTable::Id> &ids, bool *ok) const;
+    StringTable::Id stringId(quint32 index, bool *ok) const;
+
+    QFile m_file;
+    const uchar *m_data;
+    qint64 m_size;
+    const Header *m_header;
+    const quint32 *m_stringOffsets;
+    const QChar *m_stringData;
+    QHash<QString, const Entry*> m_entries;
+};
+
+}
+
+#endif
@@ -0,0 +1,767 @@
+#include "OCamlLexer.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QVector>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace OCamlCreator {
+namespace OCaml {
+
+struct KeywordEntry
+{
+    const char *name;
+    Token::Kind kind;
+};
+
+static constexpr KeywordEntry OCAML_KEYWORDS[] = {
+    { "and", Token::KeywordAnd },
+    { "as", Token::Keyword },
+    { "assert", Token::Keyword },
+    { "asr", Token::Keyword },
+    { "begin", Token::KeywordBegin },
+    { "class", Token::KeywordClass },
+    { "constraint", Token::Keyword },
+    { "do", Token::Keyword },
+    { "done", Token::Keyword },
+    { "downto", Token::Keyword },
+    { "else", Token::Keyword },
+    { "end", Token::KeywordEnd },
+    { "exception", Token::KeywordException },
+    { "external", Token::KeywordExternal },
+    { "false", Token::Keyword },
+    { "for", Token::Keyword },
+    { "fun", Token::Keyword },
+    { "function", Token::Keyword },
+    { "functor", Token::Keyword },
+    { "if", Token::Keyword },
+    { "in", Token::KeywordIn },
+    { "include", Token::KeywordInclude },
+    { "inherit", Token::Keyword },
+    { "initializer", Token::Keyword },
+    { "land", Token::Keyword },
+    { "lazy", Token::Keyword },
+    { "let", Token::KeywordLet },
+    { "lor", Token::Keyword },
+    { "lsl", Token::Keyword },
+    { "lsr", Token::Keyword },
+    { "lxor", Token::Keyword },
+    { "match", Token::Keyword },
+    { "method", Token::Keyword },
+    { "mod", Token::Keyword },
+    { "module", Token::KeywordModule },
+    { "mutable", Token::KeywordModifier },
+    { "new", Token::Keyword },
+    { "nonrec", Token::KeywordModifier },
+    { "object", Token::KeywordObject },
+    { "of", Token::Keyword },
+    { "open", Token::KeywordOpen },
+    { "or", Token::Keyword },
+    { "private", Token::KeywordModifier },
+    { "rec", Token::KeywordRec },
+    { "sig", Token::KeywordSig },
+    { "struct", Token::KeywordStruct },
+    { "then", Token::Keyword },
+    { "to", Token::Keyword },
+    { "true", Token::Keyword },
+    { "try", Token::Keyword },
+    { "type", Token::KeywordType },
+    { "val", Token::KeywordVal },
+    { "virtual", Token::KeywordModifier },
+    { "when", Token::Keyword },
+    { "while", Token::Keyword },
+    { "with", Token::KeywordWith }
+};
+
+// Keywords are found with a perfect hash of their length and their first,
+// second and last characters: one multiplication and one comparison per
+// lower case identifier that gets past the length and first character
+// checks. The multiplier was searched for, the table is built and checked for
+// collisions at compile time, so changing the keywords means searching again.
+namespace KeywordHash {
+
+enum { Count = std::extent<decltype(OCAML_KEYWORDS)>::value, Bits = 7, Size = 1 << Bits, None = 0xff };
+constexpr quint32 Multiplier = 0x6bb454db;
+
+constexpr int slot(quint32 first, quint32 second, quint32 last, quint32 length)
+{
+    return int(((first | second << 8 | last << 16 | length << 24) * Multiplier) >> (32 - Bits));
+}
+
+constexpr int length(const char *name)
+{
+    int length = 0;
+    while (name[length])
+        ++length;
+    return length;
+}
+
+constexpr int slotOf(const char *name)
+{
+    return slot(uchar(name[0]), uchar(name[1]), uchar(name[length(name) - 1]), length(name));
+}
+
+struct Table
+{
+    quint8 entries[Size];
+    int minLength;
+    int maxLength;
+    quint32 firstChars;    // bit c - 'a' is set for each first character c
+    bool perfect;
+};
+
+constexpr Table build()
+{
+    Table table = {};
+    for (int i = 0; i < Size; ++i)
+        table.entries[i] = None;
+    table.minLength = 0xff;
+    table.perfect = true;
+    for (int i = 0; i < Count; ++i) {
+        const char *name = OCAML_KEYWORDS[i].name;
+        const int index = slotOf(name);
+        if (table.entries[index] != None)
+            table.perfect = false;
+        table.entries[index] = quint8(i);
+        table.minLength = length(name) < table.minLength ? length(name) : table.minLength;
+        table.maxLength = length(name) > table.maxLength ? length(name) : table.maxLength;
+        table.firstChars |= 1u << (name[0] - 'a');
+    }
+    return table;
+}
+
+static constexpr Table TABLE = build();
+static_assert(TABLE.perfect, "keywords collide in the hash, search for another multiplier");
+
+}
+
+template <typename Char>
+static Token::Kind keywordKindImpl(const Char *text, int length)
+{
+    using namespace KeywordHash;
+    if (length < TABLE.minLength || length > TABLE.maxLength)
+        return Token::Identifier;
+    const ushort first = codeUnit(text[0]);
+    if (ushort(first - 'a') >= 26 || !(TABLE.firstChars & (1u << (first - 'a'))))
+        return Token::Identifier;
+    const int entry = TABLE.entries[slot(first, codeUnit(text[1]), codeUnit(text[length - 1]), length)];
+    if (entry == None)
+        return Token::Identifier;
+    const char *name = OCAML_KEYWORDS[entry].name;
+    for (int i = 0; i < length; ++i) {
+        if (codeUnit(text[i]) != uchar(name[i]))
+            return Token::Identifier;
+    }
+    return name[length] ? Token::Identifier : OCAML_KEYWORDS[entry].kind;
+}
+
+Token::Kind keywordKind(const QChar *text, int length)
+{
+    return keywordKindImpl(text, length);
+}
+
+Token::Kind keywordKind(const char *text, int length)
+{
+    return keywordKindImpl(text, length);
+}
+
+// Every ASCII character has a class, used to dispatch on the first character
+// of a token, and flags telling which runs of characters it can continue.
+enum CharClass {
+    Class_Other,
+    Class_Space,
+    Class_Newline,
+    Class_Digit,
+    Class_Lower,
+    Class_Upper,
+    Class_Quote,
+    Class_DoubleQuote,
+    Class_Backquote,
+    Class_LabelStart,   // ~ ?
+    Class_OpenParen,
+    Class_CloseParen,
+    Class_OpenBracket,
+    Class_CloseBracket,
+    Class_OpenBrace,
+    Class_CloseBrace,
+    Class_Comma,
+    Class_Semicolon,
+    Class_Bar,
+    Class_Greater,
+    Class_Operator
+};
+
+enum CharFlag {
+    Flag_Identifier = 0x20,
+    Flag_Operator = 0x40,
+    Flag_QuoteId = 0x80,
+    ClassMask = 0x1f
+};
+
+class CharTable
+{
+public:
+    CharTable()
+    {
+        std::fill(m_table, m_table + 128, quint8(Class_Other));
+        for (const char *c = " \t\r\f\v"; *c; ++c)
+            m_table[int(*c)] = Class_Space;
+        m_table[int('\n')] = Class_Newline;
+        for (int c = '0'; c <= '9'; ++c)
+            m_table[c] = Class_Digit | Flag_Identifier;
+        for (int c = 'a'; c <= 'z'; ++c)
+            m_table[c] = Class_Lower | Flag_Identifier | Flag_QuoteId;
+        for (int c = 'A'; c <= 'Z'; ++c)
+            m_table[c] = Class_Upper | Flag_Identifier;
+        m_table[int('_')] = Class_Lower | Flag_Identifier | Flag_QuoteId;
+        m_table[int('\'')] = Class_Quote | Flag_Identifier;
+        m_table[int('"')] = Class_DoubleQuote;
+        m_table[int('`')] = Class_Backquote;
+        for (const char *c = "!$%&*+-./:<=>?@^|~#"; *c; ++c)
+            m_table[int(*c)] = Class_Operator | Flag_Operator;
+        m_table[int('~')] = Class_LabelStart | Flag_Operator;
+        m_table[int('?')] = Class_LabelStart | Flag_Operator;
+        m_table[int('|')] = Class_Bar | Flag_Operator;
+        m_table[int('>')] = Class_Greater | Flag_Operator;
+        m_table[int('(')] = Class_OpenParen;
+        m_table[int(')')] = Class_CloseParen;
+        m_table[int('[')] = Class_OpenBracket;
+        m_table[int(']')] = Class_CloseBracket;
+        m_table[int('{')] = Class_OpenBrace;
+        m_table[int('}')] = Class_CloseBrace;
+        m_table[int(',')] = Class_Comma;
+        m_table[int(';')] = Class_Semicolon;
+    }
+
+    CharClass charClass(QChar ch) const
+    {
+        const ushort u = ch.unicode();
+        if (u < 128)
+            return CharClass(m_table[u] & ClassMask);
+        if (ch.isLetter())
+            return ch.isUpper() ? Class_Upper : Class_Lower;
+        return ch.isSpace() ? Class_Space : Class_Other;
+    }
+
+    bool is(QChar ch, CharFlag flag) const
+    {
+        const ushort u = ch.unicode();
+        if (u < 128)
+            return m_table[u] & flag;
+        return flag == Flag_Identifier && ch.isLetterOrNumber();
+    }
+
+private:
+    quint8 m_table[128];
+};
+
+static const CharTable CHARS;
+
+static bool isOperatorChar(QChar ch)
+{
+    return CHARS.is(ch, Flag_Operator);
+}
+
+static bool isIdentifierChar(QChar ch)
+{
+    return CHARS.is(ch, Flag_Identifier);
+}
+
+static bool isQuoteIdChar(QChar ch)
+{
+    return CHARS.is(ch, Flag_QuoteId);
+}
+
+// The delimiters of {id|quoted strings|id} are interned, the state keeps the
+// index of the id plus one in bits 8 to 25 so that no two ids are confused,
+// zero there meaning no quoted string. Should the table ever fill up, the last
+// value matches any id. The rest of the state int is left to the users of the
+// lexer.
+static const int QuoteIdShift = 8;
+static const int QuoteIdMask = 0x3ffff << QuoteIdShift;
+static const int EmptyQuoteId = 1 << QuoteIdShift;
+
+// Inside comments, strings are lexed too so that "*)" in one doesn't end the
+// comment. Bit 7 tells the comment ended inside of a "string", the quote id
+// bits inside of a {|quoted string|}.
+static const int CommentStringFlag = 1 << 7;
+
+class QuoteIds
+{
+public:
+    template <typename Char>
+    int code(const Char *id, int length)
+    {
+        if (length == 0)
+            return EmptyQuoteId;
+        const QByteArray key = toKey(id, length);
+        QMutexLocker locker(&m_mutex);
+        int index = m_indexes.value(key, -1);
+        if (index < 0) {
+            if (m_ids.size() + 2 >= (QuoteIdMask >> QuoteIdShift))
+                return QuoteIdMask;
+            index = m_ids.size();
+            m_ids << key;
+            m_indexes.insert(key, index);
+        }
+        return (index + 2) << QuoteIdShift;
+    }
+
+    template <typename Char>
+    bool matches(int state, const Char *id, int length)
+    {
+        const int code = state & QuoteIdMask;
+        if (code == QuoteIdMask)
+            return true;
+        if (code == EmptyQuoteId || length == 0)
+            return code == EmptyQuoteId && length == 0;
+        QMutexLocker locker(&m_mutex);
+        const QByteArray &stored = m_ids.at((code >> QuoteIdShift) - 2);
+        if (stored.size() != length)
+            return false;
+        for (int i = 0; i < length; ++i) {
+            if (codeUnit(id[i]) != uchar(stored.at(i)))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    // Quote ids are ASCII.
+    template <typename Char>
+    static QByteArray toKey(const Char *id, int length)
+    {
+        QByteArray key(length, Qt::Uninitialized);
+        for (int i = 0; i < length; ++i)
+            key[i] = char(codeUnit(id[i]));
+        return key;
+    }
+
+    QMutex m_mutex;
+    QVector<QByteArray> m_ids;
+    QHash<QByteArray, int> m_indexes;
+};
+
+static QuoteIds QUOTE_IDS;
+
+template <typename Stream>
+BasicLexer<Stream>::BasicLexer(const Stream &src)
+    : m_src(src)
+    , m_state(0)
+    , m_line(1)
+    , m_lineStartOffset(src.position())
+{
+}
+
+template <typename Stream>
+Token BasicLexer<Stream>::read()
+{
+    m_src.setAnchor();
+    if (m_src.isEnd())
+        return Token(Token::EndOfText, m_src.position(), 0);
+
+    switch (stateKind()) {
+    case State_Comment:
+        return readComment();
+    case State_String:
+        return readString();
+    case State_QuotedString:
+        return readQuotedString();
+    case State_Default:
+        break;
+    }
+
+    const QChar first = m_src.peek();
+    const QChar second = m_src.peek(1);
+
+    switch (CHARS.charClass(first)) {
+    case Class_Space:
+        return readWhitespace();
+    case Class_Newline:
+        m_src.move();
+        newLine();
+        return Token(Token::Whitespace, m_src.anchor(), m_src.length());
+    case Class_Digit:
+        return readNumber();
+    case Class_Lower:
+        return readIdentifier();
+    case Class_Upper:
+        consumeIdentifierChars();
+        return Token(Token::Capitalized, m_src.anchor(), m_src.length());
+    case Class_Quote:
+        return readQuote();
+    case Class_DoubleQuote:
+        m_src.move();
+        m_state = State_String;
+        return readString();
+    case Class_Backquote:
+        if (CHARS.charClass(second) == Class_Lower || CHARS.charClass(second) == Class_Upper) {
+            m_src.move();
+            consumeIdentifierChars();
+            return Token(Token::PolyVariant, m_src.anchor(), m_src.length());
+        }
+        return punctuation(Token::Operator);
+    case Class_LabelStart:
+        if (CHARS.charClass(second) == Class_Lower) {
+            m_src.move();
+            consumeIdentifierChars();
+            if (m_src.peek() == QLatin1Char(':') && m_src.peek(1) != QLatin1Char(':')
+                    && m_src.peek(1) != QLatin1Char('='))
+                m_src.move();
+            return Token(Token::Label, m_src.anchor(), m_src.length());
+        }
+        return readOperator();
+    case Class_OpenParen:
+        if (second == QLatin1Char('*')) {
+            m_src.move();
+            m_src.move();
+            m_state = State_Comment;
+            setCommentDepth(1);
+            return readComment();
+        }
+        return punctuation(Token::OpenParen);
+    case Class_CloseParen:
+        return punctuation(Token::CloseParen);
+    case Class_OpenBracket:
+        return punctuation(Token::OpenBracket, second == QLatin1Char('|') ? 2 : 1);
+    case Class_CloseBracket:
+        return punctuation(Token::CloseBracket);
+    case Class_OpenBrace:
+        if (isQuotedStringStart()) {
+            m_src.move();
+            const int idStart = m_src.position();
+            while (m_src.peek() != QLatin1Char('|'))
+                m_src.move();
+            m_state = State_QuotedString | QUOTE_IDS.code(m_src.constData() + idStart,
+                                                          m_src.position() - idStart);
+            m_src.move();
+            return readQuotedString();
+        }
+        return punctuation(Token::OpenBrace, second == QLatin1Char('<') ? 2 : 1);
+    case Class_CloseBrace:
+        return punctuation(Token::CloseBrace);
+    case Class_Comma:
+        return punctuation(Token::Comma);
+    case Class_Semicolon:
+        if (second == QLatin1Char(';'))
+            return punctuation(Token::DoubleSemicolon, 2);
+        return punctuation(Token::Semicolon);
+    case Class_Bar:
+        if (second == QLatin1Char(']'))
+            return punctuation(Token::CloseBracket, 2);
+        return readOperator();
+    case Class_Greater:
+        if (second == QLatin1Char('}'))
+            return punctuation(Token::CloseBrace, 2);
+        return readOperator();
+    case Class_Operator:
+        return readOperator();
+    case Class_Other:
+        break;
+    }
+    return punctuation(Token::Operator);
+}
+
+template <typename Stream>
+Token BasicLexer<Stream>::punctuation(Token::Kind kind, int length)
+{
+    for (int i = 0; i < length; ++i)
+        m_src.move();
+    return Token(kind, m_src.anchor(), m_src.length());
+}
+
+template <typename Stream>
+void BasicLexer<Stream>::newLine()
+{
+    m_line++;
+    m_lineStartOffset = m_src.position();
+}
+
+template <typename Stream>
+void BasicLexer<Stream>::setCommentDepth(int depth)
+{
+    m_state = (m_state & ~(0x1f << 2)) | (qBound(0, depth, 0x1f) << 2);
+}
+
+template <typename Stream>
+bool BasicLexer<Stream>::isQuotedStringStart() const
+{
+    int i = 1;
+    while (isQuoteIdChar(m_src.peek(i)))
+        ++i;
+    return m_src.peek(i) == QLatin1Char('|');
+}
+
+template <typename Stream>
+bool BasicLexer<Stream>::matchesQuoteId(int position, int length) const
+{
+    return QUOTE_IDS.matches(m_state, m_src.constData() + position, length);
+}
+
+template <typename Stream>
+void BasicLexer<Stream>::consumeIdentifierChars()
+{
+    forever {
+        m_src.skipIdentifierChars();
+        // Non ASCII letters
+        if (!isIdentifierChar(m_src.peek()))
+            break;
+        m_src.move();
+    }
+}
+
+/**
+  reads a (possibly nested) comment up to its end or the end of the text
+  */
+template <typename Stream>
+Token BasicLexer<Stream>::readComment()
+{
+    forever {
+        if (m_state & CommentStringFlag) {
+            if (!skipString())
+                break;
+            m_state &= ~CommentStringFlag;
+        } else if (m_state & QuoteIdMask) {
+            if (!skipQuotedString())
+                break;
+            m_state &= ~QuoteIdMask;
+        }
+
+        // The "(" of a nested "(*" and the "{id" of a quoted string are looked
+        // back at from the character after them.
+        m_src.skipToAny('\n', '*', '"', '|');
+        const QChar ch = m_src.peek();
+        if (ch.isNull())
+            break;
+        const int position = m_src.position();
+        if (ch == QLatin1Char('\n')) {
+            m_src.move();
+            newLine();
+        } else if (ch == QLatin1Char('*')) {
+            m_src.move();
+            if (position > 0 && m_src.peek(-2) == QLatin1Char('(')) {
+                setCommentDepth(commentDepth() + 1);
+            } else if (m_src.peek() == QLatin1Char(')')) {
+                m_src.move();
+                const int depth = commentDepth() - 1;
+                setCommentDepth(depth);
+                if (depth <= 0) {
+                    m_state = 0;
+                    break;
+                }
+            }
+        } else if (ch == QLatin1Char('"')) {
+            m_src.move();
+            // Not the character literals '"' and '\"'
+            const bool charLiteral = m_src.peek() == QLatin1Char('\'')
+                    && ((position > 0 && m_src.peek(-2) == QLatin1Char('\''))
+                        || (position > 1 && m_src.peek(-2) == QLatin1Char('\\')
+                            && m_src.peek(-3) == QLatin1Char('\'')));
+            if (!charLiteral)
+                m_state |= CommentStringFlag;
+        } else {
+            int idStart = position;
+            while (idStart > 0 && isQuoteIdChar(m_src.peek(idStart - 1 - position)))
+                --idStart;
+            m_src.move();
+            if (idStart > 0 && m_src.peek(idStart - 2 - position) == QLatin1Char('{'))
+                m_state |= QUOTE_IDS.code(m_src.constData() + idStart, position - idStart);
+        }
+    }
+    return Token(Token::Comment, m_src.anchor(), m_src.length());
+}
+
+template <typename Stream>
+Token BasicLexer<Stream>::readString()
+{
+    if (skipString())
+        m_state = 0;
+    return Token(Token::String, m_src.anchor(), m_src.length());
+}
+
+template <typename Stream>
+Token BasicLexer<Stream>::readQuotedString()
+{
+    if (skipQuotedString())
+        m_state = 0;
+    return Token(Token::String, m_src.anchor(), m_src.length());
+}
+
+/**
+  moves past the closing quote of a string, false when the text ends first
+  */
+template <typename Stream>
+bool BasicLexer<Stream>::skipString()
+{
+    forever {
+        m_src.skipToAny('\n', '\\', '"');
+        const QChar ch = m_src.peek();
+        if (ch.isNull())
+            return false;
+        m_src.move();
+        if (ch == QLatin1Char('\n')) {
+            newLine();
+        } else if (ch == QLatin1Char('\\')) {
+            if (m_src.peek() == QLatin1Char('\n')) {
+                m_src.move();
+                newLine();
+            } else if (!m_src.isEnd()) {
+                m_src.move();
+            }
+        } else if (ch == QLatin1Char('"')) {
+            return true;
+        }
+    }
+}
+
+/**
+  moves past the |id} closing a quoted string, false when the text ends first
+  */
+template <typename Stream>
+bool BasicLexer<Stream>::skipQuotedString()
+{
+    forever {
+        m_src.skipToAny('\n', '|', '|');
+        const QChar ch = m_src.peek();
+        if (ch.isNull())
+            return false;
+        m_src.move();
+        if (ch == QLatin1Char('\n')) {
+            newLine();
+        } else if (ch == QLatin1Char('|')) {
+            const int idStart = m_src.position();
+            int i = 0;
+            while (isQuoteIdChar(m_src.peek(i)))
+                ++i;
+            if (m_src.peek(i) == QLatin1Char('}') && matchesQuoteId(idStart, i)) {
+                for (; i >= 0; --i)
+                    m_src.move();
+                return true;
+            }
+        }
+    }
+}
+
+/**
+  reads a lower case identifier and tells keywords apart
+  */
+template <typename Stream>
+Token BasicLexer<Stream>::readIdentifier()
+{
+    consumeIdentifierChars();
+    Token::Kind kind = keywordKind(m_src.constData() + m_src.anchor(), m_src.length());
+    // Extension nodes: let%lwt, match%ext.sub ... are the keyword.
+    if (kind != Token::Identifier && m_src.peek() == QLatin1Char('%')
+            && CHARS.charClass(m_src.peek(1)) == Class_Lower) {
+        do {
+            m_src.move();
+            consumeIdentifierChars();
+        } while (m_src.peek() == QLatin1Char('.') && isIdentifierChar(m_src.peek(1)));
+        return Token(kind, m_src.anchor(), m_src.length());
+    }
+    // Binding operators: let* and+ ...
+    if ((kind == Token::KeywordLet || kind == Token::KeywordAnd) && isOperatorChar(m_src.peek())
+            && m_src.peek() != QLatin1Char('.') && m_src.peek() != QLatin1Char(':')
+            && m_src.peek() != QLatin1Char('%')) {
+        while (isOperatorChar(m_src.peek()))
+            m_src.move();
+        kind = Token::Operator;
+    }
+    return Token(kind, m_src.anchor(), m_src.length());
+}
+
+template <typename Stream>
+Token BasicLexer<Stream>::readNumber()
+{
+    const bool hex = m_src.peek() == QLatin1Char('0')
+            && (m_src.peek(1) == QLatin1Char('x') || m_src.peek(1) == QLatin1Char('X'));
+    QChar previous;
+    forever {
+        const QChar ch = m_src.peek();
+        const bool exponentSign = !hex && (ch == QLatin1Char('+') || ch == QLatin1Char('-'))
+                && (previous == QLatin1Char('e') || previous == QLatin1Char('E'));
+        if (!ch.isLetterOrNumber() && ch != QLatin1Char('_') && ch != QLatin1Char('.') && !exponentSign)
+            break;
+        m_src.move();
+        previous = ch;
+    }
+    return Token(Token::Number, m_src.anchor(), m_src.length());
+}
+
+/**
+  reads a character literal or a type variable
+  */
+template <typename Stream>
+Token BasicLexer<Stream>::readQuote()
+{
+    m_src.move();
+    const QChar ch = m_src.peek();
+    if (ch == QLatin1Char('\\')) {
+        m_src.move();
+        m_src.move();
+        for (int i = 0; i < 8; ++i) {
+            const QChar next = m_src.peek();
+            if (next.isNull() || next == QLatin1Char('\n'))
+                break;
+            m_src.move();
+            if (next == QLatin1Char('\''))
+                break;
+        }
+        return Token(Token::Char, m_src.anchor(), m_src.length());
+    }
+    if (!ch.isNull() && ch != QLatin1Char('\n') && m_src.peek(1) == QLatin1Char('\'')) {
+        m_src.move();
+        m_src.move();
+        return Token(Token::Char, m_src.anchor(), m_src.length());
+    }
+    if (ch.isLetter() || ch == QLatin1Char('_')) {
+        consumeIdentifierChars();
+        return Token(Token::TypeVariable, m_src.anchor(), m_src.length());
+    }
+    return Token(Token::Operator, m_src.anchor(), m_src.length());
+}
+
+/**
+  reads punctuation symbols, excluding some special
+  */
+template <typename Stream>
+Token BasicLexer<Stream>::readOperator()
+{
+    while (isOperatorChar(m_src.peek()))
+        m_src.move();
+
+    Token::Kind kind = Token::Operator;
+    if (m_src.length() == 1) {
+        switch (codeUnit(m_src.constData()[m_src.anchor()])) {
+        case '.': kind = Token::Dot; break;
+        case ':': kind = Token::Colon; break;
+        case '=': kind = Token::Equal; break;
+        case '|': kind = Token::Bar; break;
+        default: break;
+        }
+    }
+    return Token(kind, m_src.anchor(), m_src.length());
+}
+
+/**
+  reads whitespace up to the end of the line, a line feed is a token on its own
+  */
+template <typename Stream>
+Token BasicLexer<Stream>::readWhitespace()
+{
+    m_src.skipBlanks();
+    QChar ch = m_src.peek();
+    while (ch.isSpace() && ch != QLatin1Char('\n')) {
+        m_src.move();
+        ch = m_src.peek();
+    }
+    return Token(Token::Whitespace, m_src.anchor(), m_src.length());
+}
+template class BasicLexer<SourceCodeStream>;
+template class BasicLexer<Utf8SourceCodeStream>;
+
+}
+}
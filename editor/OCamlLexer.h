@@ -0,0 +1,157 @@
+#ifndef OCaml_Lexer_h
+#define OCaml_Lexer_h
+
+#include "SourceCodeStream.h"
+
+#include <QString>
+
+namespace OCamlCreator {
+namespace OCaml {
+
+class Token
+{
+public:
+    enum Kind
+    {
+        Whitespace,
+        Comment,
+        String,
+        Char,
+        Number,
+        Identifier,
+        Capitalized,    // module, constructor or exception name
+        TypeVariable,   // 'a
+        Label,          // ~name: or ?name:
+        PolyVariant,    // `Name
+        Keyword,
+
+        // Keywords the declaration scanner cares about.
+        KeywordLet,
+        KeywordRec,
+        KeywordAnd,
+        KeywordIn,
+        KeywordType,
+        KeywordModule,
+        KeywordVal,
+        KeywordExternal,
+        KeywordException,
+        KeywordClass,
+        KeywordStruct,
+        KeywordSig,
+        KeywordObject,
+        KeywordBegin,
+        KeywordEnd,
+        KeywordOpen,
+        KeywordInclude,
+        KeywordWith,
+        KeywordModifier,    // mutable, nonrec, private, virtual
+
+        Operator,
+        Dot,
+        Comma,
+        Colon,
+        Semicolon,
+        DoubleSemicolon,
+        Equal,
+        Bar,
+        OpenParen,
+        CloseParen,
+        OpenBracket,
+        CloseBracket,
+        OpenBrace,
+        CloseBrace,
+
+        EndOfText
+    };
+
+    Token(Kind kind = EndOfText, int position = 0, int length = 0)
+        : kind(kind), position(position), length(length)
+    {}
+
+    bool isKeyword() const { return kind >= Keyword && kind <= KeywordModifier; }
+
+    Kind kind;
+    int position;
+    int length;
+};
+
+// Kind of the keyword in [text, text + length), Identifier if it is none.
+Token::Kind keywordKind(const QChar *text, int length);
+Token::Kind keywordKind(const char *text, int length);
+
+// Splits OCaml source in tokens. Comments and strings may span several lines,
+// state() tells in which of them the text ended so that the next piece of text
+// (e.g. the next line of a document) can be read with setState().
+// Stream is SourceCodeStream for QString text, Utf8SourceCodeStream for bytes.
+template <typename Stream>
+class BasicLexer
+{
+    Q_DISABLE_COPY(BasicLexer)
+
+public:
+    typedef typename Stream::Char Char;
+
+    BasicLexer(const Stream &src);
+
+    Token read();
+
+    // Bits of the state the lexer uses, callers may keep their own data above.
+    enum { StateBits = 26, StateMask = (1 << StateBits) - 1 };
+
+    // 0 when the text ended outside of any comment or string.
+    int state() const { return m_state; }
+    void setState(int state) { m_state = state; }
+
+    void setLine(int line) { m_line = line; }
+    int currentLine() const { return m_line; }
+    int currentColumn(const Token &token) const { return m_src.column(m_lineStartOffset, token.position); }
+    bool atLineEnd() const { return m_src.peek() == QLatin1Char('\n'); }
+
+    // Text of a token read by this lexer.
+    QString text(const Token &token) const { return m_src.text(token.position, token.length); }
+    bool textIs(const Token &token, const char *ascii) const
+    {
+        return m_src.compare(token.position, token.length, ascii) == 0;
+    }
+    const Char *constData() const { return m_src.constData(); }
+
+private:
+    enum StateKind { State_Default, State_Comment, State_String, State_QuotedString };
+
+    Token readComment();
+    Token readString();
+    Token readQuotedString();
+    bool skipString();
+    bool skipQuotedString();
+    Token readIdentifier();
+    Token readNumber();
+    Token readQuote();
+    Token readOperator();
+    Token readWhitespace();
+    Token punctuation(Token::Kind kind, int length = 1);
+
+    bool isQuotedStringStart() const;
+    void consumeIdentifierChars();
+    void newLine();
+
+    StateKind stateKind() const { return StateKind(m_state & 0x3); }
+    int commentDepth() const { return (m_state >> 2) & 0x1f; }
+    void setCommentDepth(int depth);
+    bool matchesQuoteId(int position, int length) const;
+
+    Stream m_src;
+    int m_state;
+    int m_line;
+    int m_lineStartOffset;
+};
+
+typedef BasicLexer<SourceCodeStream> Lexer;
+typedef BasicLexer<Utf8SourceCodeStream> Utf8Lexer;
+
+extern template class BasicLexer<SourceCodeStream>;
+extern template class BasicLexer<Utf8SourceCodeStream>;
+
+}
+}
+
+#endif
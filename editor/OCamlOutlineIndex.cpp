@@ -0,0 +1,326 @@
+#include "OCamlOutlineIndex.h"
+#include "OCamlDeclarationScanner.h"
+#include "RubyRubocopHighlighter.h"
+#include "../RubyConstants.h"
+
+#include <coreplugin/documentmanager.h>
+#include <coreplugin/progressmanager/progressmanager.h>
+
+#include <utils/runextensions.h>
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QSaveFile>
+#include <QtConcurrent>
+#include <QDebug>
+
+namespace OCamlCreator {
+
+static const quint32 CacheMagic = 0x4f434f4c; // "OCOL"
+static const quint32 CacheVersion = 1;
+// Per file, merlin usually answers well within a second.
+static const int MerlinTimeout = 30000;
+
+// Merlin's outline kinds, see the "outline" command in merlin's PROTOCOL.md.
+static Symbol::Kind kindFor(const QString &kind)
+{
+    if (kind == QLatin1String("Type") || kind == QLatin1String("Constructor"))
+        return Symbol::Type;
+    if (kind == QLatin1String("Exn"))
+        return Symbol::Exception;
+    if (kind == QLatin1String("Module"))
+        return Symbol::Module;
+    if (kind == QLatin1String("Modtype"))
+        return Symbol::ModuleType;
+    if (kind == QLatin1String("Class") || kind == QLatin1String("ClassType"))
+        return Symbol::Class;
+    return Symbol::Value;
+}
+
+static void appendOutline(const QJsonArray &items, const QString &fileName, const QString &context,
+                          QList<Symbol> &symbols)
+{
+    for (const QJsonValue &value : items) {
+        const QJsonObject item = value.toObject();
+        const QJsonObject start = item.value("start").toObject();
+        Symbol symbol(fileName);
+        symbol.name = item.value("name").toString();
+        symbol.context = context;
+        symbol.line = start.value("line").toInt();
+        symbol.column = start.value("col").toInt();
+        symbol.kind = kindFor(item.value("kind").toString());
+        symbols << symbol;
+
+        const QJsonArray children = item.value("children").toArray();
+        if (!children.isEmpty())
+            appendOutline(children, fileName, context + QLatin1Char('.') + symbol.name, symbols);
+    }
+}
+
+// Blocks until merlin answers. Sets *started to false when merlin could not be run at all.
+static bool outline(const QString &fileName, const QByteArray &contents, QList<Symbol> &symbols,
+                    bool *started)
+{
+    QProcess merlin;
+    merlin.start(RubocopHighlighter::merlinExecutable(),
+                 QStringList { "single", "outline", "-filename", fileName }
+                 + RubocopHighlighter::merlinFlags(fileName));
+    *started = merlin.waitForStarted(MerlinTimeout);
+    if (!*started)
+        return false;
+
+    merlin.write(contents);
+    merlin.closeWriteChannel();
+    if (!merlin.waitForFinished(MerlinTimeout)) {
+        merlin.kill();
+        merlin.waitForFinished();
+        return false;
+    }
+
+    const QJsonObject root = QJsonDocument::fromJson(merlin.readAllStandardOutput()).object();
+    if (root.value("class").toString() != QLatin1String("return")) {
+        qWarning() << "merlin outline failed for" << fileName << root.value("value");
+        return false;
+    }
+    appendOutline(root.value("value").toArray(), fileName,
+                  OCaml::DeclarationScanner::moduleNameFor(fileName), symbols);
+    return true;
+}
+
+OutlineIndex::OutlineIndex()
+    : m_table(std::make_shared<const Table>())
+    , m_revision(0)
+{
+    m_pool.setMaxThreadCount(1);
+    connect(Core::DocumentManager::instance(), &Core::DocumentManager::filesChangedInternally,
+            this, &OutlineIndex::onFilesChanged);
+}
+
+OutlineIndex::~OutlineIndex()
+{
+    for (QFutureWatcher<OutlinePtr> *watcher : m_refreshes) {
+        watcher->disconnect(this);
+        watcher->cancel();
+        watcher->waitForFinished();
+    }
+    qDeleteAll(m_refreshes);
+    m_pool.waitForDone();
+}
+
+OutlineIndex *OutlineIndex::instance()
+{
+    static OutlineIndex index;
+    return &index;
+}
+
+std::shared_ptr<const OutlineIndex::Table> OutlineIndex::table() const
+{
+    return std::atomic_load(&m_table);
+}
+
+void OutlineIndex::refresh(const QStringList &files, const QString &cacheFile)
+{
+    QStringList sources;
+    for (const QString &file : files) {
+        if (file.endsWith(".ml") || file.endsWith(".mli"))
+            sources << file;
+    }
+    if (sources.isEmpty())
+        return;
+
+    const bool readCache = !cacheFile.isEmpty() && !m_cacheFiles.contains(cacheFile);
+    if (!cacheFile.isEmpty())
+        m_cacheFiles[cacheFile] += sources.toSet();
+
+    auto watcher = new QFutureWatcher<OutlinePtr>;
+    m_refreshes << watcher;
+    connect(watcher, &QFutureWatcherBase::resultsReadyAt, this, [this, watcher](int begin, int end) {
+        QList<OutlinePtr> outlines;
+        for (int i = begin; i < end; ++i)
+            outlines << watcher->resultAt(i);
+        merge(outlines);
+    });
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, cacheFile] {
+        m_refreshes.removeOne(watcher);
+        watcher->deleteLater();
+        if (!cacheFile.isEmpty() && watcher->future().resultCount() > 0)
+            scheduleSave(cacheFile);
+    });
+
+    QFuture<OutlinePtr> future = Utils::runAsync(&m_pool, QThread::LowestPriority,
+                                                 &OutlineIndex::outlineFiles, sources, table(),
+                                                 cacheFile, readCache);
+    watcher->setFuture(future);
+    Core::ProgressManager::addTask(future, tr("Outlining OCaml files"), Constants::TASK_OUTLINE);
+}
+
+void OutlineIndex::removeFile(const QString &file)
+{
+    for (QSet<QString> &files : m_cacheFiles)
+        files.remove(file);
+
+    QMutexLocker locker(&m_writeMutex);
+    auto next = std::make_shared<Table>(*m_table);
+    if (next->remove(file)) {
+        std::atomic_store(&m_table, std::shared_ptr<const Table>(next));
+        ++m_revision;
+    }
+}
+
+// Files saved from the editor, outlined again if they belong to a project.
+void OutlineIndex::onFilesChanged(const QStringList &files)
+{
+    QHash<QString, QStringList> changed;
+    for (auto it = m_cacheFiles.cbegin(); it != m_cacheFiles.cend(); ++it) {
+        for (const QString &file : files) {
+            if (it.value().contains(file))
+                changed[it.key()] << file;
+        }
+    }
+    for (auto it = changed.cbegin(); it != changed.cend(); ++it)
+        refresh(it.value(), it.key());
+}
+
+QList<Symbol> OutlineIndex::allSymbols() const
+{
+    QList<Symbol> result;
+    const auto outlines = table();
+    for (const OutlinePtr &outline : *outlines)
+        result += outline->symbols;
+    return result;
+}
+
+void OutlineIndex::merge(const QList<OutlinePtr> &outlines)
+{
+    if (outlines.isEmpty())
+        return;
+
+    QMutexLocker locker(&m_writeMutex);
+    auto next = std::make_shared<Table>(*m_table);
+    for (const OutlinePtr &outline : outlines)
+        next->insert(outline->fileName, outline);
+    std::atomic_store(&m_table, std::shared_ptr<const Table>(next));
+    ++m_revision;
+}
+
+void OutlineIndex::scheduleSave(const QString &cacheFile)
+{
+    QList<OutlinePtr> outlines;
+    const auto current = table();
+    for (const QString &file : m_cacheFiles.value(cacheFile)) {
+        if (const OutlinePtr outline = current->value(file))
+            outlines << outline;
+    }
+    QtConcurrent::run(&m_pool, &OutlineIndex::saveCache, cacheFile, outlines);
+}
+
+// Runs on the outline thread. Reports an outline for every file that is new
+// or changed, taken from the cache when its hash is there, from merlin otherwise.
+void OutlineIndex::outlineFiles(QFutureInterface<OutlinePtr> &future, const QStringList &files,
+                                std::shared_ptr<const Table> known, const QString &cacheFile,
+                                bool readCache)
+{
+    const Table cached = readCache ? loadCache(cacheFile) : Table();
+    future.setProgressRange(0, files.size());
+
+    bool merlinStarted = true;
+    for (int i = 0; i < files.size() && merlinStarted; ++i) {
+        if (future.isCanceled())
+            break;
+        future.setProgressValue(i);
+
+        const QString &fileName = files.at(i);
+        QFile file(fileName);
+        if (!file.open(QFile::ReadOnly))
+            continue;
+        const QByteArray contents = file.readAll();
+        const QByteArray hash = QCryptographicHash::hash(contents, QCryptographicHash::Sha1);
+
+        const OutlinePtr current = known->value(fileName);
+        if (current && current->contentHash == hash)
+            continue;
+        const OutlinePtr fromCache = cached.value(fileName);
+        if (fromCache && fromCache->contentHash == hash) {
+            future.reportResult(fromCache);
+            continue;
+        }
+
+        auto result = std::make_shared<Outline>();
+        result->fileName = fileName;
+        result->contentHash = hash;
+        if (outline(fileName, contents, result->symbols, &merlinStarted))
+            future.reportResult(OutlinePtr(result));
+    }
+
+    if (!merlinStarted)
+        qWarning() << "Could not start" << RubocopHighlighter::merlinExecutable() << "to outline files";
+}
+
+// Layout: magic, version, file count, then per file its name, content hash,
+// and symbols as name, context, line, column and kind.
+OutlineIndex::Table OutlineIndex::loadCache(const QString &cacheFile)
+{
+    Table table;
+    QFile file(cacheFile);
+    if (!file.open(QFile::ReadOnly))
+        return table;
+
+    QDataStream in(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint32 fileCount = 0;
+    in >> magic >> version >> fileCount;
+    if (magic != CacheMagic || version != CacheVersion || fileCount < 0)
+        return table;
+
+    for (qint32 i = 0; i < fileCount && in.status() == QDataStream::Ok; ++i) {
+        auto outline = std::make_shared<Outline>();
+        qint32 symbolCount = 0;
+        in >> outline->fileName >> outline->contentHash >> symbolCount;
+        for (qint32 j = 0; j < symbolCount && in.status() == QDataStream::Ok; ++j) {
+            Symbol symbol(outline->fileName);
+            qint32 line, column;
+            quint8 kind;
+            in >> symbol.name >> symbol.context >> line >> column >> kind;
+            symbol.line = line;
+            symbol.column = column;
+            symbol.kind = Symbol::Kind(qMin<quint8>(kind, Symbol::Class));
+            outline->symbols << symbol;
+        }
+        table.insert(outline->fileName, outline);
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qWarning() << "Ignoring corrupt outline cache" << cacheFile;
+        return Table();
+    }
+    return table;
+}
+
+bool OutlineIndex::saveCache(const QString &cacheFile, const QList<OutlinePtr> &outlines)
+{
+    QDir().mkpath(QFileInfo(cacheFile).absolutePath());
+    QSaveFile file(cacheFile);
+    if (!file.open(QFile::WriteOnly))
+        return false;
+
+    QDataStream out(&file);
+    out << CacheMagic << CacheVersion << qint32(outlines.size());
+    for (const OutlinePtr &outline : outlines) {
+        out << outline->fileName << outline->contentHash << qint32(outline->symbols.size());
+        for (const Symbol &symbol : outline->symbols) {
+            out << symbol.name << symbol.context << qint32(symbol.line) << qint32(symbol.column)
+                << quint8(symbol.kind);
+        }
+    }
+    return file.commit();
+}
+
+}
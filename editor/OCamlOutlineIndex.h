@@ -0,0 +1,79 @@
+#ifndef OCaml_OutlineIndex_h
+#define OCaml_OutlineIndex_h
+
+#include "RubySymbol.h"
+
+#include <QFutureWatcher>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QThreadPool>
+
+#include <atomic>
+#include <memory>
+
+namespace OCamlCreator {
+
+// Project wide symbol table made of merlin "outline" results, one per file,
+// keyed by a hash of the file contents so that only files that changed are
+// outlined again. Outlining runs on a single low priority thread, readers use
+// the current table without ever waiting for merlin. Like the code model the
+// table is an immutable snapshot swapped atomically.
+class OutlineIndex : public QObject
+{
+    Q_OBJECT
+
+    Q_DISABLE_COPY(OutlineIndex)
+
+public:
+    struct Outline
+    {
+        QString fileName;
+        QByteArray contentHash;
+        QList<Symbol> symbols;
+    };
+    typedef std::shared_ptr<const Outline> OutlinePtr;
+
+    OutlineIndex();
+    ~OutlineIndex();
+
+    static OutlineIndex *instance();
+
+    // Outlines the files whose contents changed since they were last outlined.
+    // cacheFile keeps the outlines between sessions, the first refresh of a
+    // session takes whatever it can from it.
+    void refresh(const QStringList &files, const QString &cacheFile);
+    void removeFile(const QString &file);
+
+    QList<Symbol> allSymbols() const;
+    quint64 revision() const { return m_revision.load(); }
+
+private:
+    typedef QHash<QString, OutlinePtr> Table;
+
+    static void outlineFiles(QFutureInterface<OutlinePtr> &future, const QStringList &files,
+                             std::shared_ptr<const Table> known, const QString &cacheFile,
+                             bool readCache);
+    static Table loadCache(const QString &cacheFile);
+    static bool saveCache(const QString &cacheFile, const QList<OutlinePtr> &outlines);
+
+    void onFilesChanged(const QStringList &files);
+    void merge(const QList<OutlinePtr> &outlines);
+    void scheduleSave(const QString &cacheFile);
+    std::shared_ptr<const Table> table() const;
+
+    std::shared_ptr<const Table> m_table;
+    QMutex m_writeMutex;
+    std::atomic<quint64> m_revision;
+    // Files outlined for each cache, only touched from the GUI thread.
+    QHash<QString, QSet<QString>> m_cacheFiles;
+    QList<QFutureWatcher<OutlinePtr>*> m_refreshes;
+    // A single thread: merlin is heavy and the cache writes must not overlap.
+    QThreadPool m_pool;
+};
+
+}
+
+#endif
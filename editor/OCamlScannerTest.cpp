@@ -0,0 +1,299 @@
+#include "../RubyPlugin.h"
+#include "../editor/OCamlDeclarationScanner.h"
+#include "../editor/OCamlFuzzyIndex.h"
+#include "../editor/OCamlSemanticHighlighter.h"
+#include "../projectmanager/OCamlDuneProject.h"
+#include "../projectmanager/OCamlProjectCrawler.h"
+#include "../projectmanager/OCamlSexp.h"
+
+#include <QtTest/QtTest>
+
+namespace OCamlCreator {
+
+typedef QVector<OCaml::Token::Kind> OCamlTokens;
+
+static OCamlTokens lex(const QByteArray &code, int *state = 0, int startState = 0)
+{
+    const QString text = QString::fromUtf8(code);
+    OCaml::Lexer lexer(&text);
+    lexer.setState(startState);
+    OCamlTokens tokens;
+    OCaml::Token token;
+    while ((token = lexer.read()).kind != OCaml::Token::EndOfText) {
+        if (token.kind != OCaml::Token::Whitespace)
+            tokens << token.kind;
+    }
+    if (state)
+        *state = lexer.state();
+    return tokens;
+}
+
+// "Context.name:kind" for every declaration found.
+static QStringList declarations(const QByteArray &code)
+{
+    const QString text = QString::fromUtf8(code);
+    OCaml::DeclarationScanner scanner(&text, QLatin1String("Test"));
+    QStringList result;
+    OCaml::Token token;
+    while ((token = scanner.read()).kind != OCaml::Token::EndOfText) {
+        if (scanner.isDeclaration()) {
+            result << QString::fromLatin1("%1.%2:%3").arg(scanner.contextName())
+                      .arg(text.mid(token.position, token.length)).arg(scanner.declarationKind());
+        }
+    }
+    return result;
+}
+
+void Plugin::test_ocamlComments()
+{
+    OCamlTokens expectedTokens = { OCaml::Token::Comment, OCaml::Token::Identifier };
+    QCOMPARE(lex("(* a (* nested *) comment *) x"), expectedTokens);
+
+    int state = 0;
+    expectedTokens = { OCaml::Token::Comment };
+    QCOMPARE(lex("(* open (* twice", &state), expectedTokens);
+    QVERIFY(state != 0);
+
+    // Strings in comments are lexed too, "*)" in them doesn't close the comment.
+    QCOMPARE(lex("(* \"*)", &state), expectedTokens);
+    expectedTokens = { OCaml::Token::Comment, OCaml::Token::Identifier };
+    QCOMPARE(lex("*)\" *) x", 0, state), expectedTokens);
+    QCOMPARE(lex("(* {id|*)|id} '\"' '\\\"' *) x"), expectedTokens);
+
+    // The highlighter keeps its own data above the lexer state.
+    expectedTokens = { OCaml::Token::String };
+    QCOMPARE(lex("{zzzzzzzz| open", &state), expectedTokens);
+    QCOMPARE(state & ~OCaml::Lexer::StateMask, 0);
+
+    // Delimiters past the width of the vectorized skips.
+    const QByteArray padding(40, 'x');
+    expectedTokens = { OCaml::Token::Comment, OCaml::Token::Identifier };
+    QCOMPARE(lex("(* " + padding + " (* " + padding + " *) " + padding + " *) " + padding), expectedTokens);
+    expectedTokens = { OCaml::Token::String, OCaml::Token::Identifier };
+    QCOMPARE(lex("\"" + padding + "\\\"" + padding + "\" " + padding), expectedTokens);
+}
+
+void Plugin::test_ocamlLexerThroughput()
+{
+    QByteArray code;
+    for (int i = 0; i < 2000; ++i) {
+        code += "(** Returns the [n]th element of the list, counting from zero. *)\n"
+                "let nth_element list n = List.nth list n (* may raise Failure *)\n"
+                "let message = \"a string long enough to be skipped in bulk\"\n";
+    }
+    const QString text = QString::fromUtf8(code);
+    int tokens = 0;
+    QBENCHMARK {
+        OCaml::Lexer lexer(&text);
+        tokens = 0;
+        while (lexer.read().kind != OCaml::Token::EndOfText)
+            ++tokens;
+    }
+    QCOMPARE(tokens, 2000 * 30);
+}
+
+void Plugin::test_ocamlKeywords()
+{
+    const QString text = QLatin1String("let rec letter lets mutable mutables nonrec _end"
+                                       " end' initializer initializers e");
+    QVector<OCaml::Token::Kind> kinds;
+    for (const QString &word : text.split(QLatin1Char(' ')))
+        kinds << OCaml::keywordKind(word.constData(), word.length());
+    const QVector<OCaml::Token::Kind> expectedKinds = {
+        OCaml::Token::KeywordLet, OCaml::Token::KeywordRec, OCaml::Token::Identifier,
+        OCaml::Token::Identifier, OCaml::Token::KeywordModifier, OCaml::Token::Identifier,
+        OCaml::Token::KeywordModifier, OCaml::Token::Identifier, OCaml::Token::Identifier,
+        OCaml::Token::Keyword, OCaml::Token::Identifier, OCaml::Token::Identifier
+    };
+    QCOMPARE(kinds, expectedKinds);
+
+    // Every lower case word of some everyday code, keywords and not.
+    const QString code = QString::fromLatin1(
+                "let rec fold_left f accu l = match l with [] -> accu | a :: l -> fold_left f (f accu a) l\n"
+                "let iter f a = for i = 0 to length a - 1 do f (unsafe_get a i) done\n"
+                "module Make (Ord : OrderedType) = struct type key = Ord.t exception Not_found end\n"
+                "let find x s = try Some (find_exn x s) with Not_found -> None\n"
+                "let is_empty = function Empty -> true | _ -> false\n");
+    OCaml::Lexer lexer(&code);
+    QVector<OCaml::Token> words;
+    OCaml::Token token;
+    while ((token = lexer.read()).kind != OCaml::Token::EndOfText) {
+        if (token.kind == OCaml::Token::Identifier || token.isKeyword())
+            words << token;
+    }
+    int keywords = 0;
+    QBENCHMARK {
+        keywords = 0;
+        for (const OCaml::Token &word : words) {
+            if (OCaml::keywordKind(code.constData() + word.position, word.length) != OCaml::Token::Identifier)
+                ++keywords;
+        }
+    }
+    QCOMPARE(keywords, 21);
+}
+
+void Plugin::test_ocamlLiterals()
+{
+    OCamlTokens expectedTokens = { OCaml::Token::String, OCaml::Token::Identifier };
+    QCOMPARE(lex("{foo|a \"|} b|foo} x"), expectedTokens);
+    QCOMPARE(lex("\"a \\\" b\" x"), expectedTokens);
+    // Ids sharing their first characters, on one line and across lines.
+    QCOMPARE(lex("{abcd|a|abce} b|abcd} x"), expectedTokens);
+    int state = 0;
+    lex("{abcd|a", &state);
+    QCOMPARE(lex("|abce} b|abcd} x", 0, state), expectedTokens);
+
+    expectedTokens = { OCaml::Token::Char, OCaml::Token::Char, OCaml::Token::TypeVariable };
+    QCOMPARE(lex("'a' '\\n' 'a"), expectedTokens);
+
+    expectedTokens = { OCaml::Token::PolyVariant, OCaml::Token::Label, OCaml::Token::Operator };
+    QCOMPARE(lex("`Foo ~bar: ~-"), expectedTokens);
+
+    // Extension nodes belong to their keyword, binding operators don't.
+    expectedTokens = { OCaml::Token::KeywordLet, OCaml::Token::Identifier, OCaml::Token::KeywordAnd,
+                       OCaml::Token::Identifier, OCaml::Token::Operator, OCaml::Token::Keyword };
+    QCOMPARE(lex("let%lwt x and%lwt y let* match%ext.sub"), expectedTokens);
+}
+
+void Plugin::test_ocamlDeclarations()
+{
+    QStringList expected = { "Test.x:0", "Test.t:2", "Test.E:3", "Test.f:1" };
+    QCOMPARE(declarations("let x = 1\n"
+                          "type ('a, 'b) t = 'a * 'b\n"
+                          "exception E of string\n"
+                          "external f : int -> int = \"f\""), expected);
+
+    expected = { "Test.f:0", "Test.g:0" };
+    QCOMPARE(declarations("let f x =\n"
+                          "  let y = x + 1 in\n"
+                          "  y\n"
+                          "and g = 2\n"
+                          "let () = let z = 1 in ignore z"), expected);
+
+    expected = { "Test.M:4", "Test.M.v:0", "Test.S:5", "Test.S.w:0", "Test.c:6", "Test.c.n:0", "Test.+!:0" };
+    QCOMPARE(declarations("module M = struct let v = 1 end\n"
+                          "module type S = sig val w : int end\n"
+                          "class c = object val mutable n = 0 end\n"
+                          "let ( +! ) a b = a + b"), expected);
+
+    // Files are indexed from their UTF-8 bytes, columns still count UTF-16 code units.
+    const QByteArray utf8 = "(* \xc3\xa9 *) let caf\xc3\xa9 = \"\xf0\x9f\x98\x80\" let x = 1";
+    OCaml::Utf8DeclarationScanner scanner(Utf8SourceCodeStream(utf8.constData(), utf8.size()));
+    QStringList found;
+    OCaml::Token token;
+    while ((token = scanner.read()).kind != OCaml::Token::EndOfText) {
+        if (scanner.isDeclaration()) {
+            found << QString::fromLatin1("%1@%2").arg(QString::fromUtf8(scanner.tokenData(token), token.length))
+                     .arg(scanner.currentColumn(token));
+        }
+    }
+    expected = { QString::fromUtf8("caf\xc3\xa9@12"), "x@28" };
+    QCOMPARE(found, expected);
+}
+
+// "name:kind" for every name the semantic highlighter classifies.
+static QStringList semanticClasses(const QByteArray &code)
+{
+    static const char *const kinds[] = { "module", "constructor", "type", "label", "mutable" };
+    const QString text = QString::fromUtf8(code);
+    const QStringList lines = text.split(QLatin1Char('\n'));
+    QStringList result;
+    for (const TextEditor::HighlightingResult &item : SemanticHighlighter::classify(text)) {
+        result << QString::fromLatin1("%1:%2").arg(lines.at(item.line - 1).mid(item.column - 1, item.length))
+                  .arg(QLatin1String(kinds[item.kind - SemanticHighlighter::Module]));
+    }
+    return result;
+}
+
+void Plugin::test_ocamlSemanticClasses()
+{
+    QStringList expected = { "t:type", "x:label", "int:type", "y:mutable", "float:type",
+                             "s:type", "A:constructor", "t:type", "list:type" };
+    QCOMPARE(semanticClasses("type t = { x : int; mutable y : float }\n"
+                             "and s = A of t list [@@deriving show]"), expected);
+
+    expected = { "M:module", "Map:module", "Make:module", "String:module",
+                 "t:type", "y:label", "x:label", "Some:constructor", "x:label" };
+    QCOMPARE(semanticClasses("module M = Map.Make (String)\n"
+                             "let f (p : t) = p.y <- 1.; { p with x = 2 }, Some p.x"), expected);
+
+    // Exception patterns and labeled arguments.
+    expected = { "Not_found:constructor", "Exit:constructor", "a:label", "string:type", "unit:type" };
+    QCOMPARE(semanticClasses("let g = match h () with exception Not_found -> raise Exit\n"
+                             "val k : a:string -> unit"), expected);
+}
+
+void Plugin::test_fuzzyIndex()
+{
+    QVERIFY(FuzzyIndex::score("pt", "print_tree") > FuzzyIndex::score("pt", "prompt"));
+    QVERIFY(FuzzyIndex::score("gv", "getValue") > FuzzyIndex::score("gv", "give"));
+    QCOMPARE(FuzzyIndex::score("ab", "ba"), -1);
+
+    QList<Symbol> symbols;
+    for (const char *name : { "filter_map", "mapi", "iter", "map", "fold_left" }) {
+        Symbol symbol;
+        symbol.name = QLatin1String(name);
+        symbols << symbol;
+    }
+    const FuzzyIndex index(symbols);
+    const QVector<FuzzyIndex::Match> matches = index.search("map", 2);
+    QCOMPARE(matches.size(), 2);
+    QCOMPARE(index.symbol(matches.at(0).index).name, QString("map"));
+    QCOMPARE(index.symbol(matches.at(1).index).name, QString("mapi"));
+    QVERIFY(index.search("map", 10, [] { return true; }).isEmpty());
+}
+
+void Plugin::test_ignoreRules()
+{
+    const IgnoreRules rules = IgnoreRules().withRules("/p", "_build/\n*.cm[io]\n!keep.cmi\n/doc/*.html\n")
+            .withRules("/p/lib", "# comment\n**/gen\n!_build/\n");
+
+    QVERIFY(rules.isIgnored("/p/_build", true));
+    QVERIFY(rules.isIgnored("/p/src/_build", true));
+    QVERIFY(!rules.isIgnored("/p/src/_build", false));
+    QVERIFY(!rules.isIgnored("/p/lib/_build", true));
+    QVERIFY(rules.isIgnored("/p/src/a.cmi", false));
+    QVERIFY(!rules.isIgnored("/p/src/keep.cmi", false));
+    QVERIFY(rules.isIgnored("/p/doc/index.html", false));
+    QVERIFY(!rules.isIgnored("/p/src/doc/index.html", false));
+    QVERIFY(rules.isIgnored("/p/lib/a/b/gen", true));
+    QVERIFY(!rules.isIgnored("/p/gen", true));
+    QVERIFY(!rules.isIgnored("/q/_build", true));
+}
+
+void Plugin::test_duneProject()
+{
+    const QVector<Sexp> sexps = Sexp::parse("; comment\n(a \"b c\" #| block #| nested |# |# d)\n"
+                                            "#;(ignored) (e (f))");
+    QCOMPARE(sexps.size(), 2);
+    QCOMPARE(sexps.at(0).head(), QByteArray("a"));
+    QCOMPARE(sexps.at(0).arguments(), QList<QByteArray>({ "b c", "d" }));
+    QVERIFY(sexps.at(1).field("f"));
+    QCOMPARE(Sexp::parse("(a) (b").size(), 1);
+
+    DuneProject project("/p");
+    project.setDirectory("/p/lib", "(library (name core) (public_name p.core)\n"
+                                   " (modules (:standard \\ old)) (libraries str))",
+                         { "/p/lib/a.ml", "/p/lib/a.mli", "/p/lib/old.ml", "/p/lib/dune" });
+    project.setDirectory("/p/bin", "(executables (names main tool) (libraries p.core))",
+                         { "/p/bin/main.ml", "/p/bin/tool.ml" });
+
+    QCOMPARE(project.targets("/p/lib").size(), 1);
+    QCOMPARE(project.targets("/p/lib").first().modules, QStringList({ "A" }));
+    QCOMPARE(project.targets("/p/bin").size(), 2);
+    QVERIFY(!project.targetFor("/p/lib/old.ml"));
+
+    const DuneProject::Target *main = project.targetFor("/p/bin/main.ml");
+    QVERIFY(main);
+    const QStringList expected = { "-source-path", "/p/bin", "-build-path", "/p/_build/default/bin/.main.eobjs/byte",
+                                   "-source-path", "/p/lib", "-build-path", "/p/_build/default/lib/.core.objs/byte",
+                                   "-package", "str" };
+    QCOMPARE(project.merlinFlags(*main), expected);
+
+    // The executables of one stanza share the build directory of the first.
+    const DuneProject::Target tool = project.targets("/p/bin").at(1);
+    QCOMPARE(tool.name, QString("tool"));
+    QCOMPARE(project.merlinFlags(tool).at(3), QString("/p/_build/default/bin/.main.eobjs/byte"));
+}
+
+} // namespace OCamlCreator
@@ -0,0 +1,531 @@
+#include "OCamlSemanticHighlighter.h"
+#include "OCamlLexer.h"
+
+#include <texteditor/syntaxhighlighter.h>
+#include <texteditor/textdocument.h>
+
+#include <utils/runextensions.h>
+
+#include <QElapsedTimer>
+#include <QSet>
+#include <QTextBlock>
+#include <QTextDocument>
+
+#include <algorithm>
+
+namespace OCamlCreator {
+
+using OCaml::Token;
+typedef TextEditor::HighlightingResult Result;
+
+// Edits are classified again once typing pauses.
+static const int UpdateInterval = 300;
+// Blocks around the visible ones that are applied along with them.
+static const int VisibleMargin = 50;
+// Results applied at once, and the time the idle pass takes before it lets
+// events through.
+static const int ChunkSize = 256;
+static const int PendingSliceTime = 10;
+
+static bool byPosition(const Result &a, const Result &b)
+{
+    return a.line < b.line || (a.line == b.line && a.column < b.column);
+}
+
+static bool byLine(int line, const Result &result)
+{
+    return line < int(result.line);
+}
+
+// Index of the first result at line or after it.
+static int firstResultAt(const QFuture<Result> &results, int line)
+{
+    int begin = 0;
+    int end = results.resultCount();
+    while (begin < end) {
+        const int middle = (begin + end) / 2;
+        if (int(results.resultAt(middle).line) < line)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+    return begin;
+}
+
+static QHash<int, QTextCharFormat> semanticFormats()
+{
+    QHash<int, QTextCharFormat> formats;
+    formats[SemanticHighlighter::Module].setForeground(QColor(0, 128, 128));
+    formats[SemanticHighlighter::Constructor].setForeground(QColor(153, 0, 115));
+    formats[SemanticHighlighter::Type].setForeground(QColor(68, 85, 136));
+    formats[SemanticHighlighter::Label].setForeground(QColor(0, 102, 153));
+    formats[SemanticHighlighter::MutableField] = formats[SemanticHighlighter::Label];
+    formats[SemanticHighlighter::MutableField].setFontItalic(true);
+    return formats;
+}
+
+namespace {
+
+// Where the names being read are, it decides what a lowercase name is.
+enum Context {
+    Context_Expression,
+    Context_TypeDefinition,     // after type or exception
+    Context_TypeExpression,     // after the colon of a value, a pattern or an expression
+    Context_ModulePath          // after module, open or include
+};
+
+struct Item
+{
+    Token token;
+    int line;
+    int column;
+};
+
+struct Bracket
+{
+    Token::Kind kind;
+    bool attribute;     // [@...] or [%...], nothing inside is classified
+};
+
+class Classifier
+{
+public:
+    explicit Classifier(const QString &text) : m_text(text) {}
+
+    // Reports the results up to lastVisibleLine first when future is given.
+    SemanticHighlighter::Results run(QFutureInterface<SemanticHighlighter::Results> *future,
+                                     int lastVisibleLine);
+
+private:
+    void readItems();
+    bool textIs(int index, const char *ascii) const;
+    QStringRef text(int index) const;
+    Token::Kind kindAt(int index) const;
+    int classify(int index);
+    int fieldKind(int index) const;
+
+    const QString &m_text;
+    QVector<Item> m_items;
+    QSet<QStringRef> m_mutableFields;
+    QVector<Bracket> m_brackets;
+    Context m_context = Context_Expression;
+    int m_contextDepth = 0;
+    int m_attributes = 0;
+};
+
+void Classifier::readItems()
+{
+    OCaml::Lexer lexer(&m_text);
+    Token token;
+    while ((token = lexer.read()).kind != Token::EndOfText) {
+        if (token.kind != Token::Whitespace && token.kind != Token::Comment)
+            m_items.append({ token, lexer.currentLine(), lexer.currentColumn(token) });
+    }
+
+    // Fields may be used before the type that declares them.
+    for (int i = 2; i < m_items.size(); ++i) {
+        if (m_items.at(i).token.kind == Token::Colon && kindAt(i - 1) == Token::Identifier
+                && kindAt(i - 2) == Token::KeywordModifier && textIs(i - 2, "mutable")) {
+            m_mutableFields.insert(text(i - 1));
+        }
+    }
+}
+
+bool Classifier::textIs(int index, const char *ascii) const
+{
+    return text(index) == QLatin1String(ascii);
+}
+
+QStringRef Classifier::text(int index) const
+{
+    const Token &token = m_items.at(index).token;
+    return m_text.midRef(token.position, token.length);
+}
+
+Token::Kind Classifier::kindAt(int index) const
+{
+    return index >= 0 && index < m_items.size() ? m_items.at(index).token.kind : Token::EndOfText;
+}
+
+int Classifier::fieldKind(int index) const
+{
+    return m_mutableFields.contains(text(index)) ? SemanticHighlighter::MutableField
+                                                 : SemanticHighlighter::Label;
+}
+
+static bool startsItem(Token::Kind kind)
+{
+    switch (kind) {
+    case Token::KeywordLet:
+    case Token::KeywordIn:
+    case Token::KeywordVal:
+    case Token::KeywordExternal:
+    case Token::KeywordClass:
+    case Token::KeywordStruct:
+    case Token::KeywordSig:
+    case Token::KeywordObject:
+    case Token::KeywordBegin:
+    case Token::KeywordEnd:
+    case Token::DoubleSemicolon:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool isOpening(Token::Kind kind)
+{
+    return kind == Token::OpenParen || kind == Token::OpenBracket || kind == Token::OpenBrace;
+}
+
+static bool isClosing(Token::Kind kind)
+{
+    return kind == Token::CloseParen || kind == Token::CloseBracket || kind == Token::CloseBrace;
+}
+
+// Kind of the name at index, -1 when it is none of the semantic classes.
+// Follows the context along the way.
+int Classifier::classify(int index)
+{
+    const Token::Kind kind = kindAt(index);
+    const Token::Kind previous = kindAt(index - 1);
+    const Token::Kind next = kindAt(index + 1);
+
+    if (isOpening(kind)) {
+        const bool attribute = kind == Token::OpenBracket && next == Token::Operator
+                && (text(index + 1).startsWith(QLatin1Char('@')) || text(index + 1).startsWith(QLatin1Char('%')));
+        m_brackets.append({ kind, attribute });
+        m_attributes += attribute;
+        return -1;
+    }
+    if (isClosing(kind)) {
+        if (!m_brackets.isEmpty())
+            m_attributes -= m_brackets.takeLast().attribute;
+        if (m_brackets.size() < m_contextDepth)
+            m_context = Context_Expression;
+        return -1;
+    }
+    if (m_attributes > 0)
+        return -1;
+
+    switch (kind) {
+    case Token::KeywordType:
+        // module type S, or a type constraint on a module or an expression.
+        m_context = previous == Token::KeywordModule ? Context_ModulePath : Context_TypeDefinition;
+        m_contextDepth = m_brackets.size();
+        return -1;
+    case Token::KeywordException:
+        // Not the exception patterns of a match.
+        if (previous != Token::Bar && previous != Token::KeywordWith) {
+            m_context = Context_TypeDefinition;
+            m_contextDepth = m_brackets.size();
+        }
+        return -1;
+    case Token::KeywordModule:
+    case Token::KeywordOpen:
+    case Token::KeywordInclude:
+        m_context = Context_ModulePath;
+        m_contextDepth = m_brackets.size();
+        return -1;
+    case Token::Colon:
+        if (m_context == Context_Expression) {
+            m_context = Context_TypeExpression;
+            m_contextDepth = m_brackets.size();
+        }
+        return -1;
+    case Token::Operator:
+        if (m_context == Context_Expression && textIs(index, ":>")) {
+            m_context = Context_TypeExpression;
+            m_contextDepth = m_brackets.size();
+        }
+        return -1;
+    case Token::Equal:
+    case Token::Comma:
+    case Token::Semicolon:
+        if (m_context == Context_TypeExpression && m_brackets.size() == m_contextDepth)
+            m_context = Context_Expression;
+        return -1;
+    case Token::Capitalized:
+        if (next == Token::Dot || m_context == Context_ModulePath)
+            return SemanticHighlighter::Module;
+        return SemanticHighlighter::Constructor;
+    case Token::Identifier:
+        break;
+    default:
+        if (startsItem(kind))
+            m_context = Context_Expression;
+        return -1;
+    }
+
+    switch (m_context) {
+    case Context_TypeDefinition:
+    case Context_TypeExpression:
+        // Record fields and labeled arguments are followed by a colon, any
+        // other lowercase name is a type.
+        if (next == Token::Colon) {
+            if (previous == Token::KeywordModifier && textIs(index - 1, "mutable"))
+                return SemanticHighlighter::MutableField;
+            return SemanticHighlighter::Label;
+        }
+        return SemanticHighlighter::Type;
+    case Context_ModulePath:
+        return -1;
+    case Context_Expression:
+        break;
+    }
+
+    // record.field, but not Module.value.
+    if (previous == Token::Dot && kindAt(index - 2) != Token::Capitalized)
+        return fieldKind(index);
+    // { field = ...; field; record with field = ... }
+    if (!m_brackets.isEmpty() && m_brackets.last().kind == Token::OpenBrace
+            && (previous == Token::OpenBrace || previous == Token::Semicolon || previous == Token::KeywordWith)
+            && (next == Token::Equal || next == Token::Semicolon || next == Token::CloseBrace)) {
+        return fieldKind(index);
+    }
+    return -1;
+}
+
+SemanticHighlighter::Results Classifier::run(QFutureInterface<SemanticHighlighter::Results> *future,
+                                             int lastVisibleLine)
+{
+    readItems();
+
+    SemanticHighlighter::Results results;
+    bool visibleReported = !future || lastVisibleLine < 0;
+    for (int i = 0; i < m_items.size(); ++i) {
+        const Item &item = m_items.at(i);
+        if (!visibleReported && item.line > lastVisibleLine) {
+            if (future->isCanceled())
+                return results;
+            future->reportResult(results);
+            visibleReported = true;
+        }
+        const int kind = classify(i);
+        if (kind >= 0)
+            results.append(Result(item.line, item.column + 1, item.token.length, kind));
+    }
+    return results;
+}
+
+} // anonymous namespace
+
+SemanticHighlighter::SemanticHighlighter(TextEditor::TextDocument *document)
+    : QObject(document)
+    , m_document(document)
+    , m_runningRevision(-1)
+    , m_runningLastLine(-1)
+    , m_revision(-1)
+    , m_lastLine(-1)
+    , m_formats(semanticFormats())
+    , m_appliedToEnd(false)
+    , m_firstVisibleBlock(0)
+    , m_lastVisibleBlock(-1)
+{
+    m_updateTimer.setSingleShot(true);
+    m_updateTimer.setInterval(UpdateInterval);
+    connect(&m_updateTimer, &QTimer::timeout, this, &SemanticHighlighter::update);
+    connect(document->document(), &QTextDocument::contentsChanged,
+            &m_updateTimer, static_cast<void (QTimer::*)()>(&QTimer::start));
+
+    m_applyTimer.setSingleShot(true);
+    m_applyTimer.setInterval(0);
+    connect(&m_applyTimer, &QTimer::timeout, this, &SemanticHighlighter::applyPendingChunks);
+
+    connect(&m_watcher, &QFutureWatcherBase::resultsReadyAt, this, &SemanticHighlighter::onResultsReady);
+    connect(&m_watcher, &QFutureWatcherBase::finished, this, &SemanticHighlighter::onFinished);
+}
+
+SemanticHighlighter::~SemanticHighlighter()
+{
+    m_watcher.cancel();
+    m_watcher.waitForFinished();
+}
+
+SemanticHighlighter::Results SemanticHighlighter::classify(const QString &text)
+{
+    return Classifier(text).run(nullptr, -1);
+}
+
+void SemanticHighlighter::run(QFutureInterface<Results> &future, const QString &text, int lastVisibleLine)
+{
+    const Results results = Classifier(text).run(&future, lastVisibleLine);
+    if (!future.isCanceled())
+        future.reportResult(results);
+}
+
+void SemanticHighlighter::setVisibleBlocks(int first, int last)
+{
+    first = qMax(0, first - VisibleMargin);
+    last += VisibleMargin;
+    if (first == m_firstVisibleBlock && last == m_lastVisibleBlock)
+        return;
+    m_firstVisibleBlock = first;
+    m_lastVisibleBlock = last;
+
+    if (m_revision < 0)
+        update();
+    else
+        applyVisibleBlocks();
+}
+
+void SemanticHighlighter::setDiagnostics(const Results &diagnostics, const QHash<int, QTextCharFormat> &formats)
+{
+    m_diagnostics = diagnostics;
+    std::stable_sort(m_diagnostics.begin(), m_diagnostics.end(), byPosition);
+    for (auto it = formats.cbegin(); it != formats.cend(); ++it)
+        m_formats.insert(it.key(), it.value());
+
+    // Otherwise they come along with the classes of the new revision.
+    if (isCurrent())
+        setResults(m_semantic, m_lastLine);
+}
+
+bool SemanticHighlighter::isCurrent() const
+{
+    return m_revision >= 0 && m_revision == m_document->document()->revision();
+}
+
+void SemanticHighlighter::update()
+{
+    const int revision = m_document->document()->revision();
+    if (revision == m_runningRevision && m_watcher.isRunning())
+        return;
+    if (revision == m_revision && m_lastLine < 0)
+        return;
+
+    m_watcher.cancel();
+    m_runningRevision = revision;
+    m_runningLastLine = m_lastVisibleBlock < 0 ? -1 : m_lastVisibleBlock + 1;
+    m_watcher.setFuture(Utils::runAsync(&SemanticHighlighter::run, m_document->plainText(),
+                                        m_runningLastLine));
+}
+
+// Results of the visible lines, ahead of the others. When the worker was
+// quick the first result may already be the complete one, it is cut to the
+// visible lines all the same so that the chunks stay those of the end result.
+void SemanticHighlighter::onResultsReady(int begin, int end)
+{
+    if (begin != 0 || end == 0 || m_watcher.isFinished()
+            || m_runningRevision != m_document->document()->revision()) {
+        return;
+    }
+    Results visible = m_watcher.resultAt(0);
+    visible.erase(std::upper_bound(visible.begin(), visible.end(), m_runningLastLine, byLine), visible.end());
+    setResults(visible, m_runningLastLine);
+}
+
+void SemanticHighlighter::onFinished()
+{
+    const QFuture<Results> future = m_watcher.future();
+    if (future.isCanceled() || future.resultCount() == 0
+            || m_runningRevision != m_document->document()->revision()) {
+        return;
+    }
+    setResults(future.resultAt(future.resultCount() - 1), -1);
+}
+
+void SemanticHighlighter::setResults(const Results &semantic, int lastLine)
+{
+    const int revision = m_document->document()->revision();
+    const int unchanged = revision == m_revision && lastLine < 0 && m_lastLine >= 0
+            ? m_results.resultCount() / ChunkSize : 0;
+
+    Results results;
+    results.reserve(semantic.size() + m_diagnostics.size());
+    auto diagnosticsEnd = m_diagnostics.cend();
+    if (lastLine >= 0)
+        diagnosticsEnd = std::upper_bound(m_diagnostics.cbegin(), m_diagnostics.cend(), lastLine, byLine);
+    std::merge(semantic.cbegin(), semantic.cend(), m_diagnostics.cbegin(), diagnosticsEnd,
+               std::back_inserter(results), byPosition);
+
+    m_revision = revision;
+    m_lastLine = lastLine;
+    m_semantic = semantic;
+
+    QFutureInterface<Result> future;
+    future.reportStarted();
+    future.reportResults(results);
+    future.reportFinished();
+    m_results = future.future();
+
+    // The visible lines were published first, their chunks are still right:
+    // they end on a line and the first results stop at one. The last of them
+    // may have been cut short.
+    m_appliedChunks.resize((results.size() + ChunkSize - 1) / ChunkSize);
+    for (int chunk = unchanged; chunk < m_appliedChunks.size(); ++chunk)
+        m_appliedChunks.clearBit(chunk);
+    if (unchanged == 0)
+        m_appliedChunks.fill(false);
+    m_appliedToEnd = false;
+
+    applyVisibleBlocks();
+}
+
+void SemanticHighlighter::applyVisibleBlocks()
+{
+    if (!isCurrent())
+        return;
+
+    const int begin = firstResultAt(m_results, m_firstVisibleBlock + 1);
+    const int end = firstResultAt(m_results, m_lastVisibleBlock + 2);
+    for (int chunk = begin / ChunkSize; chunkStart(chunk) < end; ++chunk)
+        applyChunk(chunk);
+
+    m_applyTimer.start();
+}
+
+void SemanticHighlighter::applyPendingChunks()
+{
+    if (!isCurrent() || m_lastLine >= 0 || m_appliedToEnd)
+        return;
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int chunk = 0; chunk < m_appliedChunks.size(); ++chunk) {
+        if (m_appliedChunks.testBit(chunk))
+            continue;
+        if (timer.elapsed() >= PendingSliceTime) {
+            m_applyTimer.start();
+            return;
+        }
+        applyChunk(chunk);
+    }
+
+    TextEditor::SyntaxHighlighter *highlighter = m_document->syntaxHighlighter();
+    if (!highlighter)
+        return;
+    if (m_results.resultCount() == 0)
+        highlighter->clearExtraFormats(m_document->document()->firstBlock());
+    TextEditor::SemanticHighlighter::clearExtraAdditionalFormatsUntilEnd(highlighter, m_results);
+    m_appliedToEnd = true;
+}
+
+// Chunks start at the first result of a line from chunk * ChunkSize on. Applying
+// a chunk sets the formats of its lines to its results only, so a line split
+// between two chunks would lose those of the chunk applied first.
+int SemanticHighlighter::chunkStart(int chunk) const
+{
+    const int count = m_results.resultCount();
+    int start = qMin(chunk * ChunkSize, count);
+    while (start > 0 && start < count && m_results.resultAt(start).line == m_results.resultAt(start - 1).line)
+        ++start;
+    return start;
+}
+
+// Also clears the blocks between the previous results and those of chunk.
+void SemanticHighlighter::applyChunk(int chunk)
+{
+    TextEditor::SyntaxHighlighter *highlighter = m_document->syntaxHighlighter();
+    if (!highlighter || chunk >= m_appliedChunks.size() || m_appliedChunks.testBit(chunk))
+        return;
+    const int from = chunkStart(chunk);
+    const int to = chunkStart(chunk + 1);
+    if (from < to) {
+        TextEditor::SemanticHighlighter::incrementalApplyExtraAdditionalFormats(highlighter, m_results,
+                                                                                from, to, m_formats);
+    }
+    m_appliedChunks.setBit(chunk);
+}
+
+}
@@ -0,0 +1,83 @@
+#ifndef OCaml_SemanticHighlighter_h
+#define OCaml_SemanticHighlighter_h
+
+#include <texteditor/semantichighlighter.h>
+
+#include <QBitArray>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QObject>
+#include <QTextCharFormat>
+#include <QTimer>
+#include <QVector>
+
+namespace TextEditor { class TextDocument; }
+
+namespace OCamlCreator {
+
+// Tells module, constructor, type and record field names of a document apart,
+// which the lexer alone can't: from where they are in the code and from the
+// fields the document declares. The classes are computed on a worker from a
+// copy of the text, the visible blocks are published as soon as the worker is
+// past them. They are applied as extra formats block by block, those of the
+// visible blocks first, the rest of the document in idle time slices, and kept
+// for the document revision they were computed for, so scrolling only applies
+// them. The merlin diagnostics share the extra formats and are applied along.
+class SemanticHighlighter : public QObject
+{
+    Q_OBJECT
+
+public:
+    typedef QVector<TextEditor::HighlightingResult> Results;
+
+    // Kinds of the results, after those of the diagnostics.
+    enum Kind { Module = 16, Constructor, Type, Label, MutableField };
+
+    explicit SemanticHighlighter(TextEditor::TextDocument *document);
+    ~SemanticHighlighter();
+
+    void setVisibleBlocks(int first, int last);
+    // Diagnostics of the current revision, with the formats of their kinds.
+    void setDiagnostics(const Results &diagnostics, const QHash<int, QTextCharFormat> &formats);
+
+    // Classes of the names in text, ordered by position.
+    static Results classify(const QString &text);
+
+private:
+    static void run(QFutureInterface<Results> &future, const QString &text, int lastVisibleLine);
+
+    void update();
+    void onResultsReady(int begin, int end);
+    void onFinished();
+    void setResults(const Results &semantic, int lastLine);
+    bool isCurrent() const;
+    void applyVisibleBlocks();
+    void applyPendingChunks();
+    int chunkStart(int chunk) const;
+    void applyChunk(int chunk);
+
+    TextEditor::TextDocument *m_document;
+    QFutureWatcher<Results> m_watcher;
+    int m_runningRevision;
+    int m_runningLastLine;
+
+    // Results of m_revision, complete when m_lastLine is -1, otherwise only up
+    // to that line. m_results merges them with the diagnostics.
+    int m_revision;
+    int m_lastLine;
+    Results m_semantic;
+    Results m_diagnostics;
+    QHash<int, QTextCharFormat> m_formats;
+    QFuture<TextEditor::HighlightingResult> m_results;
+    QBitArray m_appliedChunks;
+    bool m_appliedToEnd;
+
+    int m_firstVisibleBlock;
+    int m_lastVisibleBlock;
+    QTimer m_updateTimer;
+    QTimer m_applyTimer;
+};
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+#include "OCamlStringTable.h"
+
+#include <QVarLengthArray>
+
+namespace OCamlCreator {
+
+StringTable::StringTable()
+    : m_stringBytes(0)
+{
+    m_strings << QString();
+    m_ids.insert(QString(), EmptyId);
+}
+
+StringTable *StringTable::instance()
+{
+    static StringTable table;
+    return &table;
+}
+
+StringTable::Id StringTable::intern(const QString &str)
+{
+    {
+        QReadLocker locker(&m_lock);
+        auto it = m_ids.constFind(str);
+        if (it != m_ids.constEnd())
+            return it.value();
+    }
+    return insert(str);
+}
+
+StringTable::Id StringTable::intern(const QStringRef &str)
+{
+    return intern(str.unicode(), str.size());
+}
+
+StringTable::Id StringTable::intern(const QChar *data, int size)
+{
+    // Look the string up without copying it, only a miss allocates.
+    const QString raw = QString::fromRawData(data, size);
+    {
+        QReadLocker locker(&m_lock);
+        auto it = m_ids.constFind(raw);
+        if (it != m_ids.constEnd())
+            return it.value();
+    }
+    return insert(QString(data, size));
+}
+
+StringTable::Id StringTable::internUtf8(const char *data, int size)
+{
+    QVarLengthArray<QChar, 64> chars(size);
+    for (int i = 0; i < size; ++i) {
+        const uchar c = uchar(data[i]);
+        if (c >= 0x80)
+            return intern(QString::fromUtf8(data, size));
+        chars[i] = QLatin1Char(char(c));
+    }
+    return intern(chars.constData(), size);
+}
+
+StringTable::Id StringTable::lookup(const QString &str) const
+{
+    QReadLocker locker(&m_lock);
+    return m_ids.value(str, EmptyId);
+}
+
+StringTable::Id StringTable::insert(const QString &str)
+{
+    QWriteLocker locker(&m_lock);
+    // Another thread may have interned it while we were waiting for the lock.
+    auto it = m_ids.constFind(str);
+    if (it != m_ids.constEnd())
+        return it.value();
+
+    const Id id = m_strings.size();
+    m_strings << str;
+    m_ids.insert(str, id);
+    m_stringBytes += sizeof(QArrayData) + (str.size() + 1) * sizeof(QChar);
+    return id;
+}
+
+QString StringTable::string(Id id) const
+{
+    QReadLocker locker(&m_lock);
+    return m_strings.value(id);
+}
+
+int StringTable::count() const
+{
+    QReadLocker locker(&m_lock);
+    return m_strings.size();
+}
+
+qint64 StringTable::memoryUsage() const
+{
+    QReadLocker locker(&m_lock);
+    // Every string is referenced by the id vector and by one hash node.
+    const qint64 hashNodeSize = sizeof(void*) + sizeof(uint) + sizeof(QString) + sizeof(Id);
+    return m_stringBytes
+            + m_strings.capacity() * sizeof(QString)
+            + m_ids.capacity() * sizeof(void*)
+            + m_ids.size() * hashNodeSize;
+}
+
+}
@@ -0,0 +1,49 @@
+#ifndef OCaml_StringTable_h
+#define OCaml_StringTable_h
+
+#include <QHash>
+#include <QReadWriteLock>
+#include <QString>
+#include <QVector>
+
+namespace OCamlCreator {
+
+// Process wide, append only table of interned strings. The code model keeps
+// ids instead of strings so names like `t`, `x` or `create` are stored once.
+// Interning and lookups are thread safe, ids are never invalidated.
+class StringTable
+{
+    Q_DISABLE_COPY(StringTable)
+
+public:
+    typedef quint32 Id;
+    static const Id EmptyId = 0;
+
+    StringTable();
+    static StringTable *instance();
+
+    Id intern(const QString &str);
+    Id intern(const QStringRef &str);
+    // Always copies the characters, so they may live in a mapped file.
+    Id intern(const QChar *data, int size);
+    // Same for UTF-8, only strings that are not ASCII get decoded.
+    Id internUtf8(const char *data, int size);
+    // Like intern() but does not add missing strings, returns EmptyId for them.
+    Id lookup(const QString &str) const;
+    QString string(Id id) const;
+
+    int count() const;
+    qint64 memoryUsage() const;
+
+private:
+    Id insert(const QString &str);
+
+    mutable QReadWriteLock m_lock;
+    QHash<QString, Id> m_ids;
+    QVector<QString> m_strings;
+    qint64 m_stringBytes;
+};
+
+}
+
+#endif
@@ -42,7 +42,7 @@ public:
             text += "::";
         text += symbol.name + QString::fromLatin1(" [line %1]").arg(symbol.line);
         setText(text);
-        setDetail(*symbol.file);
+        setDetail(symbol.file);
     }
 
     void apply(TextEditor::TextDocumentManipulatorInterface&, int) const override
@@ -50,7 +50,7 @@ public:
         Core::EditorManager::OpenEditorFlags flags = Core::EditorManager::NoFlags;
         if (m_inNextSplit)
             flags |= Core::EditorManager::OpenInOtherSplit;
-        Core::EditorManager::openEditorAt(*m_symbol.file,
+        Core::EditorManager::openEditorAt(m_symbol.file,
                                           m_symbol.line,
                                           m_symbol.column,
                                           Core::Id(Constants::OCaml::EditorId),
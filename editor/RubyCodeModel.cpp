@@ -1,48 +1,99 @@
 #include "RubyCodeModel.h"
-#include "RubyScanner.h"
+#include "OCamlDeclarationScanner.h"
+#include "OCamlCodeModelData.h"
+#include "OCamlIndexFile.h"
+#include "../RubyConstants.h"
+
+#include <coreplugin/progressmanager/progressmanager.h>
 
-#include <QElapsedTimer>
 #include <QFile>
 #include <QFileInfo>
 #include <QRegularExpression>
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QTextStream>
+#include <QtConcurrent>
 #include <QDebug>
 
+#include <algorithm>
+#include <climits>
+
 namespace OCamlCreator {
 
-class CodeModel::Data
+typedef StringTable::Id Id;
+
+static QVector<Id> toSortedVector(const QSet<Id> &set)
 {
-    Q_DISABLE_COPY(Data)
+    QVector<Id> result;
+    result.reserve(set.size());
+    for (Id id : set)
+        result << id;
+    std::sort(result.begin(), result.end());
+    return result;
+}
 
-public:
-    Data(const QString &fileName = QString()) : fileName(fileName) {}
+static QSet<QString> stringsFor(const QVector<Id> &ids)
+{
+    StringTable *strings = StringTable::instance();
+    QSet<QString> result;
+    result.reserve(ids.size());
+    for (Id id : ids)
+        result << strings->string(id);
+    return result;
+}
+
+// Runs on the worker threads, so it must not touch the model itself.
+struct CodeModel::FileIndexer
+{
+    typedef DataPtr result_type;
+
+    FileIndexer(const std::shared_ptr<const Snapshot> &snapshot,
+                const std::shared_ptr<const IndexFile> &index)
+        : snapshot(snapshot), index(index) {}
 
-    void clear()
+    DataPtr operator()(const QString &file) const
     {
-        methods.clear();
-        identifiers.clear();
-        constants.clear();
-        classes.clear();
-        symbols.clear();
-    }
+        const QFileInfo info(file);
+        const DataPtr current = snapshot->value(file);
+        if (current && current->lastUpdate > info.lastModified())
+            return DataPtr();
+
+        if (index) {
+            if (DataPtr cached = index->load(file, info))
+                return cached;
+        }
+
+        QFile fp(file);
+        if (!fp.open(QFile::ReadOnly))
+            return DataPtr();
 
-    QDateTime lastUpdate;
-    QString fileName;
+        std::shared_ptr<Data> data = scanFile(file, fp);
+        data->lastModified = info.lastModified();
+        data->fileSize = info.size();
+        return data;
+    }
 
-    QList<Symbol> methods;
-    QList<Symbol> classes;
-    QList<Symbol> constantsDelc;
-    QSet<QString> identifiers;
-    QSet<QString> constants;
-    QSet<QString> symbols;
+    std::shared_ptr<const Snapshot> snapshot;
+    std::shared_ptr<const IndexFile> index;
 };
 
 CodeModel::CodeModel()
+    : m_snapshot(std::make_shared<const Snapshot>())
+    , m_revision(0)
+    , m_generation(0)
 {
+    m_indexWriter.setMaxThreadCount(1);
 }
 
 CodeModel::~CodeModel()
 {
-    qDeleteAll(m_model);
+    for (QFutureWatcher<DataPtr> *watcher : m_indexers) {
+        watcher->disconnect(this);
+        watcher->cancel();
+        watcher->waitForFinished();
+    }
+    qDeleteAll(m_indexers);
+    m_indexWriter.waitForDone();
 }
 
 CodeModel *CodeModel::instance()
@@ -51,98 +102,135 @@ CodeModel *CodeModel::instance()
     return &model;
 }
 
+std::shared_ptr<const CodeModel::Snapshot> CodeModel::snapshot() const
+{
+    return std::atomic_load(&m_snapshot);
+}
+
+// Callers hold m_writeMutex.
+void CodeModel::setSnapshot(const std::shared_ptr<const Snapshot> &next)
+{
+    std::atomic_store(&m_snapshot, next);
+    ++m_revision;
+}
+
+CodeModel::DataPtr CodeModel::dataFor(const QString &file) const
+{
+    return snapshot()->value(file);
+}
+
 void CodeModel::removeSymbolsFrom(const QString &file)
 {
-    delete m_model[file];
-    m_model.remove(file);
+    for (QSet<QString> &files : m_indexFiles)
+        files.remove(file);
+
+    QMutexLocker locker(&m_writeMutex);
+    m_changedAt.insert(file, ++m_generation);
+    auto next = std::make_shared<Snapshot>(*m_snapshot);
+    if (next->remove(file))
+        setSnapshot(next);
+}
+
+bool CodeModel::isIndexable(const QString &file)
+{
+    return file.endsWith(".ml") || file.endsWith(".mli");
 }
 
 void CodeModel::addFile(const QString &file)
 {
-    if (!file.endsWith(".rb") && !file.endsWith(".rake"))
+    if (!isIndexable(file))
         return;
 
-    QFileInfo info(file);
-    Data *&data = m_model[file];
-    if (!data)
-        data = new Data(file);
-
-    if (!data->lastUpdate.isNull() && data->lastUpdate > info.lastModified())
+    const DataPtr data = dataFor(file);
+    if (data && data->lastUpdate > QFileInfo(file).lastModified())
         return;
 
     QFile fp(file);
     if (!fp.open(QFile::ReadOnly))
         return;
-    updateFile(file, QString::fromUtf8(fp.readAll()));
+    publish({ scanFile(file, fp) });
 }
 
-void CodeModel::addFiles(const QStringList &files)
+void CodeModel::addFiles(const QStringList &files, const QString &indexFile)
 {
-    QElapsedTimer timer;
-    timer.start();
+    QStringList sources;
+    for (const QString &file : files) {
+        if (isIndexable(file))
+            sources << file;
+    }
+    if (sources.isEmpty())
+        return;
 
-    for (const QString &file : files)
-        addFile(file);
+    quint64 generation;
+    {
+        QMutexLocker locker(&m_writeMutex);
+        generation = m_generation;
+    }
 
-    qDebug() << "Code model updated in" << timer.elapsed() << "ms";
-}
+    auto watcher = new QFutureWatcher<DataPtr>;
+    m_indexers << watcher;
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, sources, indexFile, generation] {
+        m_indexers.removeOne(watcher);
+        publishBatch(watcher->future().results(), generation);
+        watcher->deleteLater();
+        if (!indexFile.isEmpty() && !watcher->isCanceled()) {
+            m_indexFiles[indexFile] += sources.toSet();
+            saveIndex(indexFile);
+        }
+    });
+
+    std::shared_ptr<const IndexFile> index;
+    if (!indexFile.isEmpty() && !m_indexFiles.contains(indexFile)) {
+        // Only the first batch of a session can benefit from the index on disk,
+        // later ones come from file system changes.
+        index = std::make_shared<const IndexFile>(indexFile);
+        if (!index->isValid())
+            index.reset();
+    }
 
-static Symbol createSymbol(const QString *fileName, const QString &contents, Scanner &scanner, Token token)
-{
-    Symbol sym(fileName);
-    sym.name = contents.mid(token.position, token.length);
-    sym.line = scanner.currentLine();
-    sym.column = scanner.currentColumn(token);
-    sym.context = scanner.contextName();
-    return sym;
+    QFuture<DataPtr> future = QtConcurrent::mapped(sources, FileIndexer(snapshot(), index));
+    watcher->setFuture(future);
+    Core::ProgressManager::addTask(future, tr("Indexing OCaml files"), Constants::TASK_INDEX);
 }
 
-// This does not support multiline symbols defined by %i.
-static void parseRubySymbol(const QString &contents, Token token, QSet<QString>& symbols)
+void CodeModel::publish(const QList<DataPtr> &results)
 {
-    if (contents[token.position] == ':') {
-        symbols << contents.mid(token.position, token.length);
-    } else if (contents[token.position + token.length - 1] == ':') {
-        QString symbol = contents.mid(token.position, token.length - 1);
-        symbol.prepend(':');
-        symbols << symbol;
-    } else {
-        QStringRef symbolsToSplit;
-        if (contents[token.position] == '%') {
-            if (token.length < 4 || contents[token.position + 1] != 'i')
-                return;
-
-            QChar endDelimiter = translateDelimiter(contents[token.position + 2]);
-            int start = token.position + 3;
-            QStringRef contentsRef(&contents, start, token.length - 3);
-            int end = contentsRef.indexOf(endDelimiter);
-            symbolsToSplit = end < 0 ? contentsRef : contentsRef.left(end);
-        } else {
-            // Work 90% of the time... but not for the last item in a multiline symbol declaration.
-            symbolsToSplit = QStringRef(&contents, token.position, token.length);
+    QMutexLocker locker(&m_writeMutex);
+    ++m_generation;
+    auto next = std::make_shared<Snapshot>(*m_snapshot);
+    for (const DataPtr &data : results) {
+        if (data) {
+            next->insert(data->fileName, data);
+            m_changedAt.insert(data->fileName, m_generation);
         }
-
-        // To be able to use QStringRef everywhere we split things by spaces instead of by the regexp /\s+/
-        // But who cares for the ones using TABS!? :-)
-        QVector<QStringRef> result = symbolsToSplit.split(' ');
-        for (QStringRef item : result)
-            symbols << item.toString().prepend(':');
     }
+    setSnapshot(next);
 }
 
-void addMethodParameter(Symbol& method, const QString& parameter)
+void CodeModel::publishBatch(const QList<DataPtr> &results, quint64 generation)
 {
-    QString& name = method.name;
-    const QChar end = name[name.length() -1];
+    QMutexLocker locker(&m_writeMutex);
+    auto next = std::make_shared<Snapshot>(*m_snapshot);
+    for (const DataPtr &data : results) {
+        if (!data || m_changedAt.value(data->fileName) > generation)
+            continue;
+        const DataPtr current = next->value(data->fileName);
+        if (current && current->lastUpdate > data->lastUpdate)
+            continue;
+        next->insert(data->fileName, data);
+    }
+    setSnapshot(next);
+}
 
-    if (end == ')') {
-        name.chop(1);
-        name.append(", ");
-    } else {
-        name.append('(');
+void CodeModel::saveIndex(const QString &indexFile)
+{
+    QList<DataPtr> files;
+    const auto model = snapshot();
+    for (const QString &file : m_indexFiles.value(indexFile)) {
+        if (const DataPtr data = model->value(file))
+            files << data;
     }
-    name.append(parameter);
-    name.append(')');
+    QtConcurrent::run(&m_indexWriter, &IndexFile::save, indexFile, files);
 }
 
 void CodeModel::updateFile(const QString &fileName, const QString &contents)
@@ -150,105 +238,325 @@ void CodeModel::updateFile(const QString &fileName, const QString &contents)
     if (fileName.isEmpty())
         return;
 
-    Data *&data = m_model[fileName];
-    if (!data)
-        data = new Data(fileName);
-    data->clear();
+    publish({ scanContents(fileName, contents) });
+}
 
-    Scanner scanner(&contents);
-    scanner.enableContextRecognition();
+// Lines between two scanner checkpoints, an incremental update rescans at most
+// about this many lines more than what was edited.
+static const int CheckpointInterval = 64;
 
-    const QString *fileNamePtr = &data->fileName;
+// Turns the tokens of a scanner into symbols of a Data.
+class SymbolCollector
+{
+public:
+    SymbolCollector(CodeModel::Data *data, int firstLine = 0)
+        : m_data(data)
+        , m_strings(StringTable::instance())
+        , m_nextCheckpoint(firstLine + CheckpointInterval)
+    {}
+
+    template <typename Scanner>
+    void scan(Scanner &scanner)
+    {
+        OCaml::Token token;
+        while ((token = scanner.read()).kind != OCaml::Token::EndOfText) {
+            collect(scanner, token);
+            if (scanner.atLineEnd() && scanner.currentLine() >= m_nextCheckpoint) {
+                m_data->checkpoints << scanner.checkpoint();
+                m_nextCheckpoint = scanner.currentLine() + CheckpointInterval;
+            }
+        }
+    }
+
+    void finish()
+    {
+        m_data->methods.squeeze();
+        m_data->classes.squeeze();
+        m_data->constantsDecl.squeeze();
+        m_data->identifiers = toSortedVector(m_identifiers);
+        m_data->constants = toSortedVector(m_constants);
+        m_data->symbols = toSortedVector(m_symbols);
+    }
+
+    // Incremental updates cannot tell which names disappeared with the edited lines,
+    // so they keep the old ones until the next full scan.
+    void keepNames(const CodeModel::Data &data)
+    {
+        for (Id id : data.identifiers)
+            m_identifiers << id;
+        for (Id id : data.constants)
+            m_constants << id;
+        for (Id id : data.symbols)
+            m_symbols << id;
+    }
 
-    Token token;
-    Token previousToken;
-    while ((token = scanner.read()).kind != Token::EndOfBlock) {
+private:
+    Id intern(const QChar *data, int size) { return m_strings->intern(data, size); }
+    Id intern(const char *data, int size) { return m_strings->internUtf8(data, size); }
+
+    template <typename Scanner>
+    void collect(Scanner &scanner, const OCaml::Token &token)
+    {
+        QSet<Id> *names = nullptr;
         switch (token.kind) {
-        case Token::Method:
-            data->methods << createSymbol(fileNamePtr, contents, scanner, token);
-            break;
-        case Token::Parameter:
-            addMethodParameter(data->methods.last(), contents.mid(token.position, token.length));
+        case OCaml::Token::Identifier:
+            names = &m_identifiers;
             break;
-        case Token::Identifier:
-            data->identifiers << contents.mid(token.position, token.length);
+        case OCaml::Token::Capitalized:
+            names = &m_constants;
             break;
-        case Token::Constant:
-            if (previousToken.kind == Token::KeywordClass)
-                data->classes << createSymbol(fileNamePtr, contents, scanner, token);
-            data->constants << contents.mid(token.position, token.length);
+        case OCaml::Token::PolyVariant:
+            names = &m_symbols;
             break;
-        case Token::Symbol:
-        case Token::SymbolHashKey:
-            parseRubySymbol(contents, token, data->symbols);
+        default:
             break;
-        case Token::OperatorAssign:
-            if (previousToken.kind == Token::Constant)
-                data->constantsDelc << createSymbol(fileNamePtr, contents, scanner, previousToken);
+        }
+        if (!names && !scanner.isDeclaration())
+            return;
+
+        const Id name = intern(scanner.tokenData(token), token.length);
+        if (names)
+            *names << name;
+        if (!scanner.isDeclaration())
+            return;
+
+        const Symbol::Kind kind = scanner.declarationKind();
+        SymbolTable *table = &m_data->classes;
+        if (kind == Symbol::Value || kind == Symbol::External)
+            table = &m_data->methods;
+        else if (kind == Symbol::Exception)
+            table = &m_data->constantsDecl;
+        table->append(name, StringTable::EmptyId, m_strings->intern(scanner.contextName()),
+                      scanner.currentLine(), scanner.currentColumn(token), kind);
+    }
+
+    CodeModel::Data *m_data;
+    StringTable *m_strings;
+    int m_nextCheckpoint;
+
+    QSet<Id> m_identifiers;
+    QSet<Id> m_constants;
+    QSet<Id> m_symbols;
+};
+
+template <typename Stream>
+static std::shared_ptr<CodeModel::Data> scanStream(const QString &fileName, const Stream &src, int lineCount)
+{
+    auto data = std::make_shared<CodeModel::Data>(fileName);
+
+    OCaml::BasicDeclarationScanner<Stream> scanner(src, OCaml::DeclarationScanner::moduleNameFor(fileName));
+    SymbolCollector collector(data.get());
+    collector.scan(scanner);
+    collector.finish();
+
+    data->lineCount = lineCount;
+    data->lastUpdate = QDateTime::currentDateTime();
+    return data;
+}
+
+std::shared_ptr<CodeModel::Data> CodeModel::scanContents(const QString &fileName, const QString &contents)
+{
+    return scanStream(fileName, SourceCodeStream(&contents), contents.count(QLatin1Char('\n')) + 1);
+}
+
+// Scans the UTF-8 bytes of the file where they are, mapped when possible, and
+// only decodes the names kept in the model.
+std::shared_ptr<CodeModel::Data> CodeModel::scanFile(const QString &fileName, QFile &file)
+{
+    const qint64 size = file.size();
+    uchar *mapped = size > 0 && size < INT_MAX ? file.map(0, size) : nullptr;
+    QByteArray contents;
+    if (!mapped)
+        contents = file.readAll();
+    const char *bytes = mapped ? reinterpret_cast<const char *>(mapped) : contents.constData();
+    const int length = mapped ? int(size) : contents.size();
+
+    const int lineCount = int(std::count(bytes, bytes + length, '\n')) + 1;
+    std::shared_ptr<Data> data = scanStream(fileName, Utf8SourceCodeStream(bytes, length), lineCount);
+    if (mapped)
+        file.unmap(mapped);
+    return data;
+}
+
+// Text of the blocks [firstBlock, lastBlock], each one preceded by a line feed
+// unless it is the first block of the document.
+static QString blocksText(const QTextDocument *document, int firstBlock, int lastBlock)
+{
+    QString text;
+    QTextBlock block = document->findBlockByNumber(firstBlock);
+    for (; block.isValid() && block.blockNumber() <= lastBlock; block = block.next()) {
+        if (block.blockNumber() > 0)
+            text += QLatin1Char('\n');
+        text += block.text();
+    }
+    return text;
+}
+
+void CodeModel::updateFile(const QString &fileName, const QTextDocument *document,
+                           int firstBlock, int lastBlock)
+{
+    if (fileName.isEmpty())
+        return;
+
+    const DataPtr old = dataFor(fileName);
+    if (!old || old->checkpoints.isEmpty()) {
+        updateFile(fileName, document->toPlainText());
+        return;
+    }
+
+    // Everything here uses 1-based lines, as the scanner does. Checkpoints are taken at
+    // the end of their line, so the edit invalidates the ones from its first line on.
+    const int lineDelta = document->blockCount() - old->lineCount;
+    const int firstLine = firstBlock + 1;
+    const int lastOldLine = lastBlock + 1 - lineDelta;
+
+    typedef OCaml::DeclarationScanner::Checkpoint Checkpoint;
+    const QString moduleName = OCaml::DeclarationScanner::moduleNameFor(fileName);
+    const QVector<Checkpoint> &checkpoints = old->checkpoints;
+    auto firstInvalid = std::lower_bound(checkpoints.begin(), checkpoints.end(), firstLine,
+                                         [](const Checkpoint &cp, int line) { return cp.line < line; });
+    auto firstAfterEdit = std::lower_bound(firstInvalid, checkpoints.end(), lastOldLine,
+                                           [](const Checkpoint &cp, int line) { return cp.line < line; });
+
+    Checkpoint state;
+    state.line = 1;
+    if (firstInvalid != checkpoints.begin())
+        state = *(firstInvalid - 1);
+    const int restartLine = firstInvalid != checkpoints.begin() ? state.line : 0;
+
+    auto data = std::make_shared<Data>(fileName);
+    auto fresh = std::make_shared<Data>(fileName);
+    SymbolCollector collector(fresh.get(), restartLine);
+    collector.keepNames(*old);
+
+    // Scan the edited lines and keep going one checkpoint at a time until the scanner
+    // state matches the one recorded before the edit, everything after it is still valid.
+    int scannedLine = restartLine;
+    int convergedLine = old->lineCount;
+    for (auto it = firstAfterEdit; ; ++it) {
+        const bool atEnd = it == checkpoints.end();
+        const int lastLine = atEnd ? document->blockCount() : it->line + lineDelta;
+        const QString text = blocksText(document, scannedLine, lastLine - 1);
+        OCaml::DeclarationScanner scanner(&text, moduleName);
+        if (scannedLine > 0)
+            scanner.restore(state);
+        collector.scan(scanner);
+        state = scanner.checkpoint();
+        scannedLine = lastLine;
+
+        if (atEnd)
             break;
-        default:
+        if (state == *it) {
+            convergedLine = it->line;
             break;
         }
-        if (token.kind != Token::Whitespace)
-            previousToken = token;
+    }
+    collector.finish();
+
+    // Splice: untouched lines before the restart point, the rescanned lines, then the
+    // rest of the old data moved by the number of lines added or removed.
+    const int lastNewLine = convergedLine + lineDelta;
+    data->methods.appendLines(old->methods, 1, restartLine);
+    data->methods.appendLines(fresh->methods, restartLine + 1, lastNewLine);
+    data->methods.appendLines(old->methods, convergedLine + 1, INT_MAX, lineDelta);
+    data->classes.appendLines(old->classes, 1, restartLine);
+    data->classes.appendLines(fresh->classes, restartLine + 1, lastNewLine);
+    data->classes.appendLines(old->classes, convergedLine + 1, INT_MAX, lineDelta);
+    data->constantsDecl.appendLines(old->constantsDecl, 1, restartLine);
+    data->constantsDecl.appendLines(fresh->constantsDecl, restartLine + 1, lastNewLine);
+    data->constantsDecl.appendLines(old->constantsDecl, convergedLine + 1, INT_MAX, lineDelta);
+
+    data->checkpoints = QVector<Checkpoint>(checkpoints.begin(), firstInvalid);
+    for (const Checkpoint &checkpoint : fresh->checkpoints) {
+        if (checkpoint.line < lastNewLine)
+            data->checkpoints << checkpoint;
+    }
+    for (auto it = firstAfterEdit; it != checkpoints.end(); ++it) {
+        if (it->line >= convergedLine) {
+            data->checkpoints << *it;
+            data->checkpoints.last().line += lineDelta;
+        }
     }
 
+    data->identifiers = fresh->identifiers;
+    data->constants = fresh->constants;
+    data->symbols = fresh->symbols;
+    data->lineCount = document->blockCount();
     data->lastUpdate = QDateTime::currentDateTime();
+    publish({ data });
 }
 
 QList<Symbol> CodeModel::methodsIn(const QString &file) const
 {
-    Data *data = m_model[file];
-    return data ? data->methods : QList<Symbol>();
+    QList<Symbol> result;
+    if (const DataPtr data = dataFor(file))
+        data->methods.appendTo(result, data->fileName);
+    return result;
+}
+
+QList<Symbol> CodeModel::declarationsIn(const QString &file) const
+{
+    QList<Symbol> result;
+    if (const DataPtr data = dataFor(file)) {
+        data->methods.appendTo(result, data->fileName);
+        data->classes.appendTo(result, data->fileName);
+        data->constantsDecl.appendTo(result, data->fileName);
+        std::sort(result.begin(), result.end(), [](const Symbol &a, const Symbol &b) {
+            return a.line < b.line || (a.line == b.line && a.column < b.column);
+        });
+    }
+    return result;
 }
 
 QSet<QString> CodeModel::identifiersIn(const QString &file) const
 {
-    Data *data = m_model[file];
-    return data ? data->identifiers : QSet<QString>();
+    const DataPtr data = dataFor(file);
+    return data ? stringsFor(data->identifiers) : QSet<QString>();
 }
 
 QSet<QString> CodeModel::constantsIn(const QString &file) const
 {
-    Data *data = m_model[file];
-    return data ? data->constants : QSet<QString>();
+    const DataPtr data = dataFor(file);
+    return data ? stringsFor(data->constants) : QSet<QString>();
 }
 
 QSet<QString> CodeModel::symbolsIn(const QString &file) const
 {
-    Data *data = m_model[file];
-    return data ? data->symbols : QSet<QString>();
+    const DataPtr data = dataFor(file);
+    return data ? stringsFor(data->symbols) : QSet<QString>();
 }
 
 QList<Symbol> CodeModel::allMethods() const
 {
     QList<Symbol> result;
-    for (const Data *data : m_model)
-        result << data->methods;
+    const auto model = snapshot();
+    for (const DataPtr &data : *model)
+        data->methods.appendTo(result, data->fileName);
     return result;
 }
 
 QList<Symbol> CodeModel::allClasses() const
 {
     QList<Symbol> result;
-    for (const Data *data : m_model)
-        result << data->classes;
+    const auto model = snapshot();
+    for (const DataPtr &data : *model)
+        data->classes.appendTo(result, data->fileName);
     return result;
 }
 
 QList<Symbol> CodeModel::allMethodsNamed(const QString &name) const
 {
     QList<Symbol> result;
-    const int nameLength = name.length();
+    const Id nameId = StringTable::instance()->lookup(name);
+    if (nameId == StringTable::EmptyId)
+        return result;
+    const auto model = snapshot();
     // FIXME: Replace this linear brute force approach
-    for (const Data *data : m_model) {
-        for (const Symbol &symbol : data->methods) {
-            const QString &symbolName = symbol.name;
-            if (symbolName.startsWith(name)) {
-                if (symbolName.length() > nameLength && symbolName[nameLength] != '(')
-                    continue;
-                result << symbol;
-            }
+    for (const DataPtr &data : *model) {
+        const SymbolTable &methods = data->methods;
+        for (int i = 0; i < methods.size(); ++i) {
+            if (methods.name(i) == nameId)
+                result << methods.symbol(i, data->fileName);
         }
     }
     return result;
@@ -257,23 +565,76 @@ QList<Symbol> CodeModel::allMethodsNamed(const QString &name) const
 QList<Symbol> CodeModel::allClassesAndConstantsNamed(const QString &name) const
 {
     QList<Symbol> result;
+    const Id nameId = StringTable::instance()->lookup(name);
+    if (nameId == StringTable::EmptyId)
+        return result;
+    const auto model = snapshot();
     // FIXME: Replace this linear brute force approach
-    for (const Data *data : m_model) {
-        for (const Symbol &symbol : data->classes) {
-            if (symbol.name == name)
-                result << symbol;
+    for (const DataPtr &data : *model) {
+        for (int i = 0; i < data->classes.size(); ++i) {
+            if (data->classes.name(i) == nameId)
+                result << data->classes.symbol(i, data->fileName);
         }
     }
 
     // constants are less important, keep them at the bottom.
-    for (const Data *data : m_model) {
-        for (const Symbol &symbol : data->constantsDelc) {
-            if (symbol.name == name)
-                result << symbol;
+    for (const DataPtr &data : *model) {
+        for (int i = 0; i < data->constantsDecl.size(); ++i) {
+            if (data->constantsDecl.name(i) == nameId)
+                result << data->constantsDecl.symbol(i, data->fileName);
         }
     }
 
     return result;
 }
 
+QList<Symbol> CodeModel::declarationsStartingWith(const QString &prefix, const QString &modulePath) const
+{
+    QList<Symbol> result;
+    StringTable *strings = StringTable::instance();
+    const QString pathSuffix = QLatin1Char('.') + modulePath;
+    const auto model = snapshot();
+    for (const DataPtr &data : *model) {
+        for (const SymbolTable *table : { &data->methods, &data->classes, &data->constantsDecl }) {
+            for (int i = 0; i < table->size(); ++i) {
+                if (!strings->string(table->name(i)).startsWith(prefix))
+                    continue;
+                if (!modulePath.isEmpty()) {
+                    const QString context = strings->string(table->context(i));
+                    if (context != modulePath && !context.endsWith(pathSuffix))
+                        continue;
+                }
+                result << table->symbol(i, data->fileName);
+            }
+        }
+    }
+    return result;
+}
+
+QString CodeModel::memoryReport(bool perFile) const
+{
+    QString report;
+    QTextStream out(&report);
+    qint64 totalBefore = 0;
+    qint64 totalAfter = 0;
+
+    const auto model = snapshot();
+    for (const DataPtr &data : *model) {
+        const qint64 before = data->legacyMemoryUsage();
+        const qint64 after = data->memoryUsage();
+        if (perFile)
+            out << data->fileName << ": " << before << " -> " << after << " bytes\n";
+        totalBefore += before;
+        totalAfter += after;
+    }
+
+    const qint64 shared = StringTable::instance()->memoryUsage();
+    const int files = qMax(model->size(), 1);
+    out << model->size() << " files, " << StringTable::instance()->count() << " interned strings ("
+        << shared << " bytes)\n";
+    out << "per file: " << totalBefore / files << " -> " << (totalAfter + shared) / files
+        << " bytes (string table included)\n";
+    return report;
+}
+
 }
@@ -2,15 +2,30 @@
 #define Ruby_CodeModel_h
 
 #include <QDateTime>
+#include <QFutureWatcher>
 #include <QMetaType>
 #include <QIODevice>
 #include <QObject>
 #include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QSet>
+#include <QThreadPool>
+
+#include <atomic>
+#include <memory>
 
 #include "RubySymbol.h"
 
+QT_FORWARD_DECLARE_CLASS(QFile)
+QT_FORWARD_DECLARE_CLASS(QTextDocument)
+
 namespace OCamlCreator {
 
+// The model is published as an immutable snapshot of immutable per-file data.
+// Readers (on any thread) grab the current snapshot without locking, writers
+// serialize among themselves, copy the file table, replace the entries they
+// touch and atomically swap the new snapshot in.
 class CodeModel : QObject
 {
     Q_OBJECT
@@ -18,17 +33,34 @@ class CodeModel : QObject
     Q_DISABLE_COPY(CodeModel)
 
 public:
+    // What the model knows about one file, see OCamlCodeModelData.h.
+    class Data;
+
     CodeModel();
     ~CodeModel();
 
     static CodeModel *instance();
     void removeSymbolsFrom(const QString &file);
     void addFile(const QString &file);
-    void addFiles(const QStringList &files);
+    // Reads and scans the files on the global thread pool, the results are merged
+    // into the model in one batch when all of them are done (or the task is canceled).
+    // When indexFile is given, files that did not change since it was written are
+    // loaded from it instead of being scanned, and it is rewritten afterwards.
+    void addFiles(const QStringList &files, const QString &indexFile = QString());
     // pass a QIODevice because the file may not be saved on file system.
     void updateFile(const QString &fileName, const QString &contents);
+    // Rescans only the blocks [firstBlock, lastBlock] of the edited document, plus
+    // whatever follows until the OCaml declaration scanner is back in the state it
+    // had before the edit, see OCaml::DeclarationScanner::Checkpoint.
+    void updateFile(const QString &fileName, const QTextDocument *document, int firstBlock, int lastBlock);
+
+    // Bumped every time a new snapshot is published, tells cached views of the
+    // model (e.g. the locator indexes) when to rebuild.
+    quint64 revision() const { return m_revision.load(); }
 
     QList<Symbol> methodsIn(const QString &file) const;
+    // Every declaration of the file, whatever its kind.
+    QList<Symbol> declarationsIn(const QString &file) const;
     QSet<QString> identifiersIn(const QString &file) const;
     QSet<QString> constantsIn(const QString &file) const;
     QSet<QString> symbolsIn(const QString &file) const;
@@ -36,11 +68,46 @@ public:
     QList<Symbol> allClasses() const;
     QList<Symbol> allMethodsNamed(const QString &name) const;
     QList<Symbol> allClassesAndConstantsNamed(const QString &name) const;
+    // Declarations whose name starts with prefix, only those declared directly in
+    // modulePath (or a module path ending with it) when one is given.
+    QList<Symbol> declarationsStartingWith(const QString &prefix, const QString &modulePath = QString()) const;
+
+    // Bytes used per file by the compact layout next to an estimate of what the
+    // old QSet<QString>/QList<Symbol> layout would take for the same data.
+    // Goes over the whole model, for the benchmarks.
+    QString memoryReport(bool perFile = true) const;
 
 private:
+    class IndexFile;
+    struct FileIndexer;
+    typedef std::shared_ptr<const Data> DataPtr;
+    typedef QHash<QString, DataPtr> Snapshot;
 
-    class Data;
-    QHash<QString, Data*> m_model;
+    static bool isIndexable(const QString &file);
+    static std::shared_ptr<Data> scanContents(const QString &fileName, const QString &contents);
+    static std::shared_ptr<Data> scanFile(const QString &fileName, QFile &file);
+    void publish(const QList<DataPtr> &results);
+    // Results of a batch started at generation: files removed or updated
+    // since then, and files with newer data, keep what they have.
+    void publishBatch(const QList<DataPtr> &results, quint64 generation);
+    void saveIndex(const QString &indexFile);
+
+    std::shared_ptr<const Snapshot> snapshot() const;
+    DataPtr dataFor(const QString &file) const;
+    void setSnapshot(const std::shared_ptr<const Snapshot> &next);
+
+    std::shared_ptr<const Snapshot> m_snapshot;
+    std::atomic<quint64> m_revision;
+    QMutex m_writeMutex;
+    // Bumped by every removal and every publish, with the generation of the
+    // last change of each file. Guarded by m_writeMutex.
+    quint64 m_generation;
+    QHash<QString, quint64> m_changedAt;
+    QList<QFutureWatcher<DataPtr>*> m_indexers;
+    // Files saved in each on-disk index, only touched from the GUI thread.
+    QHash<QString, QSet<QString>> m_indexFiles;
+    // Single thread, so writes to the same index never overlap.
+    QThreadPool m_indexWriter;
 };
 
 }
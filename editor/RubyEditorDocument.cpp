@@ -1,4 +1,5 @@
 #include "RubyEditorDocument.h"
+#include "OCamlSemanticHighlighter.h"
 #include "../RubyConstants.h"
 #include "../RubyPlugin.h"
 
@@ -6,6 +7,7 @@ namespace OCamlCreator
 {
 
 EditorDocument::EditorDocument()
+    : m_semanticHighlighter(new SemanticHighlighter(this))
 {
     setId(Constants::OCaml::EditorId);
 }
@@ -5,12 +5,19 @@
 
 namespace OCamlCreator {
 
+class SemanticHighlighter;
+
 class EditorDocument : public TextEditor::TextDocument
 {
 public:
     explicit EditorDocument();
 
     TextEditor::QuickFixAssistProvider *quickFixAssistProvider() const override;
+
+    SemanticHighlighter *semanticHighlighter() const { return m_semanticHighlighter; }
+
+private:
+    SemanticHighlighter *m_semanticHighlighter;
 };
 
 }
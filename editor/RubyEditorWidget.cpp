@@ -1,21 +1,28 @@
 #include "RubyEditorWidget.h"
 
 #include "RubyAmbiguousMethodAssistProvider.h"
+#include "OCamlBlockData.h"
+#include "OCamlCompletionAssist.h"
 #include "RubyAutoCompleter.h"
 #include "RubyCodeModel.h"
+#include "RubyEditorDocument.h"
 #include "../RubyConstants.h"
 #include "RubyHighlighter.h"
 #include "RubyIndenter.h"
 #include "RubyRubocopHighlighter.h"
+#include "OCamlSemanticHighlighter.h"
 
 #include <texteditor/textdocument.h>
 #include <texteditor/convenience.h>
+#include <texteditor/fontsettings.h>
+#include <texteditor/texteditorconstants.h>
 #include <coreplugin/icontext.h>
 #include <coreplugin/actionmanager/actionmanager.h>
 #include <coreplugin/actionmanager/actioncontainer.h>
 
 
 #include <QtCore/QDebug>
+#include <QtCore/QPointer>
 #include <QtGui/QTextBlock>
 #include <QtGui/QTextCursor>
 #include <QtWidgets/QMenu>
@@ -26,11 +33,19 @@ namespace OCamlCreator {
 
 const int CODEMODEL_UPDATE_INTERVAL = 150;
 const int RUBOCOP_UPDATE_INTERVAL = 300;
+const int USES_UPDATE_INTERVAL = 250;
 
 EditorWidget::EditorWidget()
     : m_wordRegex("[\\w!\\?]+")
     , m_codeModelUpdatePending(false)
+    , m_dirtyFirstBlock(-1)
+    , m_dirtyLastBlock(-1)
+    , m_blockCount(0)
     , m_rubocopUpdatePending(false)
+    , m_usesRevision(-1)
+    , m_usesPosition(-1)
+    , m_usesAreLocal(false)
+    , m_occurrencesRevision(-1)
     , m_ambigousMethodAssistProvider(new AmbigousMethodAssistProvider)
 {
     setLanguageSettingsId(Constants::OCaml::SettingsId);
@@ -41,10 +56,10 @@ EditorWidget::EditorWidget()
 
     m_updateCodeModelTimer.setSingleShot(true);
     m_updateCodeModelTimer.setInterval(CODEMODEL_UPDATE_INTERVAL);
-//    connect(&m_updateCodeModelTimer, &QTimer::timeout, this, [this] {
-//        if (m_codeModelUpdatePending)
-//            updateCodeModel();
-//    });
+    connect(&m_updateCodeModelTimer, &QTimer::timeout, this, [this] {
+        if (m_codeModelUpdatePending)
+            updateCodeModel();
+    });
 
     m_updateRubocopTimer.setSingleShot(true);
     m_updateRubocopTimer.setInterval(RUBOCOP_UPDATE_INTERVAL);
@@ -53,6 +68,10 @@ EditorWidget::EditorWidget()
 //            updateRubocop();
 //    });
 
+    m_updateUsesTimer.setSingleShot(true);
+    m_updateUsesTimer.setInterval(USES_UPDATE_INTERVAL);
+    connect(&m_updateUsesTimer, &QTimer::timeout, this, &EditorWidget::updateUses);
+
     connect(RubocopHighlighter::instance(), &RubocopHighlighter::codeWarningsUpdated,
             this, &EditorWidget::onCodeWarningsUpdated );
     CodeModel::instance();
@@ -102,6 +121,54 @@ void EditorWidget::findUsages()
     RubocopHighlighter::instance()->performFindUsages(textDocument(), line, col);
 }
 
+void EditorWidget::onContentsChange(int position, int charsRemoved, int charsAdded)
+{
+    Q_UNUSED(charsRemoved);
+    const int blockCount = document()->blockCount();
+    const int firstBlock = document()->findBlock(position).blockNumber();
+    const int lastBlock = document()->findBlock(position + charsAdded).blockNumber();
+
+    if (m_dirtyFirstBlock < 0) {
+        m_dirtyFirstBlock = firstBlock;
+        m_dirtyLastBlock = lastBlock;
+    } else {
+        // Keep the pending range in the numbering of the current document.
+        if (m_dirtyLastBlock >= firstBlock)
+            m_dirtyLastBlock = qMax(m_dirtyLastBlock + blockCount - m_blockCount, firstBlock);
+        m_dirtyFirstBlock = qMin(m_dirtyFirstBlock, firstBlock);
+        m_dirtyLastBlock = qMax(m_dirtyLastBlock, lastBlock);
+    }
+    m_blockCount = blockCount;
+
+    scheduleCodeModelUpdate();
+}
+
+// Completion is told whether the cursor is in a comment or a string, which
+// the highlighted blocks know.
+TextEditor::AssistInterface *EditorWidget::createAssistInterface(TextEditor::AssistKind assistKind,
+                                                                 TextEditor::AssistReason assistReason) const
+{
+    if (assistKind != TextEditor::Completion)
+        return TextEditorWidget::createAssistInterface(assistKind, assistReason);
+
+    const QTextBlock block = textCursor().block();
+    const bool inCommentOrString = OCaml::isInCommentOrString(block, textCursor().positionInBlock());
+    return new CompletionAssistInterface(document(), position(), textDocument()->filePath().toString(),
+                                         assistReason, inCommentOrString);
+}
+
+// Large documents are highlighted from what this editor shows, semantic
+// highlighting always starts there.
+void EditorWidget::updateVisibleBlocks()
+{
+    const int first = firstVisibleBlock().blockNumber();
+    const int last = cursorForPosition(QPoint(0, viewport()->height() - 1)).blockNumber();
+    if (auto highlighter = dynamic_cast<Highlighter *>(textDocument()->syntaxHighlighter()))
+        highlighter->setVisibleBlocks(first, last);
+    if (auto document = dynamic_cast<EditorDocument *>(textDocument()))
+        document->semanticHighlighter()->setVisibleBlocks(first, last);
+}
+
 void EditorWidget::scheduleCodeModelUpdate()
 {
     qDebug() << Q_FUNC_INFO;
@@ -116,8 +183,12 @@ void EditorWidget::scheduleCodeModelUpdate()
 
 void EditorWidget::updateCodeModel()
 {
-    const QString textData = textDocument()->plainText();
-    //CodeModel::instance()->updateFile(textDocument()->filePath().toString(), textData);
+    if (m_dirtyFirstBlock < 0)
+        return;
+
+    CodeModel::instance()->updateFile(textDocument()->filePath().toString(), document(),
+                                      m_dirtyFirstBlock, m_dirtyLastBlock);
+    m_dirtyFirstBlock = m_dirtyLastBlock = -1;
 }
 
 void EditorWidget::scheduleRubocopUpdate()
@@ -140,6 +211,115 @@ void EditorWidget::updateRubocop()
     }
 }
 
+// Uses of the identifier under the cursor, from merlin's "occurrences" of
+// the current revision when it has them already.
+void EditorWidget::updateUses()
+{
+    const QTextCursor cursor = textCursor();
+    const QTextBlock block = cursor.block();
+    // The identifier the cursor ends or, failing that, starts.
+    OCaml::Token token = OCaml::tokenAt(block, cursor.positionInBlock());
+    if (token.kind != OCaml::Token::Identifier && token.kind != OCaml::Token::Capitalized)
+        token = OCaml::tokenAt(block, cursor.positionInBlock() + 1);
+    if (token.kind != OCaml::Token::Identifier && token.kind != OCaml::Token::Capitalized) {
+        m_usesPosition = -1;
+        setExtraSelections(CodeSemanticsSelection, QList<QTextEdit::ExtraSelection>());
+        return;
+    }
+
+    const int revision = document()->revision();
+    const int position = block.position() + token.position;
+    const bool sameIdentifier = revision == m_usesRevision && position == m_usesPosition;
+    if (sameIdentifier && !m_usesAreLocal)
+        return;
+    m_usesRevision = revision;
+    m_usesPosition = position;
+
+    if (revision != m_occurrencesRevision) {
+        m_occurrences.clear();
+        m_occurrencesRevision = revision;
+    }
+    const QString name = block.text().mid(token.position, token.length);
+    for (const QVector<Range> &uses : m_occurrences.value(name)) {
+        if (uses.contains(Range(position, 0))) {
+            m_usesAreLocal = false;
+            showUses(uses);
+            return;
+        }
+    }
+
+    // Merlin would only answer after what it is doing now, try again later.
+    RubocopHighlighter *merlin = RubocopHighlighter::instance();
+    if (merlin->isBusy()) {
+        if (!sameIdentifier)
+            showUses(localUses(name));
+        m_usesAreLocal = true;
+        m_updateUsesTimer.start();
+        return;
+    }
+
+    m_usesAreLocal = false;
+    QPointer<EditorWidget> self(this);
+    merlin->performOccurrences(textDocument(), block.blockNumber() + 1, token.position,
+                               [self, revision, name](const QList<Range> &occurrences) {
+        if (self)
+            self->onOccurrences(revision, name, occurrences);
+    });
+}
+
+void EditorWidget::onOccurrences(int revision, const QString &name, const QList<Range> &occurrences)
+{
+    if (revision != document()->revision() || revision != m_occurrencesRevision)
+        return;
+
+    QVector<Range> uses;
+    for (const Range &occurrence : occurrences) {
+        const QTextBlock start = document()->findBlockByNumber(occurrence.startLine - 1);
+        const QTextBlock end = document()->findBlockByNumber(occurrence.endLine - 1);
+        if (!start.isValid() || !end.isValid())
+            continue;
+        const int position = start.position() + occurrence.startCol;
+        uses << Range(position, end.position() + occurrence.endCol - position);
+    }
+    m_occurrences[name] << uses;
+
+    if (m_usesRevision == revision && uses.contains(Range(m_usesPosition, 0))) {
+        m_usesAreLocal = false;
+        showUses(uses);
+    }
+}
+
+QVector<Range> EditorWidget::localUses(const QString &name) const
+{
+    QVector<Range> uses;
+    for (QTextBlock block = document()->begin(); block.isValid(); block = block.next()) {
+        if (!block.text().contains(name))
+            continue;
+        for (const OCaml::Token &token : OCaml::blockTokens(block)) {
+            if ((token.kind == OCaml::Token::Identifier || token.kind == OCaml::Token::Capitalized)
+                    && block.text().midRef(token.position, token.length) == name) {
+                uses << Range(block.position() + token.position, token.length);
+            }
+        }
+    }
+    return uses;
+}
+
+void EditorWidget::showUses(const QVector<Range> &uses)
+{
+    QList<QTextEdit::ExtraSelection> selections;
+    const QTextCharFormat format = textDocument()->fontSettings().toTextCharFormat(TextEditor::C_OCCURRENCES);
+    for (const Range &use : uses) {
+        QTextEdit::ExtraSelection selection;
+        selection.format = format;
+        selection.cursor = QTextCursor(document());
+        selection.cursor.setPosition(use.pos);
+        selection.cursor.setPosition(use.pos + use.length, QTextCursor::KeepAnchor);
+        selections << selection;
+    }
+    setExtraSelections(CodeSemanticsSelection, selections);
+}
+
 void EditorWidget::contextMenuEvent(QContextMenuEvent *e)
 {
     QPointer<QMenu> menu(new QMenu(this));
@@ -208,8 +388,12 @@ void EditorWidget::finalizeInitialization()
 {
     qDebug() << Q_FUNC_INFO;
     // TODO: we probably do not need code model update in presence of merlin
-//    connect(document(), &QTextDocument::contentsChanged, this, &EditorWidget::scheduleCodeModelUpdate);
+    m_blockCount = document()->blockCount();
+    connect(document(), &QTextDocument::contentsChange, this, &EditorWidget::onContentsChange);
     connect(document(), &QTextDocument::contentsChanged, this, &EditorWidget::scheduleRubocopUpdate);
+    connect(this, &QPlainTextEdit::updateRequest, this, &EditorWidget::updateVisibleBlocks);
+    connect(this, &QPlainTextEdit::cursorPositionChanged,
+            &m_updateUsesTimer, static_cast<void (QTimer::*)()>(&QTimer::start));
 }
 
 }
@@ -1,8 +1,12 @@
 #ifndef RubyEditorWidget_h
 #define RubyEditorWidget_h
 
+#include "RubyRubocopHighlighter.h"
+
+#include <QtCore/QHash>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QTimer>
+#include <QtCore/QVector>
 
 #include <texteditor/texteditor.h>
 #include <utils/uncommentselection.h>
@@ -29,28 +33,52 @@ public:
     virtual void openLinkUnderCursor() Q_DECL_OVERRIDE;
 protected:
     void finalizeInitialization() override;
+    TextEditor::AssistInterface *createAssistInterface(TextEditor::AssistKind assistKind,
+                                                       TextEditor::AssistReason assistReason) const override;
     void contextMenuEvent(QContextMenuEvent *) override;
 
 private slots:
+    void onContentsChange(int position, int charsRemoved, int charsAdded);
+    void updateVisibleBlocks();
     void scheduleCodeModelUpdate();
 
     void scheduleRubocopUpdate();
     void updateCodeModel();
     void updateRubocop();
+    void updateUses();
 
     void onCodeWarningsUpdated(const Utils::FileName& name,
                                unsigned revision,
                                const TextEditor::RefactorMarkers &refactorMarkers);
 
 private:
+    void onOccurrences(int revision, const QString &name, const QList<Range> &occurrences);
+    QVector<Range> localUses(const QString &name) const;
+    void showUses(const QVector<Range> &uses);
+
     QRegularExpression m_wordRegex;
     Utils::CommentDefinition m_commentDefinition;
     QTimer m_updateCodeModelTimer;
     bool m_codeModelUpdatePending;
+    // Blocks edited since the last code model update, -1 when there are none.
+    int m_dirtyFirstBlock;
+    int m_dirtyLastBlock;
+    int m_blockCount;
 
     QTimer m_updateRubocopTimer;
     bool m_rubocopUpdatePending;
 
+    // The identifier whose uses are shown, by its position. Local uses are
+    // the document's tokens of the same name, shown while merlin is busy.
+    QTimer m_updateUsesTimer;
+    int m_usesRevision;
+    int m_usesPosition;
+    bool m_usesAreLocal;
+    // What merlin found for m_occurrencesRevision, the uses of every binding
+    // of a name asked for so far.
+    int m_occurrencesRevision;
+    QHash<QString, QList<QVector<Range>>> m_occurrences;
+
     QString m_filePathDueToMaybeABug;
 
     AmbigousMethodAssistProvider *m_ambigousMethodAssistProvider;
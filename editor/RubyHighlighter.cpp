@@ -1,62 +1,87 @@
 #include "RubyHighlighter.h"
-#include "RubyScanner.h"
+#include "OCamlBlockData.h"
 
 #include <texteditor/textdocument.h>
 #include <texteditor/texteditorconstants.h>
 #include <texteditor/texteditorsettings.h>
 #include <texteditor/fontsettings.h>
 #include <QDebug>
+#include <QElapsedTimer>
+
+#include <algorithm>
 
 namespace OCamlCreator {
 
 QVector<QTextCharFormat> Highlighter::m_formats;
+quint8 Highlighter::m_formatIds[OCaml::Token::EndOfText + 1];
+
+using OCaml::Token;
+
+// Every token kind refers to one of these formats, kinds that look the same
+// share theirs so that their tokens can make a single range.
+enum FormatId {
+    Format_Default,
+    Format_Keyword,
+    Format_Modifier,
+    Format_String,
+    Format_Comment,
+    Format_Capitalized,
+    Format_Number,
+    Format_PolyVariant,
+    Format_Label,
+    Format_TypeVariable,
+    FormatCount
+};
 
-static void initFormats(QVector<QTextCharFormat> &formats)
+static void initFormats(QVector<QTextCharFormat> &formats, quint8 *formatIds)
 {
-    formats.resize(Token::EndOfBlock);
-
-    QTextCharFormat &keywordFormat = formats[Token::Keyword];
-    keywordFormat.setFontWeight(75);
-    const Token::Kind keywordTokens[] = {
-        Token::KeywordDef,
-        Token::KeywordClass,
-        Token::KeywordModule,
-        Token::KeywordFlowControl,
-        Token::KeywordLoop,
-        Token::KeywordBlockStarter,
-        Token::KeywordEnd,
-        Token::KeywordElseElsIfRescueEnsure
-    };
-    for (unsigned tk = 0; tk < sizeof(keywordTokens) / sizeof(*keywordTokens); ++tk)
-        formats[keywordTokens[tk]] = keywordFormat;
-
-
-    formats[Token::KeywordVisibility].setForeground(QColor(0, 0, 255));
-    formats[Token::KeywordVisibility].setFontWeight(75);
-    formats[Token::KeywordSelf].setForeground(QColor(68, 85, 136));
-    formats[Token::KeywordSelf].setFontWeight(75);
-    formats[Token::String].setForeground(QColor(208, 16, 64));
-    formats[Token::InStringCode].setForeground(QColor(0, 110, 40));
-    formats[Token::Backtick] = formats[Token::String];
-    formats[Token::Comment].setForeground(QColor(153, 153, 136));
-    formats[Token::Constant].setForeground(QColor(0, 128, 128));
-    formats[Token::Global].setForeground(QColor(0, 128, 128));
-    formats[Token::Regexp].setForeground(QColor(0, 153, 38));
-    formats[Token::ClassField].setForeground(QColor(0, 128, 128));
-    formats[Token::Number].setForeground(QColor(0, 153, 153));
-    formats[Token::Symbol].setForeground(QColor(153, 0, 115));
-    formats[Token::SymbolHashKey].setForeground(QColor(70, 0, 115));
-    formats[Token::Method].setForeground(QColor(153, 0, 0));
-    formats[Token::Method].setFontWeight(75);
-    formats[Token::Parameter].setFontItalic(true);
-    formats[Token::Parameter].setForeground(QColor(0, 134, 179));
+    formats.resize(FormatCount);
+
+    formats[Format_Keyword].setFontWeight(75);
+    formats[Format_Modifier] = formats[Format_Keyword];
+    formats[Format_Modifier].setForeground(QColor(0, 0, 255));
+    formats[Format_String].setForeground(QColor(208, 16, 64));
+    formats[Format_Comment].setForeground(QColor(153, 153, 136));
+    formats[Format_Capitalized].setForeground(QColor(0, 128, 128));
+    formats[Format_Number].setForeground(QColor(0, 153, 153));
+    formats[Format_PolyVariant].setForeground(QColor(153, 0, 115));
+    formats[Format_Label].setForeground(QColor(70, 0, 115));
+    formats[Format_TypeVariable].setFontItalic(true);
+    formats[Format_TypeVariable].setForeground(QColor(0, 134, 179));
+
+    std::fill(formatIds, formatIds + Token::EndOfText + 1, quint8(Format_Default));
+    for (int kind = Token::Keyword; kind < Token::KeywordModifier; ++kind)
+        formatIds[kind] = Format_Keyword;
+    formatIds[Token::KeywordModifier] = Format_Modifier;
+    formatIds[Token::String] = Format_String;
+    formatIds[Token::Char] = Format_String;
+    formatIds[Token::Comment] = Format_Comment;
+    formatIds[Token::Capitalized] = Format_Capitalized;
+    formatIds[Token::Number] = Format_Number;
+    formatIds[Token::PolyVariant] = Format_PolyVariant;
+    formatIds[Token::Label] = Format_Label;
+    formatIds[Token::TypeVariable] = Format_TypeVariable;
 }
 
+// Blocks around the visible ones that are highlighted along with them.
+static const int VisibleMargin = 50;
+// Time the idle pass takes at once before it lets events through.
+static const int PendingSliceTime = 10;
+
 Highlighter::Highlighter(QTextDocument *parent)
     : TextEditor::SyntaxHighlighter(parent)
+    , m_firstVisibleBlock(0)
+    , m_lastVisibleBlock(-1)
+    , m_nextPendingBlock(0)
+    , m_blocksWithoutPending(0)
+    , m_highlightingPending(false)
 {
     if (m_formats.empty())
-        initFormats(m_formats);
+        initFormats(m_formats, m_formatIds);
+
+    m_pendingTimer.setSingleShot(true);
+    m_pendingTimer.setInterval(0);
+    connect(&m_pendingTimer, &QTimer::timeout, this, &Highlighter::highlightPendingBlocks);
 }
 
 void Highlighter::highlightBlock(const QString &text)
@@ -64,48 +89,218 @@ void Highlighter::highlightBlock(const QString &text)
     int initialState = previousBlockState();
     if (initialState == -1)
         initialState = 0;
-    setCurrentBlockState(highlightLine(text, initialState));
+
+    const QTextBlock block = currentBlock();
+    if (m_highlightingPending || !isLargeDocument() || isVisible(block.blockNumber())) {
+        setCurrentBlockState(highlightLine(text, initialState));
+        return;
+    }
+
+    // The state is enough for the next blocks, the rest can wait. The block
+    // loses its formats until then.
+    schedulePendingBlocks();
+    setCurrentBlockState(scanLine(text, initialState));
+}
+
+// The lexer state takes the low bits of the block state, the nesting depth of
+// brackets and struct/sig/object/begin blocks at the end of the line the rest.
+// The depth gives the folding indent of the next line.
+static const int MaxDepth = (0x7fffffff >> OCaml::Lexer::StateBits);
+
+static bool isCloser(Token::Kind kind)
+{
+    return kind == Token::CloseParen || kind == Token::CloseBracket || kind == Token::CloseBrace
+            || kind == Token::KeywordEnd;
+}
+
+static int nestingChange(Token::Kind kind)
+{
+    switch (kind) {
+    case Token::OpenParen:
+    case Token::OpenBracket:
+    case Token::OpenBrace:
+    case Token::KeywordStruct:
+    case Token::KeywordSig:
+    case Token::KeywordObject:
+    case Token::KeywordBegin:
+        return 1;
+    case Token::CloseParen:
+    case Token::CloseBracket:
+    case Token::CloseBrace:
+    case Token::KeywordEnd:
+        return -1;
+    default:
+        return 0;
+    }
 }
 
 int Highlighter::highlightLine(const QString &text, int state)
 {
     m_currentBlockParentheses.clear();
 
-    Scanner scanner(&text);
-    scanner.setState(state & 0xfffff);
+    const QTextBlock block = currentBlock();
+    OCaml::BlockData *data = OCaml::BlockData::of(block);
+    data->revision = block.revision();
+    data->startState = state & OCaml::Lexer::StateMask;
+    data->tokens.clear();
+    data->highlighted = true;
+
+    OCaml::Lexer lexer(&text);
+    lexer.setState(data->startState);
+
+    const int initialDepth = state >> OCaml::Lexer::StateBits;
+    int depth = initialDepth;
+    int minDepth = depth;
+    data->indentRevision = block.revision();
+    data->startDepth = initialDepth;
+    data->startsWithCloser = false;
+    bool firstToken = true;
+
+    // Tokens of the same format, and the blanks between them, are set as one
+    // range. Default format ones are left as they are.
+    int rangeFormat = Format_Default;
+    int rangeStart = 0;
+    int rangeEnd = 0;
+
+    Token token;
+    while ((token = lexer.read()).kind != Token::EndOfText) {
+        data->tokens << token;
+        if (token.kind != Token::Whitespace) {
+            if (firstToken) {
+                data->startsWithCloser = isCloser(token.kind);
+                firstToken = false;
+            }
+            const int format = m_formatIds[token.kind];
+            if (format != rangeFormat) {
+                if (rangeFormat != Format_Default)
+                    setFormat(rangeStart, rangeEnd - rangeStart, m_formats.at(rangeFormat));
+                rangeFormat = format;
+                rangeStart = token.position;
+            }
+            rangeEnd = token.position + token.length;
+        }
+        switch (token.kind) {
+        case Token::OpenParen:
+        case Token::OpenBracket:
+        case Token::OpenBrace:
+            m_currentBlockParentheses << Parenthesis(Parenthesis::Opened, text.at(token.position),
+                                                     token.position);
+            break;
+        case Token::CloseParen:
+        case Token::CloseBracket:
+        case Token::CloseBrace: {
+            // |] and >} close on their last character
+            const int position = token.position + token.length - 1;
+            m_currentBlockParentheses << Parenthesis(Parenthesis::Closed, text.at(position), position);
+            break;
+        }
+        default:
+            break;
+        }
+        depth += nestingChange(token.kind);
+        minDepth = qMin(minDepth, depth);
+    }
+    if (rangeFormat != Format_Default)
+        setFormat(rangeStart, rangeEnd - rangeStart, m_formats.at(rangeFormat));
+
+    depth = qBound(0, depth, MaxDepth);
+    TextEditor::TextDocumentLayout::setFoldingIndent(block, qMax(0, minDepth));
+    TextEditor::TextDocumentLayout::setParentheses(block, m_currentBlockParentheses);
+    return (depth << OCaml::Lexer::StateBits) | lexer.state();
+}
 
-    static QString openParenthesis = "([{";
-    static QString closeParenthesis = ")]}";
+// What highlightLine() returns, and the indentation context, without
+// anything else.
+int Highlighter::scanLine(const QString &text, int state)
+{
+    const QTextBlock block = currentBlock();
+    OCaml::BlockData *data = OCaml::BlockData::of(block);
+    data->highlighted = false;
+    data->indentRevision = block.revision();
+    data->startDepth = state >> OCaml::Lexer::StateBits;
+    data->startsWithCloser = false;
+    bool firstToken = true;
 
+    OCaml::Lexer lexer(&text);
+    lexer.setState(state & OCaml::Lexer::StateMask);
+    int depth = data->startDepth;
     Token token;
-    while ((token = scanner.read()).kind != Token::EndOfBlock) {
-        setFormat(token.position, token.length, formatForToken(token));
-        if (token.isParenthesisLike()) {
-            QChar ch = text[token.position];
-            if (openParenthesis.contains(ch))
-                m_currentBlockParentheses << Parenthesis(Parenthesis::Opened, ch, token.position);
-            else if (closeParenthesis.contains(ch))
-                m_currentBlockParentheses << Parenthesis(Parenthesis::Closed, ch, token.position);
+    while ((token = lexer.read()).kind != Token::EndOfText) {
+        if (firstToken && token.kind != Token::Whitespace) {
+            data->startsWithCloser = isCloser(token.kind);
+            firstToken = false;
         }
+        depth += nestingChange(token.kind);
     }
+    depth = qBound(0, depth, MaxDepth);
+    return (depth << OCaml::Lexer::StateBits) | lexer.state();
+}
 
-    int indentLevel = state >> 20;
-    int nextIndentLevel = indentLevel + scanner.indentVariation();
-    if (scanner.didBlockInterrupt())
-        indentLevel--;
+bool Highlighter::isLargeDocument() const
+{
+    return document() && document()->blockCount() > LargeDocumentBlocks;
+}
 
-    if (nextIndentLevel < 0)
-        nextIndentLevel = 0;
+bool Highlighter::isVisible(int blockNumber) const
+{
+    return blockNumber >= m_firstVisibleBlock && blockNumber <= m_lastVisibleBlock;
+}
 
-    TextEditor::TextDocumentLayout::setFoldingIndent(currentBlock(), indentLevel);
-    TextEditor::TextDocumentLayout::setParentheses(currentBlock(), m_currentBlockParentheses);
-    return (nextIndentLevel << 20) | scanner.state();
+void Highlighter::setVisibleBlocks(int first, int last)
+{
+    first = qMax(0, first - VisibleMargin);
+    last += VisibleMargin;
+    if (first == m_firstVisibleBlock && last == m_lastVisibleBlock)
+        return;
+    m_firstVisibleBlock = first;
+    m_lastVisibleBlock = last;
+    if (isLargeDocument())
+        schedulePendingBlocks();
+}
+
+void Highlighter::schedulePendingBlocks()
+{
+    m_blocksWithoutPending = 0;
+    if (!m_pendingTimer.isActive())
+        m_pendingTimer.start();
 }
 
-QTextCharFormat Highlighter::formatForToken(const Token &token)
+// One slice of the idle time pass: the visible blocks, then the others from
+// where the last slice stopped, around the end of the document.
+void Highlighter::highlightPendingBlocks()
 {
-    Q_ASSERT(token.kind < m_formats.size());
-    return m_formats[token.kind];
+    QTextDocument *doc = document();
+    if (!doc)
+        return;
+
+    QElapsedTimer timer;
+    timer.start();
+    m_highlightingPending = true;
+
+    for (QTextBlock block = doc->findBlockByNumber(m_firstVisibleBlock);
+         block.isValid() && block.blockNumber() <= m_lastVisibleBlock; block = block.next()) {
+        if (OCaml::BlockData::isHighlightPending(block))
+            rehighlightBlock(block);
+    }
+
+    const int blockCount = doc->blockCount();
+    QTextBlock block = doc->findBlockByNumber(m_nextPendingBlock);
+    while (m_blocksWithoutPending < blockCount && timer.elapsed() < PendingSliceTime) {
+        if (!block.isValid())
+            block = doc->begin();
+        if (OCaml::BlockData::isHighlightPending(block)) {
+            rehighlightBlock(block);
+            m_blocksWithoutPending = 0;
+        } else {
+            ++m_blocksWithoutPending;
+        }
+        block = block.next();
+    }
+
+    m_highlightingPending = false;
+    m_nextPendingBlock = block.isValid() ? block.blockNumber() : 0;
+    if (m_blocksWithoutPending < blockCount)
+        m_pendingTimer.start();
 }
 
 }
@@ -3,26 +3,53 @@
 
 #include <texteditor/textdocumentlayout.h>
 #include <texteditor/syntaxhighlighter.h>
-#include "RubyScanner.h"
+#include "OCamlLexer.h"
+
+#include <QTimer>
 
 namespace OCamlCreator {
 
+// In documents of more than LargeDocumentBlocks lines only the blocks around
+// what the editors show are highlighted right away. The others only get their
+// state, which the next blocks and the indenter need, and are highlighted in
+// idle time slices, folding and parentheses included.
 class Highlighter :  public TextEditor::SyntaxHighlighter
 {
 public:
     Highlighter(QTextDocument *parent = 0);
+
+    enum { LargeDocumentBlocks = 20000 };
+
+    // Blocks an editor shows, highlighted first in large documents.
+    void setVisibleBlocks(int first, int last);
+
 protected:
     virtual void highlightBlock(const QString &text) override;
 private:
     int highlightLine(const QString &text, int state);
-    QTextCharFormat formatForToken(const Token &);
+    int scanLine(const QString &text, int state);
+
+    bool isLargeDocument() const;
+    bool isVisible(int blockNumber) const;
+    void schedulePendingBlocks();
+    void highlightPendingBlocks();
 
     static QVector<QTextCharFormat> m_formats;
+    static quint8 m_formatIds[OCaml::Token::EndOfText + 1];
 
     typedef TextEditor::Parenthesis Parenthesis;
     typedef TextEditor::Parentheses Parentheses;
 
     Parentheses m_currentBlockParentheses;
+
+    int m_firstVisibleBlock;
+    int m_lastVisibleBlock;
+    // Where the idle time pass goes on, and how many blocks in a row it found
+    // highlighted already. It stops after a whole document of them.
+    int m_nextPendingBlock;
+    int m_blocksWithoutPending;
+    bool m_highlightingPending;
+    QTimer m_pendingTimer;
 };
 
 }
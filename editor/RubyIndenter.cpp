@@ -1,21 +1,106 @@
 #include "RubyIndenter.h"
-#include "RubyScanner.h"
+#include "OCamlBlockData.h"
+#include "RubyRubocopHighlighter.h"
 
 #include <texteditor/tabsettings.h>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QProcess>
 #include <QRegularExpression>
+#include <QStandardPaths>
+#include <QTextCursor>
+#include <QTextDocument>
 #include <QDebug>
 
 namespace OCamlCreator {
 
-static bool didBlockStart(const QTextBlock &block)
+// ocp-indent usually answers in a few milliseconds, even for large files. The
+// editor waits for it, so the whole run is bounded, start included.
+static const int OcpIndentTimeout = 1000;
+static const int OcpIndentKillTimeout = 100;
+
+QString Indenter::ocpIndentExecutable()
 {
-    QString text = block.text();
-    Scanner scanner(&text);
-    scanner.readLine();
-    return scanner.indentVariation() > 0 || scanner.didBlockInterrupt();
+    const QFileInfo nextToMerlin(QFileInfo(RubocopHighlighter::merlinExecutable()).path()
+                                 + QLatin1String("/ocp-indent"));
+    return nextToMerlin.isExecutable() ? nextToMerlin.filePath()
+                                       : QStandardPaths::findExecutable(QLatin1String("ocp-indent"));
 }
 
-void Indenter::indentBlock(QTextDocument*, const QTextBlock &block, const QChar &, const TextEditor::TabSettings &settings)
+// Indentation of the lines [first, last] of document, in columns, as ocp-indent
+// gives it. ocp-indent has no server mode, a whole range of lines is asked for
+// in a single run instead. Empty when ocp-indent failed. It is looked for on
+// every run, so installing it takes effect without a restart.
+static QVector<int> ocpIndent(const QTextDocument *document, int first, int last, int indentSize)
+{
+    QVector<int> indents;
+    const QString executable = Indenter::ocpIndentExecutable();
+    if (executable.isEmpty())
+        return indents;
+
+    QElapsedTimer timer;
+    timer.start();
+    QProcess process;
+    process.start(executable,
+                  { "--numeric",
+                    "--lines", QString("%1-%2").arg(first + 1).arg(last + 1),
+                    "--config", QString("base=%1,type=%1").arg(indentSize) });
+    if (!process.waitForStarted(OcpIndentTimeout)) {
+        qWarning() << "Could not start" << executable << "to indent";
+        return indents;
+    }
+
+    // The lines after the range don't change its indentation.
+    const QTextBlock lastBlock = document->findBlockByNumber(last);
+    const int end = lastBlock.position() + lastBlock.length() - 1;
+    process.write(document->toPlainText().left(end).toUtf8());
+    process.closeWriteChannel();
+    if (!process.waitForFinished(qMax(OcpIndentTimeout - int(timer.elapsed()), 0))) {
+        process.kill();
+        process.waitForFinished(OcpIndentKillTimeout);
+        return indents;
+    }
+
+    const QList<QByteArray> lines = process.readAllStandardOutput().split('\n');
+    indents.reserve(last - first + 1);
+    for (const QByteArray &line : lines) {
+        bool ok = false;
+        const int indent = line.trimmed().toInt(&ok);
+        if (ok)
+            indents << indent;
+    }
+    if (indents.size() != last - first + 1)
+        indents.clear();
+    return indents;
+}
+
+static int blockState(const QTextBlock &block)
+{
+    return block.isValid() ? qMax(block.userState(), 0) : 0;
+}
+
+// Whether the first token of the line closes a bracket or a struct/sig/object/begin.
+static bool startsWithCloser(const QTextBlock &block)
+{
+    const QVector<OCaml::Token> tokens = OCaml::blockTokens(block);
+    for (const OCaml::Token &token : tokens) {
+        switch (token.kind) {
+        case OCaml::Token::Whitespace:
+            continue;
+        case OCaml::Token::KeywordEnd:
+        case OCaml::Token::CloseParen:
+        case OCaml::Token::CloseBracket:
+        case OCaml::Token::CloseBrace:
+            return true;
+        default:
+            return false;
+        }
+    }
+    return false;
+}
+
+// Indentation from the nesting depth at the end of the previous lines.
+static void indentByNesting(const QTextBlock &block, const TextEditor::TabSettings &settings)
 {
     int indent;
 
@@ -23,21 +108,53 @@ void Indenter::indentBlock(QTextDocument*, const QTextBlock &block, const QChar
     // Previous line ends on comma, ignore everything and follow the indent
     if (previous.text().endsWith(',')) {
         indent = previous.text().indexOf(QRegularExpression("\\S")) / settings.m_indentSize;
+    } else if (const OCaml::BlockData *data = OCaml::BlockData::indentContext(block)) {
+        // The highlighter keeps the context of every line it went over.
+        indent = data->startDepth;
+        if (data->startsWithCloser && indent > 0)
+            indent--;
     } else {
-        // Use the stored indent plus some bizarre heuristics that even myself remember how it works.
-        indent = block.userState() >> 20;
-        if (indent < 0) {
-            while (indent == -1 && previous.isValid()) {
-                indent = previous.userState() >> 20;
-                previous = previous.previous();
-            }
-        }
-
-        if (didBlockStart(block) && indent > 0)
+        // Not highlighted since it changed, the depth at the end of the
+        // previous line is in its state. 0 if that one wasn't either.
+        indent = blockState(previous) >> OCaml::Lexer::StateBits;
+        if (startsWithCloser(block) && indent > 0)
             indent--;
     }
 
     settings.indentLine(block, indent  * settings.m_indentSize);
 }
 
+// Runs on every new line, so it stays in memory: a run of ocp-indent would
+// block the editor on a process and on the text up to the line.
+void Indenter::indentBlock(QTextDocument*, const QTextBlock &block, const QChar &, const TextEditor::TabSettings &settings)
+{
+    indentByNesting(block, settings);
+}
+
+void Indenter::indent(QTextDocument *document, const QTextCursor &cursor, const QChar &typedChar,
+                      const TextEditor::TabSettings &settings)
+{
+    if (!cursor.hasSelection()) {
+        indentBlock(document, cursor.block(), typedChar, settings);
+        return;
+    }
+
+    const QTextBlock first = document->findBlock(cursor.selectionStart());
+    const QTextBlock last = document->findBlock(cursor.selectionEnd());
+    const QVector<int> indents = ocpIndent(document, first.blockNumber(), last.blockNumber(),
+                                           settings.m_indentSize);
+
+    QTextCursor editCursor(document);
+    editCursor.beginEditBlock();
+    int index = 0;
+    for (QTextBlock block = first; block.isValid() && block.blockNumber() <= last.blockNumber();
+         block = block.next(), ++index) {
+        if (indents.isEmpty())
+            indentByNesting(block, settings);
+        else
+            settings.indentLine(block, indents.at(index));
+    }
+    editCursor.endEditBlock();
+}
+
 }
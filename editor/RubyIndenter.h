@@ -6,11 +6,20 @@
 
 namespace OCamlCreator {
 
+// Indents lines as they are typed by the nesting depth the highlighter keeps.
+// A selection or a whole document is indented with a single ocp-indent run,
+// when it can be run, and a single undo step.
 class Indenter : public TextEditor::Indenter
 {
 public:
     bool isElectricCharacter(const QChar &) const override { return false; }
     void indentBlock(QTextDocument*, const QTextBlock &block, const QChar &, const TextEditor::TabSettings &settings) override;
+    void indent(QTextDocument *document, const QTextCursor &cursor, const QChar &typedChar,
+                const TextEditor::TabSettings &settings) override;
+
+    // The ocp-indent binary, next to merlin's if there is one, otherwise from
+    // PATH. Empty when there is none.
+    static QString ocpIndentExecutable();
 };
 
 }
@@ -4,7 +4,7 @@
 #include <texteditor/codeassist/assistinterface.h>
 #include <algorithm>
 
-#include "RubyScanner.h"
+#include "OCamlBlockData.h"
 #include "RubyRubocopHighlighter.h"
 
 namespace OCamlCreator {
@@ -20,9 +20,10 @@ void SwitchStringQuotes::matchingOperations(const TextEditor::QuickFixInterface
     QString line = block.text();
     int userCursorPosition = interface->position();
     int position = userCursorPosition - block.position();
-    Token token = Scanner::tokenAt(&line, position);
+    const OCaml::Token token = OCaml::tokenAt(block, position);
 
-    if (token.kind != OCamlCreator::Token::String)
+    // Quoted strings, {|...|}, have no quotes to switch.
+    if (token.kind != OCaml::Token::String || line[token.position] != '"')
         return;
 
     SwitchStringQuotesOp* operation = new SwitchStringQuotesOp(block, token, userCursorPosition);
@@ -36,7 +37,7 @@ void SwitchStringQuotes::matchingOperations(const TextEditor::QuickFixInterface
     result << operation;
 }
 
-SwitchStringQuotesOp::SwitchStringQuotesOp(QTextBlock &block, const Token &token, int userCursorPosition)
+SwitchStringQuotesOp::SwitchStringQuotesOp(QTextBlock &block, const OCaml::Token &token, int userCursorPosition)
     : m_block(block), m_token(token), m_userCursorPosition(userCursorPosition)
 {
 }
@@ -6,7 +6,7 @@
 #include <extensionsystem/iplugin.h>
 #include <texteditor/quickfix.h>
 
-#include "RubyScanner.h"
+#include "OCamlLexer.h"
 #include "RubyRubocopHighlighter.h"
 
 namespace OCamlCreator {
@@ -24,11 +24,11 @@ public:
 
 class SwitchStringQuotesOp : public TextEditor::QuickFixOperation {
 public:
-    SwitchStringQuotesOp(QTextBlock &block, const Token &token, int userCursorPosition);
+    SwitchStringQuotesOp(QTextBlock &block, const OCaml::Token &token, int userCursorPosition);
     void perform() override;
 private:
     QTextBlock m_block;
-    Token m_token;
+    OCaml::Token m_token;
     int m_userCursorPosition;
 };
 
@@ -1,5 +1,7 @@
 #include "OCamlCompletionAssist.cpp"
 #include "RubyRubocopHighlighter.h"
+#include "RubyEditorDocument.h"
+#include "OCamlSemanticHighlighter.h"
 
 #include <texteditor/refactoroverlay.h>
 #include <texteditor/textdocument.h>
@@ -28,6 +30,8 @@
 #include <QMessageBox>
 #include <QTextBlock>
 #include <QJsonDocument>
+#include <QFileInfo>
+#include <QMutex>
 
 namespace OCamlCreator
 {
@@ -107,11 +111,15 @@ public:
 
 struct MerlinRequestUsages : public MerlinRequestQTCDoc {
 public:
-    MerlinRequestUsages(const QStringList& _args, TextEditor::TextDocument *_doc)
-        : MerlinRequestQTCDoc(_args, _doc)
+    MerlinRequestUsages(const QStringList& _args, TextEditor::TextDocument *_doc,
+                        const RubocopHighlighter::OccurrencesHandler &h = RubocopHighlighter::OccurrencesHandler())
+        : MerlinRequestQTCDoc(_args, _doc), handler(h)
     {}
     const QString fsmEvent() const Q_DECL_OVERRIDE { return "occurencesAsked"; }
     const QString expectedState() const Q_DECL_OVERRIDE { return "occurencesSent"; }
+
+    // When set the occurrences go there, not to the search results.
+    RubocopHighlighter::OccurrencesHandler handler;
 };
 
 struct MerlinRequestGTD : public MerlinRequestQTCDoc {
@@ -346,6 +354,16 @@ void RubocopHighlighterPrivate::parseOccurencesJson(const QJsonValue &v, MerlinR
     else
         arr.push_back(v);
 
+    if (req->handler) {
+        QList<Range> ranges;
+        foreach (const QJsonValue& v, arr) {
+            Range r;
+            jsonParseStartEnd(v.toObject(), r.startLine, r.startCol, r.endLine, r.endCol);
+            ranges << r;
+        }
+        req->handler(ranges);
+        return;
+    }
 
     qDebug() << arr;
 
@@ -576,19 +594,23 @@ void RubocopHighlighterPrivate::parseDiagnosticsJson(const QJsonValue& resp, Mer
                                      );
         // tasks doesn't support specifying column. Maybe create a PR?
     }
-    {
-    RubocopFuture rubocopFuture(offenses);
+    // OCaml editors apply the extra formats of the semantic highlighting too,
+    // applying the diagnostics here would clear them.
+    if (auto ocamlDocument = dynamic_cast<EditorDocument *>(document)) {
+        ocamlDocument->semanticHighlighter()->setDiagnostics(offenses, m_extraFormats);
+    } else {
+        RubocopFuture rubocopFuture(offenses);
 
-    TextEditor::SemanticHighlighter::clearExtraAdditionalFormatsUntilEnd(document->syntaxHighlighter(),
-                                                                         rubocopFuture.future());
-    TextEditor::SemanticHighlighter::incrementalApplyExtraAdditionalFormats(document->syntaxHighlighter(),
-                                                                            rubocopFuture.future(), 0,
-                                                                            offenses.count(), m_extraFormats);
+        TextEditor::SemanticHighlighter::clearExtraAdditionalFormatsUntilEnd(document->syntaxHighlighter(),
+                                                                             rubocopFuture.future());
+        TextEditor::SemanticHighlighter::incrementalApplyExtraAdditionalFormats(document->syntaxHighlighter(),
+                                                                                rubocopFuture.future(), 0,
+                                                                                offenses.count(), m_extraFormats);
+    }
 //    q->generalMsg(QString("Got %1 offenses").arg(offenses.length()));
     emit q->codeWarningsUpdated(req->document()->filePath(),
                                 req->document()->document()->revision(),
                                 curInfo.markers );
-    }
 }
 
 void RubocopHighlighterPrivate::sendFSMevent(const QString &s)
@@ -614,6 +636,42 @@ RubocopHighlighter *RubocopHighlighter::instance()
     return &rubocop;
 }
 
+QString RubocopHighlighter::merlinExecutable()
+{
+    //TODO: We should start `opam config env` on startup and get env vars from there.
+    static const QString opamPath =
+//            "/home/kakadu/.opam/4.04.0+fp+flambda/bin/";
+            "/home/kakadu/.opam/4.02.2+multicore+moreplugins/bin/"
+//            ""
+            ;
+    return opamPath + "ocamlmerlin";
+}
+
+// Set from the GUI thread, read from the outline workers too.
+static QMutex merlinFlagsMutex;
+static QHash<QString, QStringList> merlinFlagsByDirectory;
+
+void RubocopHighlighter::setMerlinFlags(const QString &directory, const QStringList &flags)
+{
+    QMutexLocker locker(&merlinFlagsMutex);
+    if (flags.isEmpty())
+        merlinFlagsByDirectory.remove(directory);
+    else
+        merlinFlagsByDirectory.insert(directory, flags);
+}
+
+QStringList RubocopHighlighter::merlinFlags(const QString &fileName)
+{
+    QMutexLocker locker(&merlinFlagsMutex);
+    return merlinFlagsByDirectory.value(QFileInfo(fileName).path());
+}
+
+bool RubocopHighlighter::isBusy() const
+{
+    Q_D(const RubocopHighlighter);
+    return d->isBusy();
+}
+
 bool RubocopHighlighter::run(TextEditor::TextDocument *document, const QString &fileNameTip)
 {
 //    if (m_busy || m_rubocop->state() == QProcess::Starting)
@@ -660,6 +718,7 @@ void RubocopHighlighter::performGoToDefinition(TextEditor::TextDocument *documen
     const QString& pos = QString("%1:%2").arg(line).arg(column);
     auto path = document->filePath().toString();
     QStringList args { "locate", "-position", pos, "-filename", path };
+    args << merlinFlags(path);
     d->enqueMsg(new MerlinRequestGTD(args, document) );
 }
 
@@ -672,9 +731,23 @@ void RubocopHighlighter::performFindUsages(TextEditor::TextDocument *document, c
     const QString& pos = QString("%1:%2").arg(line).arg(column);
     auto path = document->filePath().toString();
     QStringList args { "occurrences", "-identifier-at", pos/*, "-filename", path*/ };
+    args << merlinFlags(path);
     d->enqueMsg(new MerlinRequestUsages(args, document) );
 }
 
+void RubocopHighlighter::performOccurrences(TextEditor::TextDocument *document, const int line,
+                                            const int column, const OccurrencesHandler &handler)
+{
+    if (!document)
+        return;
+
+    Q_D(RubocopHighlighter);
+    const QString& pos = QString("%1:%2").arg(line).arg(column);
+    QStringList args { "occurrences", "-identifier-at", pos };
+    args << merlinFlags(document->filePath().toString());
+    d->enqueMsg(new MerlinRequestUsages(args, document, handler) );
+}
+
 void RubocopHighlighter::performErrorsCheck(TextEditor::TextDocument *doc)
 {
     Q_D(RubocopHighlighter);
@@ -685,6 +758,7 @@ void RubocopHighlighter::performErrorsCheck(TextEditor::TextDocument *doc)
 
 //    auto path = Core::EditorManager::instance()->currentDocument()->filePath().toString();
     QStringList args {"errors" , "-filename", filePath };
+    args << merlinFlags(filePath);
     d->enqueMsg(new MerlinRequestErrors(args, doc) );
 }
 
@@ -758,15 +832,9 @@ void RubocopHighlighterPrivate::initRubocopProcess(const QStringList& args)
     // http://stackoverflow.com/questions/19409940/how-to-get-output-system-command-in-qt
     auto new_args = args;
     new_args.push_front("single");
-    //TODO: We should start `opam config env` on startup and get env vars from there.
-    static const QString opamPath =
-//            "/home/kakadu/.opam/4.04.0+fp+flambda/bin/";
-            "/home/kakadu/.opam/4.02.2+multicore+moreplugins/bin/"
-//            ""
-            ;
     m_rubocop->processEnvironment().insert("MERLIN_LOG"," /tmp/merlin.qtcreator.log");
     setBusy(true);
-    m_rubocop->start(opamPath + "ocamlmerlin", new_args);
+    m_rubocop->start(RubocopHighlighter::merlinExecutable(), new_args);
     qDebug() << QString("starting (PID=%1)").arg(m_rubocop->pid()) << "with args" << qPrintable(m_rubocop->arguments().join(' '));
 }
 
@@ -98,11 +98,27 @@ public:
     ~RubocopHighlighter();
 
     static RubocopHighlighter *instance();
+    // The ocamlmerlin binary every merlin request runs.
+    static QString merlinExecutable();
+
+    // Flags merlin gets for the files of directory, the include paths the
+    // project knows of, instead of finding them again for every file. Empty
+    // flags remove those of the directory.
+    static void setMerlinFlags(const QString &directory, const QStringList &flags);
+    static QStringList merlinFlags(const QString &fileName);
+
+    // Whether a merlin request is running, new ones would have to wait for it.
+    bool isBusy() const;
 
     bool run(TextEditor::TextDocument *document, const QString &fileNameTip);
     QString diagnosticAt(const Utils::FileName &file, int pos);
     void performGoToDefinition(TextEditor::TextDocument *document, const int line, const int column);
     void performFindUsages(TextEditor::TextDocument *document, const int line, const int column);
+    // Occurrences of the identifier at line (from 1) and column (from 0) of
+    // document, reported to handler instead of the search results pane.
+    using OccurrencesHandler = std::function<void (const QList<Range> &)>;
+    void performOccurrences(TextEditor::TextDocument *document, const int line, const int column,
+                            const OccurrencesHandler &handler);
     void performErrorsCheck(TextEditor::TextDocument*);
 
     using AsyncCompletionsAvailableHandler = std::function<void (TextEditor::IAssistProposal *)>;
@@ -1,11 +1,13 @@
 #include "RubyScanner.h"
 
-#include <QRegularExpression>
 #include <QString>
 #include <QSet>
 #include <QDebug>
 
+#include <cctype>
 #include <cstring>
+#include <map>
+#include <vector>
 
 namespace OCamlCreator {
 
@@ -76,19 +78,209 @@ static bool delimiterHasPair(QChar ch)
 
 #define SELF_DOT_PATTERN "(16_(2_)?18_(2_)?)?"
 #define METHOD_PATTERN "15_2_" SELF_DOT_PATTERN
-#define CLASS_MODULE_PATTERN "(19|20)_2_" SELF_DOT_PATTERN
+#define CLASS_MODULE_PATTERN "(19_|20_)2_" SELF_DOT_PATTERN
 //                                 if        ;if         a=if
 #define FLOWCTL_SHOULD_INC_INDENT  "^(2_)?21_|26_(2_)?21_|25_(2_)?21_"
 // Version without 21_ at end, used on readIdentifier
 #define FLOWCTL_SHOULD_INC_INDENT2 "^(2_)?" "|26_(2_)?" "|25_(2_)?"
-#define INDENT_INC "(" CLASS_MODULE_PATTERN "|" METHOD_PATTERN "|" FLOWCTL_SHOULD_INC_INDENT "|22_|23_|28_|30_)"
+// Shortest form of everything that opens a block, so that each one ends on its own token.
+#define INDENT_INC "(19_|20_)2_|15_2_|" FLOWCTL_SHOULD_INC_INDENT "|22_|23_|28_|30_"
+//                                  METHOD  (          &        parameter,         &
+#define PARAMETER_PATTERN METHOD_PATTERN "8_(2_)?(3_)?((2_)?(3_)?(2_)?9_(2_)?(17_)?(2_)?(3_)?(2_)?)*"
 
-static const QRegularExpression m_methodPattern(METHOD_PATTERN "$");
-//                                            METHOD  (          &        parameter,         &
-static const QRegularExpression m_parameterPattern(
-        METHOD_PATTERN "8_(2_)?(3_)?((2_)?(3_)?(2_)?9_(2_)?(17_)?(2_)?(3_)?(2_)?)*$");
-static const QRegularExpression m_contextPattern(CLASS_MODULE_PATTERN "$");
-static const QRegularExpression m_controlFlowShouldIncIndentPattern("(" FLOWCTL_SHOULD_INC_INDENT2 ")$");
+// The patterns above, over the kinds of the tokens read so far on the line, compiled
+// once into a DFA. The scanner moves it by one table lookup per token and asks
+// whether the tokens read so far end with a match.
+// Syntax: "N_" is a token of kind N, "^" the start of the line, ( | ) ? * as usual.
+class TokenSequenceAutomaton
+{
+public:
+    enum Pattern { Method, Parameter, Context, ControlFlowIndent, IndentIncrease, PatternCount };
+
+    TokenSequenceAutomaton();
+
+    static const TokenSequenceAutomaton &instance()
+    {
+        static const TokenSequenceAutomaton automaton;
+        return automaton;
+    }
+
+    // State before the first token of a line.
+    int lineStart() const { return m_lineStart; }
+    int next(int state, Token::Kind kind) const { return m_transitions[state * KindCount + kind]; }
+    bool matches(int state, Pattern pattern) const { return m_accepting[state] & (1 << pattern); }
+
+private:
+    enum { LineStartKind = Token::EndOfBlock + 1, KindCount, Epsilon = -1, AnyKind = -2 };
+
+    // Thompson NFA node: moves to next on a token of its kind, or follows its epsilon edges.
+    struct Node
+    {
+        int kind = Epsilon;
+        int next = -1;
+        std::vector<int> epsilon;
+        quint8 accepts = 0;
+    };
+    struct Fragment { int start; int end; };
+
+    int addNode();
+    Fragment parseAlternatives(const char *&pattern);
+    Fragment parseSequence(const char *&pattern);
+    Fragment parseItem(const char *&pattern);
+    std::vector<int> closure(std::vector<int> nodes) const;
+    int stateFor(const std::vector<int> &nodes);
+
+    std::vector<Node> m_nodes;
+    std::map<std::vector<int>, int> m_stateIds;
+    std::vector<std::vector<int>> m_states;
+    std::vector<int> m_transitions;
+    std::vector<quint8> m_accepting;
+    int m_lineStart;
+};
+
+TokenSequenceAutomaton::TokenSequenceAutomaton()
+{
+    static const char *const patterns[PatternCount] = {
+        METHOD_PATTERN,
+        PARAMETER_PATTERN,
+        CLASS_MODULE_PATTERN,
+        FLOWCTL_SHOULD_INC_INDENT2,
+        INDENT_INC
+    };
+
+    // Loops on any token, so that the patterns can start anywhere in the line.
+    const int any = addNode();
+    m_nodes[any].kind = AnyKind;
+    m_nodes[any].next = any;
+    for (int pattern = 0; pattern < PatternCount; ++pattern) {
+        const char *text = patterns[pattern];
+        const Fragment fragment = parseAlternatives(text);
+        Q_ASSERT(!*text);
+        m_nodes[any].epsilon.push_back(fragment.start);
+        m_nodes[fragment.end].accepts |= 1 << pattern;
+    }
+
+    // Subset construction, new states are appended while the loop runs.
+    const int start = stateFor(closure({ any }));
+    for (size_t state = 0; state < m_states.size(); ++state) {
+        for (int kind = 0; kind < KindCount; ++kind) {
+            std::vector<int> moved;
+            for (int node : m_states[state]) {
+                if (m_nodes[node].kind == kind || m_nodes[node].kind == AnyKind)
+                    moved.push_back(m_nodes[node].next);
+            }
+            const int target = stateFor(closure(moved));
+            m_transitions.push_back(target);
+        }
+    }
+    m_lineStart = m_transitions[start * KindCount + LineStartKind];
+}
+
+int TokenSequenceAutomaton::addNode()
+{
+    m_nodes.emplace_back();
+    return int(m_nodes.size()) - 1;
+}
+
+TokenSequenceAutomaton::Fragment TokenSequenceAutomaton::parseAlternatives(const char *&pattern)
+{
+    Fragment result = parseSequence(pattern);
+    while (*pattern == '|') {
+        ++pattern;
+        const Fragment other = parseSequence(pattern);
+        const int start = addNode();
+        const int end = addNode();
+        m_nodes[start].epsilon = { result.start, other.start };
+        m_nodes[result.end].epsilon.push_back(end);
+        m_nodes[other.end].epsilon.push_back(end);
+        result = { start, end };
+    }
+    return result;
+}
+
+TokenSequenceAutomaton::Fragment TokenSequenceAutomaton::parseSequence(const char *&pattern)
+{
+    const int start = addNode();
+    Fragment result = { start, start };
+    while (*pattern && *pattern != '|' && *pattern != ')') {
+        const Fragment item = parseItem(pattern);
+        m_nodes[result.end].epsilon.push_back(item.start);
+        result.end = item.end;
+    }
+    return result;
+}
+
+TokenSequenceAutomaton::Fragment TokenSequenceAutomaton::parseItem(const char *&pattern)
+{
+    Fragment atom;
+    if (*pattern == '(') {
+        ++pattern;
+        atom = parseAlternatives(pattern);
+        Q_ASSERT(*pattern == ')');
+        ++pattern;
+    } else {
+        int kind = 0;
+        if (*pattern == '^') {
+            kind = LineStartKind;
+            ++pattern;
+        } else {
+            Q_ASSERT(std::isdigit(*pattern));
+            while (std::isdigit(*pattern))
+                kind = kind * 10 + *pattern++ - '0';
+            Q_ASSERT(*pattern == '_');
+            ++pattern;
+        }
+        atom.start = addNode();
+        atom.end = addNode();
+        m_nodes[atom.start].kind = kind;
+        m_nodes[atom.start].next = atom.end;
+    }
+
+    if (*pattern == '?' || *pattern == '*') {
+        const int start = addNode();
+        const int end = addNode();
+        m_nodes[start].epsilon = { atom.start, end };
+        m_nodes[atom.end].epsilon.push_back(end);
+        if (*pattern == '*')
+            m_nodes[atom.end].epsilon.push_back(atom.start);
+        ++pattern;
+        atom = { start, end };
+    }
+    return atom;
+}
+
+std::vector<int> TokenSequenceAutomaton::closure(std::vector<int> nodes) const
+{
+    std::vector<bool> seen(m_nodes.size());
+    for (int node : nodes)
+        seen[node] = true;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        for (int next : m_nodes[nodes[i]].epsilon) {
+            if (!seen[next]) {
+                seen[next] = true;
+                nodes.push_back(next);
+            }
+        }
+    }
+    std::sort(nodes.begin(), nodes.end());
+    return nodes;
+}
+
+int TokenSequenceAutomaton::stateFor(const std::vector<int> &nodes)
+{
+    const auto it = m_stateIds.find(nodes);
+    if (it != m_stateIds.end())
+        return it->second;
+
+    quint8 accepting = 0;
+    for (int node : nodes)
+        accepting |= m_nodes[node].accepts;
+    const int state = int(m_states.size());
+    m_stateIds.emplace(nodes, state);
+    m_states.push_back(nodes);
+    m_accepting.push_back(accepting);
+    return state;
+}
 
 static bool isLineFeed(QChar ch)
 {
@@ -103,6 +295,7 @@ Scanner::Scanner(const QString *text)
     , m_lineStartOffset(0)
     , m_indentDepth(0)
 {
+    resetSequence();
 }
 
 void Scanner::enableContextRecognition()
@@ -163,24 +356,46 @@ QString Scanner::contextName() const
 
 int Scanner::indentVariation() const
 {
-    static const QRegularExpression indent(INDENT_INC);
-    static const QRegularExpression unindent("24_|29_|31_");
-    int delta = 0;
+    return m_indentVariation;
+}
+
+bool Scanner::didBlockInterrupt()
+{
+    return m_blockInterrupted;
+}
+
+void Scanner::resetSequence()
+{
+    m_sequenceState = TokenSequenceAutomaton::instance().lineStart();
+    m_indentVariation = 0;
+    m_blockInterrupted = false;
+}
 
-    int offset = -1;
-    while ((offset = m_tokenSequence.indexOf(indent, offset + 1)) != -1)
-        delta++;
-    offset = -1;
-    while ((offset = m_tokenSequence.indexOf(unindent, offset + 1)) != -1)
-        delta--;
+void Scanner::advanceSequence(Token::Kind kind)
+{
+    const TokenSequenceAutomaton &automaton = TokenSequenceAutomaton::instance();
+    m_sequenceState = automaton.next(m_sequenceState, kind);
+    if (automaton.matches(m_sequenceState, TokenSequenceAutomaton::IndentIncrease))
+        m_indentVariation++;
 
-    return delta;
+    switch (kind) {
+    case Token::KeywordEnd:
+    case Token::CloseBraces:
+    case Token::CloseBrackets:
+        m_indentVariation--;
+        break;
+    case Token::KeywordElseElsIfRescueEnsure:
+        m_blockInterrupted = true;
+        break;
+    default:
+        break;
+    }
 }
 
-bool Scanner::didBlockInterrupt()
+bool Scanner::sequenceMatches(int pattern) const
 {
-    static const QRegularExpression regex("27_");
-    return regex.match(m_tokenSequence).hasMatch();
+    return TokenSequenceAutomaton::instance().matches(m_sequenceState,
+                                                      TokenSequenceAutomaton::Pattern(pattern));
 }
 
 Token Scanner::onDefaultState()
@@ -199,7 +414,7 @@ Token Scanner::onDefaultState()
         m_src.move();
     }
     if (hasNewLine)
-        m_tokenSequence.clear();
+        resetSequence();
 
     Token token;
 
@@ -207,7 +422,7 @@ Token Scanner::onDefaultState()
         token = readFloatNumber();
     } else if (first == '\'' || first == '\"' || first == '`') {
         token = readStringLiteral(first, State_String);
-    } else if (m_methodPattern.match(m_tokenSequence).hasMatch()) {
+    } else if (sequenceMatches(TokenSequenceAutomaton::Method)) {
         token = readMethodDefinition();
     } else if (first.isLetter() || first == '_' || first == '@'
                || first == '$' || (first == ':' && m_src.peek() != ':')) {
@@ -246,8 +461,7 @@ Token Scanner::onDefaultState()
         token = readOperator(first);
     }
 
-    m_tokenSequence += QString::number(token.kind);
-    m_tokenSequence += '_';
+    advanceSequence(token.kind);
 
     return token;
 }
@@ -410,7 +624,7 @@ Token Scanner::readIdentifier()
         kind = Token::Global;
     } else if (value.at(0).isUpper()) {
         kind = Token::Constant;
-        if (m_hasContextRecognition && m_contextPattern.match(m_tokenSequence).hasMatch()) {
+        if (m_hasContextRecognition && sequenceMatches(TokenSequenceAutomaton::Context)) {
             m_context << value.toString();
             m_contextDepths << m_indentDepth;
         }
@@ -435,7 +649,7 @@ Token Scanner::readIdentifier()
         m_indentDepth++;
     } else if (value == "if" || value == "unless") {
         kind = Token::KeywordFlowControl;
-        if (m_controlFlowShouldIncIndentPattern.match(m_tokenSequence).hasMatch())
+        if (sequenceMatches(TokenSequenceAutomaton::ControlFlowIndent))
             m_indentDepth++;
     } else if (value == "while" || value == "until") {
         kind = Token::KeywordLoop;
@@ -452,14 +666,14 @@ Token Scanner::readIdentifier()
         kind = Token::KeywordVisibility;
     } else if (std::find(&RUBY_KEYWORDS[0], &RUBY_KEYWORDS[N_KEYWORDS], value.toUtf8()) != &RUBY_KEYWORDS[N_KEYWORDS]) {
         kind = Token::Keyword;
-    } else if (m_methodPattern.match(m_tokenSequence).hasMatch()) {
+    } else if (sequenceMatches(TokenSequenceAutomaton::Method)) {
         QChar ch = m_src.peek();
         while (!ch.isNull() && !ch.isSpace() && ch != '(' &&  ch != '#') {
             m_src.move();
             ch = m_src.peek();
         }
         kind = Token::Method;
-    } else if (m_parameterPattern.match(m_tokenSequence).hasMatch()) {
+    } else if (sequenceMatches(TokenSequenceAutomaton::Parameter)) {
         kind = Token::Parameter;
     }
 
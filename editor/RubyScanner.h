@@ -17,7 +17,7 @@ public:
     enum Kind
     {
         // Don't change these numbers until I find a better way to keep track of then in
-        // the regexes used against m_tokenSequence
+        // the token sequence patterns of the scanner
         Number        = 0,
         String        = 1,
         Whitespace    = 2,
@@ -122,6 +122,10 @@ private:
     void consumeUntil(const char* stopAt, const char* stopAfter = 0);
     void consumeRegexpModifiers();
 
+    void resetSequence();
+    void advanceSequence(Token::Kind kind);
+    bool sequenceMatches(int pattern) const;
+
     void clearState();
     void saveState(State state, QChar savedData);
     void parseState(State &state, QChar &savedData) const;
@@ -130,7 +134,10 @@ private:
     int m_state;
     bool m_hasContextRecognition;
 
-    QString m_tokenSequence;
+    // Where the tokens read so far on the line leave the token sequence automaton.
+    int m_sequenceState;
+    int m_indentVariation;
+    bool m_blockInterrupted;
 
     QStringList m_context;
     int m_line;
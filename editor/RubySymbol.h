@@ -8,12 +8,26 @@ namespace OCamlCreator {
 
 struct Symbol
 {
-    Symbol(const QString *file = 0) : file(file) { }
-    const QString *file;
+    // What declared the symbol in OCaml code.
+    enum Kind {
+        Value,
+        External,
+        Type,
+        Exception,
+        Module,
+        ModuleType,
+        Class
+    };
+
+    Symbol(const QString &file = QString()) : file(file), kind(Value) { }
+    // Symbols may outlive the model snapshot they were taken from, so keep a
+    // (implicitly shared) copy of the file name instead of pointing into it.
+    QString file;
     QString name;
     QString context;
     int line;
     int column;
+    Kind kind;
 };
 
 }
@@ -1,4 +1,6 @@
 #include "RubySymbolFilter.h"
+#include "RubyCodeModel.h"
+#include "OCamlFuzzyIndex.h"
 
 #include <coreplugin/editormanager/editormanager.h>
 #include <coreplugin/editormanager/ieditor.h>
@@ -6,31 +8,74 @@
 
 namespace OCamlCreator {
 
-SymbolFilter::SymbolFilter(SymbolProvider provider, const char *description, QChar shortcut)
+// Enough to fill the locator popup many times over, sorting more is wasted.
+static const int MaxResults = 500;
+
+SymbolFilter::SymbolFilter(SymbolProvider provider, const char *description, QChar shortcut,
+                           Scope scope)
     : m_icon(":/codemodel/images/func.png")
+    , m_typeIcon(":/codemodel/images/class.png")
+    , m_moduleIcon(":/codemodel/images/namespace.png")
     , m_symbolProvider(provider)
+    , m_revisionProvider([] { return CodeModel::instance()->revision(); })
+    , m_scope(scope)
+    , m_indexRevision(0)
 {
     setId(description);
     setDisplayName(tr(description));
     setShortcutString(shortcut);
     setIncludedByDefault(false);
 
-    connect(Core::EditorManager::instance(), &Core::EditorManager::currentEditorChanged,
-            this, &SymbolFilter::onCurrentEditorChanged);
+    if (m_scope == CurrentDocument) {
+        setEnabled(false);
+        connect(Core::EditorManager::instance(), &Core::EditorManager::currentEditorChanged,
+                this, &SymbolFilter::onCurrentEditorChanged);
+    }
+}
+
+std::shared_ptr<const FuzzyIndex> SymbolFilter::indexFor(const QString &fileName)
+{
+    QMutexLocker locker(&m_indexMutex);
+    const quint64 revision = m_revisionProvider();
+    if (!m_index || m_indexRevision != revision || m_indexFileName != fileName) {
+        m_index = std::make_shared<const FuzzyIndex>(m_symbolProvider(fileName));
+        m_indexRevision = revision;
+        m_indexFileName = fileName;
+    }
+    return m_index;
+}
 
+QIcon SymbolFilter::iconFor(const Symbol &symbol) const
+{
+    switch (symbol.kind) {
+    case Symbol::Type:
+    case Symbol::Exception:
+    case Symbol::Class:
+        return m_typeIcon;
+    case Symbol::Module:
+    case Symbol::ModuleType:
+        return m_moduleIcon;
+    default:
+        return m_icon;
+    }
 }
 
-QList<Core::LocatorFilterEntry> SymbolFilter::matchesFor(QFutureInterface<Core::LocatorFilterEntry> &, const QString &entry)
+QList<Core::LocatorFilterEntry> SymbolFilter::matchesFor(QFutureInterface<Core::LocatorFilterEntry> &future, const QString &entry)
 {
     QList<Core::LocatorFilterEntry> list;
-    QStringMatcher matcher(entry, Qt::CaseInsensitive);
+    const QString fileName = m_scope == CurrentDocument ? m_fileName.toString() : QString();
+    const std::shared_ptr<const FuzzyIndex> index = indexFor(fileName);
+    if (future.isCanceled())
+        return list;
 
-    const auto symbols = m_symbolProvider(m_fileName.toString());
-    for (const Symbol &symbol : symbols) {
-        if (matcher.indexIn(symbol.name) != -1) {
-            list << Core::LocatorFilterEntry(this, symbol.name, qVariantFromValue(symbol), m_icon);
-            list.last().extraInfo = symbol.context;
-        }
+    const QVector<FuzzyIndex::Match> matches = index->search(entry.trimmed(), MaxResults, [&future] {
+        return future.isCanceled();
+    });
+    list.reserve(matches.size());
+    for (const FuzzyIndex::Match &match : matches) {
+        const Symbol &symbol = index->symbol(match.index);
+        list << Core::LocatorFilterEntry(this, symbol.name, qVariantFromValue(symbol), iconFor(symbol));
+        list.last().extraInfo = symbol.context;
     }
     return list;
 }
@@ -42,11 +87,13 @@ void SymbolFilter::accept(Core::LocatorFilterEntry selection,
     Q_UNUSED(selectionStart)
     Q_UNUSED(selectionLength)
     Symbol symbol = selection.internalData.value<Symbol>();
-    Core::EditorManager::openEditorAt(*symbol.file, symbol.line, symbol.column);
+    Core::EditorManager::openEditorAt(symbol.file, symbol.line, symbol.column);
 }
 
 void SymbolFilter::refresh(QFutureInterface<void> &)
 {
+    QMutexLocker locker(&m_indexMutex);
+    m_index.reset();
 }
 
 void SymbolFilter::onCurrentEditorChanged(Core::IEditor *editor)
@@ -58,7 +105,7 @@ void SymbolFilter::onCurrentEditorChanged(Core::IEditor *editor)
     }
 
     m_fileName = editor->document()->filePath();
-    setEnabled(m_fileName.endsWith(".rb"));
+    setEnabled(m_fileName.endsWith(".ml") || m_fileName.endsWith(".mli"));
 }
 
 }
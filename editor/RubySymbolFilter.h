@@ -7,19 +7,32 @@
 
 #include <utils/fileutils.h>
 
+#include <QMutex>
+
 #include <functional>
+#include <memory>
 
 namespace Core { class IEditor; }
 
 namespace OCamlCreator {
 
+class FuzzyIndex;
+
 typedef std::function<QList<Symbol>(const QString &)> SymbolProvider;
+// Changes whenever the provider would return different symbols.
+typedef std::function<quint64()> RevisionProvider;
 
 class SymbolFilter : public  Core::ILocatorFilter
 {
     Q_OBJECT
 public:
-    SymbolFilter(SymbolProvider provider, const char *description, QChar shortcut);
+    enum Scope { CurrentDocument, AllFiles };
+
+    SymbolFilter(SymbolProvider provider, const char *description, QChar shortcut,
+                 Scope scope = AllFiles);
+
+    // The code model revision unless told otherwise.
+    void setRevisionProvider(const RevisionProvider &provider) { m_revisionProvider = provider; }
 
     QList<Core::LocatorFilterEntry> matchesFor(QFutureInterface<Core::LocatorFilterEntry> &future, const QString &entry) override;
     void accept(Core::LocatorFilterEntry selection,
@@ -28,11 +41,24 @@ public:
 
 private:
     void onCurrentEditorChanged(Core::IEditor *editor);
+    std::shared_ptr<const FuzzyIndex> indexFor(const QString &fileName);
+    QIcon iconFor(const Symbol &symbol) const;
 
 private:
     QIcon m_icon;
+    QIcon m_typeIcon;
+    QIcon m_moduleIcon;
     Utils::FileName m_fileName;
     SymbolProvider m_symbolProvider;
+    RevisionProvider m_revisionProvider;
+    Scope m_scope;
+
+    // The provider's symbols prepared for matching, rebuilt when the code model
+    // changed since (or another document is current). Searches run on worker threads.
+    QMutex m_indexMutex;
+    std::shared_ptr<const FuzzyIndex> m_index;
+    quint64 m_indexRevision;
+    QString m_indexFileName;
 };
 
 }
@@ -0,0 +1,258 @@
+#include "SourceCodeStream.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define OCAML_SCAN_SSE2
+#  include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#  define OCAML_SCAN_AVX2
+#  include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#endif
+
+namespace OCamlCreator {
+
+// The kernels run with the widest vectors available, then the narrower ones,
+// and finish with a scalar loop. Each lane holds one code unit, 16 bits for
+// QChar and 8 for UTF-8, the lane mask tells where the run stops.
+
+static inline int countTrailingZeros(unsigned mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return int(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+#ifdef OCAML_SCAN_SSE2
+template <typename Char> struct Sse2;
+
+template <>
+struct Sse2<QChar>
+{
+    typedef __m128i Vector;
+    enum { Lanes = 8, LaneBytes = 2 };
+    static const unsigned FullMask = 0xffff;
+
+    static Vector load(const QChar *text) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(text)); }
+    static Vector equals(Vector v, char c) { return _mm_cmpeq_epi16(v, _mm_set1_epi16(c)); }
+    static Vector either(Vector a, Vector b) { return _mm_or_si128(a, b); }
+    static Vector lowerCase(Vector v) { return _mm_or_si128(v, _mm_set1_epi16(0x20)); }
+    // lo <= v < lo + count
+    static Vector inRange(Vector v, char lo, int count)
+    {
+        const Vector offset = _mm_sub_epi16(v, _mm_set1_epi16(lo));
+        return _mm_cmpeq_epi16(_mm_subs_epu16(offset, _mm_set1_epi16(short(count - 1))),
+                               _mm_setzero_si128());
+    }
+    static unsigned mask(Vector v) { return unsigned(_mm_movemask_epi8(v)); }
+};
+
+template <>
+struct Sse2<char>
+{
+    typedef __m128i Vector;
+    enum { Lanes = 16, LaneBytes = 1 };
+    static const unsigned FullMask = 0xffff;
+
+    static Vector load(const char *text) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(text)); }
+    static Vector equals(Vector v, char c) { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+    static Vector either(Vector a, Vector b) { return _mm_or_si128(a, b); }
+    static Vector lowerCase(Vector v) { return _mm_or_si128(v, _mm_set1_epi8(0x20)); }
+    static Vector inRange(Vector v, char lo, int count)
+    {
+        const Vector offset = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+        return _mm_cmpeq_epi8(_mm_subs_epu8(offset, _mm_set1_epi8(char(count - 1))),
+                              _mm_setzero_si128());
+    }
+    static unsigned mask(Vector v) { return unsigned(_mm_movemask_epi8(v)); }
+};
+#endif
+
+#ifdef OCAML_SCAN_AVX2
+template <typename Char> struct Avx2;
+
+template <>
+struct Avx2<QChar>
+{
+    typedef __m256i Vector;
+    enum { Lanes = 16, LaneBytes = 2 };
+    static const unsigned FullMask = 0xffffffffu;
+
+    static Vector load(const QChar *text) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text)); }
+    static Vector equals(Vector v, char c) { return _mm256_cmpeq_epi16(v, _mm256_set1_epi16(c)); }
+    static Vector either(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+    static Vector lowerCase(Vector v) { return _mm256_or_si256(v, _mm256_set1_epi16(0x20)); }
+    static Vector inRange(Vector v, char lo, int count)
+    {
+        const Vector offset = _mm256_sub_epi16(v, _mm256_set1_epi16(lo));
+        return _mm256_cmpeq_epi16(_mm256_subs_epu16(offset, _mm256_set1_epi16(short(count - 1))),
+                                  _mm256_setzero_si256());
+    }
+    static unsigned mask(Vector v) { return unsigned(_mm256_movemask_epi8(v)); }
+};
+
+template <>
+struct Avx2<char>
+{
+    typedef __m256i Vector;
+    enum { Lanes = 32, LaneBytes = 1 };
+    static const unsigned FullMask = 0xffffffffu;
+
+    static Vector load(const char *text) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text)); }
+    static Vector equals(Vector v, char c) { return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c)); }
+    static Vector either(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+    static Vector lowerCase(Vector v) { return _mm256_or_si256(v, _mm256_set1_epi8(0x20)); }
+    static Vector inRange(Vector v, char lo, int count)
+    {
+        const Vector offset = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+        return _mm256_cmpeq_epi8(_mm256_subs_epu8(offset, _mm256_set1_epi8(char(count - 1))),
+                                 _mm256_setzero_si256());
+    }
+    static unsigned mask(Vector v) { return unsigned(_mm256_movemask_epi8(v)); }
+};
+#endif
+
+// Each kernel moves i over whole vectors and returns true with i on the
+// character the run stops at, false when the rest is shorter than a vector.
+template <typename Simd>
+struct Kernels
+{
+    typedef typename Simd::Vector Vector;
+
+    static bool stopAt(int &i, unsigned stops)
+    {
+        if (!stops)
+            return false;
+        i += countTrailingZeros(stops) / Simd::LaneBytes;
+        return true;
+    }
+
+    template <typename Char>
+    static bool blanks(const Char *text, int &i, int length)
+    {
+        for (; i + Simd::Lanes <= length; i += Simd::Lanes) {
+            const Vector v = Simd::load(text + i);
+            const unsigned accepted = Simd::mask(Simd::either(Simd::equals(v, ' '), Simd::equals(v, '\t')));
+            if (stopAt(i, ~accepted & Simd::FullMask))
+                return true;
+        }
+        return false;
+    }
+
+    template <typename Char>
+    static bool identifierChars(const Char *text, int &i, int length)
+    {
+        for (; i + Simd::Lanes <= length; i += Simd::Lanes) {
+            const Vector v = Simd::load(text + i);
+            const Vector letters = Simd::inRange(Simd::lowerCase(v), 'a', 26);
+            const Vector others = Simd::either(Simd::inRange(v, '0', 10),
+                                               Simd::either(Simd::equals(v, '_'), Simd::equals(v, '\'')));
+            const unsigned accepted = Simd::mask(Simd::either(letters, others));
+            if (stopAt(i, ~accepted & Simd::FullMask))
+                return true;
+        }
+        return false;
+    }
+
+    template <typename Char>
+    static bool any(const Char *text, int &i, int length, char a, char b, char c, char d)
+    {
+        for (; i + Simd::Lanes <= length; i += Simd::Lanes) {
+            const Vector v = Simd::load(text + i);
+            const unsigned found = Simd::mask(Simd::either(Simd::either(Simd::equals(v, a), Simd::equals(v, b)),
+                                                           Simd::either(Simd::equals(v, c), Simd::equals(v, d))));
+            if (stopAt(i, found))
+                return true;
+        }
+        return false;
+    }
+};
+
+template <typename Char>
+static int scanBlanksImpl(const Char *text, int i, int length)
+{
+#ifdef OCAML_SCAN_AVX2
+    if (Kernels<Avx2<Char>>::blanks(text, i, length))
+        return i;
+#endif
+#ifdef OCAML_SCAN_SSE2
+    if (Kernels<Sse2<Char>>::blanks(text, i, length))
+        return i;
+#endif
+    while (i < length && BasicSourceCodeStream<Char>::isBlank(codeUnit(text[i])))
+        ++i;
+    return i;
+}
+
+template <typename Char>
+static int scanIdentifierCharsImpl(const Char *text, int i, int length)
+{
+#ifdef OCAML_SCAN_AVX2
+    if (Kernels<Avx2<Char>>::identifierChars(text, i, length))
+        return i;
+#endif
+#ifdef OCAML_SCAN_SSE2
+    if (Kernels<Sse2<Char>>::identifierChars(text, i, length))
+        return i;
+#endif
+    while (i < length && BasicSourceCodeStream<Char>::isIdentifierChar(codeUnit(text[i])))
+        ++i;
+    return i;
+}
+
+template <typename Char>
+static int findAnyImpl(const Char *text, int i, int length, char a, char b, char c, char d)
+{
+#ifdef OCAML_SCAN_AVX2
+    if (Kernels<Avx2<Char>>::any(text, i, length, a, b, c, d))
+        return i;
+#endif
+#ifdef OCAML_SCAN_SSE2
+    if (Kernels<Sse2<Char>>::any(text, i, length, a, b, c, d))
+        return i;
+#endif
+    for (; i < length; ++i) {
+        const ushort u = codeUnit(text[i]);
+        if (u == codeUnit(a) || u == codeUnit(b) || u == codeUnit(c) || u == codeUnit(d))
+            return i;
+    }
+    return length;
+}
+
+int scanBlanks(const QChar *text, int from, int length)
+{
+    return scanBlanksImpl(text, from, length);
+}
+
+int scanIdentifierChars(const QChar *text, int from, int length)
+{
+    return scanIdentifierCharsImpl(text, from, length);
+}
+
+int findAny(const QChar *text, int from, int length, char a, char b, char c, char d)
+{
+    return findAnyImpl(text, from, length, a, b, c, d);
+}
+
+int scanBlanks(const char *text, int from, int length)
+{
+    return scanBlanksImpl(text, from, length);
+}
+
+int scanIdentifierChars(const char *text, int from, int length)
+{
+    return scanIdentifierCharsImpl(text, from, length);
+}
+
+int findAny(const char *text, int from, int length, char a, char b, char c, char d)
+{
+    return findAnyImpl(text, from, length, a, b, c, d);
+}
+
+}
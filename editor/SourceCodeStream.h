@@ -5,13 +5,36 @@
 
 namespace OCamlCreator {
 
-class SourceCodeStream
+inline ushort codeUnit(QChar ch)
+{
+    return ch.unicode();
+}
+
+inline ushort codeUnit(char ch)
+{
+    return uchar(ch);
+}
+
+// Index of the first character at or after from that is not a blank
+// (identifier character) or that is one of a, b, c and d, length when none is.
+int scanBlanks(const QChar *text, int from, int length);
+int scanIdentifierChars(const QChar *text, int from, int length);
+int findAny(const QChar *text, int from, int length, char a, char b, char c, char d);
+int scanBlanks(const char *text, int from, int length);
+int scanIdentifierChars(const char *text, int from, int length);
+int findAny(const char *text, int from, int length, char a, char b, char c, char d);
+
+// Cursor over UTF-16 (QChar) or UTF-8 (char) text, see SourceCodeStream and
+// Utf8SourceCodeStream. Positions and lengths count code units.
+template <typename CharType>
+class BasicSourceCodeStream
 {
 public:
-    SourceCodeStream(const QString *text)
-        : m_text(text)
-        , m_textPtr(m_text->data())
-        , m_textLength(text->length())
+    typedef CharType Char;
+
+    BasicSourceCodeStream(const Char *text, int length)
+        : m_textPtr(text)
+        , m_textLength(length)
         , m_position(0)
         , m_markedPosition(0)
     {}
@@ -46,14 +69,97 @@ public:
         return m_position >= m_textLength;
     }
 
+    const Char *constData() const
+    {
+        return m_textPtr;
+    }
+
+    // Bulk moves over runs of ASCII characters, vectorized where the CPU allows.
+    // They stop at the first character they don't accept, non ASCII included,
+    // callers deal with those one by one.
+
+    // Skips spaces and tabs.
+    inline void skipBlanks()
+    {
+        const int shortRunEnd = qMin(m_position + ShortRun, m_textLength);
+        while (m_position < shortRunEnd && isBlank(codeUnit(m_textPtr[m_position])))
+            ++m_position;
+        if (m_position == shortRunEnd)
+            m_position = scanBlanks(m_textPtr, m_position, m_textLength);
+    }
+
+    // Skips ASCII letters, digits, '_' and '\''.
+    inline void skipIdentifierChars()
+    {
+        const int shortRunEnd = qMin(m_position + ShortRun, m_textLength);
+        while (m_position < shortRunEnd && isIdentifierChar(codeUnit(m_textPtr[m_position])))
+            ++m_position;
+        if (m_position == shortRunEnd)
+            m_position = scanIdentifierChars(m_textPtr, m_position, m_textLength);
+    }
+
+    // Moves to the next of the given characters, or to the end of the text.
+    inline void skipToAny(char a, char b, char c)
+    {
+        skipToAny(a, b, c, c);
+    }
+
+    inline void skipToAny(char a, char b, char c, char d)
+    {
+        m_position = findAny(m_textPtr, m_position, m_textLength, a, b, c, d);
+    }
+
+    static bool isBlank(ushort u)
+    {
+        return u == ' ' || u == '\t';
+    }
+
+    static bool isIdentifierChar(ushort u)
+    {
+        return ushort((u | 0x20) - 'a') < 26 || ushort(u - '0') < 10 || u == '_' || u == '\'';
+    }
+
     inline QChar peek(int offset = 0) const
     {
         int pos = m_position + offset;
         if (pos >= m_textLength)
             return QChar();
-        return m_textPtr[pos];
+        return QChar(codeUnit(m_textPtr[pos]));
     }
 
+    // Like strcmp() between [position, position + length) and an ASCII string.
+    int compare(int position, int length, const char *ascii) const
+    {
+        for (int i = 0; i < length; ++i) {
+            const int c = uchar(ascii[i]);
+            if (!c)
+                return 1;
+            const int u = codeUnit(m_textPtr[position + i]);
+            if (u != c)
+                return u - c;
+        }
+        return ascii[length] ? -1 : 0;
+    }
+
+protected:
+    // Most identifiers and blanks are short, the vector loops only take over
+    // after this many characters.
+    enum { ShortRun = 8 };
+
+    const Char *m_textPtr;
+    const int m_textLength;
+    int m_position;
+    int m_markedPosition;
+};
+
+class SourceCodeStream : public BasicSourceCodeStream<QChar>
+{
+public:
+    SourceCodeStream(const QString *text)
+        : BasicSourceCodeStream<QChar>(text->constData(), text->length())
+        , m_text(text)
+    {}
+
     inline QStringRef value() const
     {
         return QStringRef(m_text, m_markedPosition, length());
@@ -64,12 +170,64 @@ public:
         return QStringRef(m_text, begin, length);
     }
 
+    QString text(int position, int length) const
+    {
+        return m_text->mid(position, length);
+    }
+
+    // Column of position on the line starting at lineStart.
+    int column(int lineStart, int position) const
+    {
+        return position - lineStart;
+    }
+
 private:
     const QString *m_text;
-    const QChar *m_textPtr;
-    const int m_textLength;
-    int m_position;
-    int m_markedPosition;
+};
+
+// UTF-8 bytes read without decoding them, e.g. straight from a mapped file.
+// Every non ASCII byte reads as the same lower case letter: multi byte
+// characters continue identifiers and are otherwise only seen in strings
+// and comments. Positions are byte offsets, text() decodes.
+class Utf8SourceCodeStream : public BasicSourceCodeStream<char>
+{
+public:
+    Utf8SourceCodeStream(const char *text, int length)
+        : BasicSourceCodeStream<char>(text, length)
+    {
+        // Byte order mark
+        if (length >= 3 && !qstrncmp(text, "\xef\xbb\xbf", 3))
+            m_position = m_markedPosition = 3;
+    }
+
+    inline QChar peek(int offset = 0) const
+    {
+        int pos = m_position + offset;
+        if (pos >= m_textLength)
+            return QChar();
+        const uchar c = uchar(m_textPtr[pos]);
+        return c < 0x80 ? QChar(ushort(c)) : QChar(ushort(0xe0));
+    }
+
+    QString text(int position, int length) const
+    {
+        return QString::fromUtf8(m_textPtr + position, length);
+    }
+
+    // UTF-16 column of position on the line starting at lineStart, so that
+    // both streams agree on columns.
+    int column(int lineStart, int position) const
+    {
+        int column = 0;
+        for (int i = lineStart; i < position; ++i) {
+            const uchar c = uchar(m_textPtr[i]);
+            if ((c & 0xc0) != 0x80)
+                ++column;
+            if (c >= 0xf0)
+                ++column;
+        }
+        return column;
+    }
 };
 
 }
@@ -0,0 +1,220 @@
+#include "OCamlDuneProject.h"
+#include "OCamlSexp.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QSet>
+
+namespace OCamlCreator {
+
+static QString moduleName(const QString &name)
+{
+    QString module = name;
+    if (!module.isEmpty())
+        module[0] = module.at(0).toUpper();
+    return module;
+}
+
+// What dune makes modules of.
+static bool isModuleSource(const QString &fileName)
+{
+    return fileName.endsWith(".ml") || fileName.endsWith(".mli")
+            || fileName.endsWith(".mll") || fileName.endsWith(".mly");
+}
+
+// The modules field in the ordered set language, enough of it: names,
+// :standard, "\" for the difference and nested sets.
+static QStringList evaluateModules(const QVector<Sexp> &elements, int first, const QStringList &standard)
+{
+    QStringList modules;
+    bool difference = false;
+    for (int i = first; i < elements.size(); ++i) {
+        const Sexp &element = elements.at(i);
+        QStringList names;
+        if (element.isList())
+            names = evaluateModules(element.list, 0, standard);
+        else if (element.atom == "\\")
+            difference = true;
+        else if (element.atom == ":standard")
+            names = standard;
+        else
+            names << moduleName(QString::fromUtf8(element.atom));
+
+        for (const QString &name : names) {
+            if (difference)
+                modules.removeAll(name);
+            else if (!modules.contains(name))
+                modules << name;
+        }
+    }
+    return modules;
+}
+
+static QStringList atoms(const Sexp &stanza, const char *field)
+{
+    QStringList values;
+    if (const Sexp *sexp = stanza.field(field)) {
+        for (const QByteArray &atom : sexp->arguments())
+            values << QString::fromUtf8(atom);
+    }
+    return values;
+}
+
+// Dependencies are names, or forms like (re_export name) and (select ...)
+// of which only the names are kept.
+static QStringList libraries(const Sexp &stanza)
+{
+    QStringList names;
+    const Sexp *field = stanza.field("libraries");
+    if (!field)
+        return names;
+    for (int i = 1; i < field->list.size(); ++i) {
+        const Sexp &element = field->list.at(i);
+        if (!element.isList())
+            names << QString::fromUtf8(element.atom);
+        else if (element.head() == "re_export" && element.list.size() == 2)
+            names << QString::fromUtf8(element.list.at(1).atom);
+    }
+    return names;
+}
+
+DuneProject::DuneProject(const QString &root)
+    : m_root(root)
+{
+}
+
+bool DuneProject::isDuneProject(const QString &directory)
+{
+    return QFileInfo(directory + "/dune-project").isFile();
+}
+
+void DuneProject::setDirectory(const QString &directory, const QByteArray &duneFile,
+                               const QStringList &sources)
+{
+    removeDirectory(directory);
+
+    QStringList standard;
+    for (const QString &source : sources) {
+        const QString fileName = QFileInfo(source).fileName();
+        if (!isModuleSource(fileName))
+            continue;
+        const QString module = moduleName(fileName.left(fileName.indexOf('.')));
+        if (!standard.contains(module))
+            standard << module;
+    }
+
+    QVector<Target> targets;
+    const QVector<Sexp> stanzas = Sexp::parse(duneFile);
+    for (const Sexp &stanza : stanzas) {
+        const QByteArray kind = stanza.head();
+        Target target;
+        target.directory = directory;
+        QStringList names;
+        QStringList publicNames;
+        if (kind == "library") {
+            target.kind = Target::Library;
+            names = atoms(stanza, "name");
+            publicNames = atoms(stanza, "public_name");
+        } else if (kind == "executable" || kind == "executables") {
+            target.kind = Target::Executable;
+            names = atoms(stanza, kind == "executable" ? "name" : "names");
+            publicNames = atoms(stanza, kind == "executable" ? "public_name" : "public_names");
+        } else if (kind == "test" || kind == "tests") {
+            target.kind = Target::Test;
+            names = atoms(stanza, kind == "test" ? "name" : "names");
+        } else {
+            continue;
+        }
+
+        const Sexp *modules = stanza.field("modules");
+        target.modules = modules ? evaluateModules(modules->list, 1, standard) : standard;
+        target.libraries = libraries(stanza);
+        target.stanzaName = names.value(0);
+        for (int i = 0; i < names.size(); ++i) {
+            target.name = names.at(i);
+            target.publicName = publicNames.value(i);
+            targets << target;
+            if (target.kind == Target::Library) {
+                m_libraries.insert(target.name, directory);
+                if (!target.publicName.isEmpty())
+                    m_libraries.insert(target.publicName, directory);
+            }
+        }
+    }
+    if (!targets.isEmpty())
+        m_targets.insert(directory, targets);
+}
+
+void DuneProject::removeDirectory(const QString &directory)
+{
+    const auto it = m_targets.find(directory);
+    if (it == m_targets.end())
+        return;
+    for (const Target &target : it.value()) {
+        if (m_libraries.value(target.name) == directory)
+            m_libraries.remove(target.name);
+        if (m_libraries.value(target.publicName) == directory)
+            m_libraries.remove(target.publicName);
+    }
+    m_targets.erase(it);
+}
+
+const DuneProject::Target *DuneProject::targetFor(const QString &file) const
+{
+    const auto it = m_targets.constFind(QFileInfo(file).path());
+    if (it == m_targets.cend())
+        return nullptr;
+    const QString fileName = QFileInfo(file).fileName();
+    const QString module = moduleName(fileName.left(fileName.indexOf('.')));
+    for (const Target &target : it.value()) {
+        if (target.modules.contains(module))
+            return &target;
+    }
+    return nullptr;
+}
+
+QStringList DuneProject::merlinFlags(const Target &target) const
+{
+    QStringList flags { "-source-path", target.directory, "-build-path", buildDirectory(target) };
+
+    QSet<QString> seen;
+    QStringList pending = target.libraries;
+    while (!pending.isEmpty()) {
+        const QString name = pending.takeFirst();
+        if (seen.contains(name))
+            continue;
+        seen << name;
+        if (const Target *dependency = library(name)) {
+            flags << "-source-path" << dependency->directory
+                  << "-build-path" << buildDirectory(*dependency);
+            pending << dependency->libraries;
+        } else {
+            flags << "-package" << name;
+        }
+    }
+    return flags;
+}
+
+// Where dune puts the compiled interfaces of target.
+QString DuneProject::buildDirectory(const Target &target) const
+{
+    const QString relative = QDir(m_root).relativeFilePath(target.directory);
+    QString path = m_root + "/_build/default/";
+    if (relative != ".")
+        path += relative + '/';
+    return path + '.' + target.stanzaName + (target.kind == Target::Library ? ".objs" : ".eobjs") + "/byte";
+}
+
+const DuneProject::Target *DuneProject::library(const QString &name) const
+{
+    const auto it = m_targets.constFind(m_libraries.value(name));
+    if (it == m_targets.cend())
+        return nullptr;
+    for (const Target &target : it.value()) {
+        if (target.kind == Target::Library && (target.name == name || target.publicName == name))
+            return &target;
+    }
+    return nullptr;
+}
+
+}
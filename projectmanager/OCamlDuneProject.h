@@ -0,0 +1,67 @@
+#ifndef OCaml_DuneProject_h
+#define OCaml_DuneProject_h
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace OCamlCreator {
+
+// The libraries, executables and tests of a dune project, read from the dune
+// file of each directory. Directories are added and removed one at a time as
+// the project scans find them, paths are absolute.
+class DuneProject
+{
+public:
+    struct Target
+    {
+        enum Kind { Library, Executable, Test };
+
+        Kind kind = Library;
+        QString name;
+        QString publicName;
+        // The first name of its stanza: the executables or tests of one stanza
+        // are compiled together, in the build directory of that name.
+        QString stanzaName;
+        QString directory;
+        // Module names, capitalized.
+        QStringList modules;
+        // The libraries it uses, by name or public name.
+        QStringList libraries;
+    };
+
+    explicit DuneProject(const QString &root);
+
+    // Whether directory is the root of a dune project.
+    static bool isDuneProject(const QString &directory);
+
+    // The targets of the dune file contents of directory, sources being the
+    // file names of the directory the default module list comes from.
+    void setDirectory(const QString &directory, const QByteArray &duneFile, const QStringList &sources);
+    void removeDirectory(const QString &directory);
+    QStringList directories() const { return m_targets.keys(); }
+
+    QVector<Target> targets(const QString &directory) const { return m_targets.value(directory); }
+    // The target the module of file belongs to, nullptr when none does.
+    const Target *targetFor(const QString &file) const;
+
+    // What merlin needs for the files of target: the source and build
+    // directories of the target and of the project libraries it uses, even
+    // indirectly, and the other libraries as findlib packages.
+    QStringList merlinFlags(const Target &target) const;
+
+private:
+    QString buildDirectory(const Target &target) const;
+    const Target *library(const QString &name) const;
+
+    QString m_root;
+    QHash<QString, QVector<Target>> m_targets;
+    // Directories of the libraries, by name and by public name.
+    QHash<QString, QString> m_libraries;
+};
+
+}
+
+#endif
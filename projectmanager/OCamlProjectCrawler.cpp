@@ -0,0 +1,187 @@
+#include "OCamlProjectCrawler.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QtConcurrent>
+
+namespace OCamlCreator {
+
+// What dune, opam, esy and version control keep in the project directory.
+static const char BuiltInRules[] =
+        ".git/\n"
+        "_build/\n"
+        "_opam/\n"
+        "_esy/\n"
+        "node_modules/\n";
+
+// The gitignore glob as an anchored regular expression: "*" and "?" stop at
+// slashes, "**" doesn't.
+static QString globToRegExp(const QString &glob)
+{
+    QString pattern;
+    for (int i = 0; i < glob.size(); ++i) {
+        const QChar c = glob.at(i);
+        if (c == '*') {
+            if (i + 1 < glob.size() && glob.at(i + 1) == '*') {
+                ++i;
+                if (i + 1 < glob.size() && glob.at(i + 1) == '/') {
+                    ++i;
+                    pattern += "(?:.*/)?";
+                } else {
+                    pattern += ".*";
+                }
+            } else {
+                pattern += "[^/]*";
+            }
+        } else if (c == '?') {
+            pattern += "[^/]";
+        } else if (c == '[' && glob.indexOf(']', i + 2) > 0) {
+            const int end = glob.indexOf(']', i + 2);
+            QString set = glob.mid(i + 1, end - i - 1);
+            if (set.startsWith('!'))
+                set[0] = '^';
+            pattern += '[' + set + ']';
+            i = end;
+        } else if (c == '\\' && i + 1 < glob.size()) {
+            pattern += QRegularExpression::escape(glob.at(++i));
+        } else {
+            pattern += QRegularExpression::escape(c);
+        }
+    }
+    return '^' + pattern + '$';
+}
+
+IgnoreRules IgnoreRules::forProject(const QString &projectDir)
+{
+    IgnoreRules rules = IgnoreRules().withRules(projectDir, BuiltInRules);
+    QFile file(projectDir + "/.ocamlcreatorignore");
+    if (file.open(QIODevice::ReadOnly))
+        rules = rules.withRules(projectDir, file.readAll());
+    return rules;
+}
+
+IgnoreRules IgnoreRules::withGitIgnore(const QString &directory) const
+{
+    QFile file(directory + "/.gitignore");
+    if (!file.open(QIODevice::ReadOnly))
+        return *this;
+    return withRules(directory, file.readAll());
+}
+
+IgnoreRules IgnoreRules::withRules(const QString &directory, const QByteArray &contents) const
+{
+    IgnoreRules rules = *this;
+    const QList<QByteArray> lines = contents.split('\n');
+    for (const QByteArray &line : lines) {
+        QString glob = QString::fromUtf8(line);
+        while (glob.endsWith(' ') || glob.endsWith('\t') || glob.endsWith('\r'))
+            glob.chop(1);
+        if (glob.isEmpty() || glob.startsWith('#'))
+            continue;
+
+        Rule rule;
+        rule.directory = directory;
+        rule.negated = glob.startsWith('!');
+        if (rule.negated)
+            glob.remove(0, 1);
+        else if (glob.startsWith("\\!") || glob.startsWith("\\#"))
+            glob.remove(0, 1);
+        rule.directoryOnly = glob.endsWith('/');
+        if (rule.directoryOnly)
+            glob.chop(1);
+        // A slash anywhere but at the end ties the rule to the directory.
+        rule.anchored = glob.contains('/');
+        if (glob.startsWith('/'))
+            glob.remove(0, 1);
+        if (glob.isEmpty())
+            continue;
+
+        rule.pattern.setPattern(globToRegExp(glob));
+        rule.pattern.optimize();
+        rules.m_rules << rule;
+    }
+    return rules;
+}
+
+bool IgnoreRules::isIgnored(const QString &path, bool isDirectory) const
+{
+    const QStringRef name = path.midRef(path.lastIndexOf('/') + 1);
+    bool ignored = false;
+    for (const Rule &rule : m_rules) {
+        if (ignored != rule.negated || (rule.directoryOnly && !isDirectory))
+            continue;
+        const int length = rule.directory.size();
+        if (path.size() <= length || path.at(length) != '/' || !path.startsWith(rule.directory))
+            continue;
+        if (rule.pattern.match(rule.anchored ? path.midRef(length + 1) : name).hasMatch())
+            ignored = !rule.negated;
+    }
+    return ignored;
+}
+
+struct ProjectCrawler::Lister
+{
+    typedef Directory result_type;
+
+    struct Pending
+    {
+        QString path;
+        IgnoreRules rules;
+    };
+
+    explicit Lister(const ProjectCrawler *crawler) : crawler(crawler) {}
+
+    Directory operator()(const Pending &pending) const
+    {
+        return crawler->list(pending.path, pending.rules);
+    }
+
+    const ProjectCrawler *crawler;
+};
+
+ProjectCrawler::ProjectCrawler(const QRegularExpression &filePattern)
+    : m_filePattern(filePattern)
+{
+}
+
+ProjectCrawler::Directory ProjectCrawler::list(const QString &path, const IgnoreRules &rules) const
+{
+    Directory directory;
+    directory.rules = rules.withGitIgnore(path);
+    const auto entries = QDir(path).entryInfoList(QDir::AllDirs | QDir::Files | QDir::NoDotAndDotDot
+                                                  | QDir::NoSymLinks | QDir::CaseSensitive);
+    for (const QFileInfo &info : entries) {
+        const QString entry = info.filePath();
+        const bool isDirectory = info.isDir();
+        if (directory.rules.isIgnored(entry, isDirectory))
+            continue;
+        if (isDirectory)
+            directory.subdirectories << entry;
+        else if (m_filePattern.match(info.fileName()).hasMatch())
+            directory.files << entry;
+    }
+    return directory;
+}
+
+QHash<QString, ProjectCrawler::Directory> ProjectCrawler::crawl(const QString &path,
+                                                                const IgnoreRules &rules) const
+{
+    QHash<QString, Directory> directories;
+    QList<Lister::Pending> level;
+    level << Lister::Pending{path, rules};
+    while (!level.isEmpty()) {
+        const QList<Directory> listed = QtConcurrent::blockingMapped(level, Lister(this));
+        QList<Lister::Pending> next;
+        for (int i = 0; i < level.size(); ++i) {
+            const Directory &directory = listed.at(i);
+            for (const QString &subdirectory : directory.subdirectories)
+                next << Lister::Pending{subdirectory, directory.rules};
+            directories.insert(level.at(i).path, directory);
+        }
+        level.swap(next);
+    }
+    return directories;
+}
+
+}
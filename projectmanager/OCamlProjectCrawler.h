@@ -0,0 +1,71 @@
+#ifndef OCaml_ProjectCrawler_h
+#define OCaml_ProjectCrawler_h
+
+#include <QHash>
+#include <QRegularExpression>
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+namespace OCamlCreator {
+
+// Which paths of a project are left out: the build output and version control
+// directories, then the rules of the .ocamlcreatorignore file at the project
+// root and of the .gitignore files, with the gitignore syntax. Rules read later,
+// from deeper directories, win, so "!_build/" brings a built-in one back.
+class IgnoreRules
+{
+public:
+    static IgnoreRules forProject(const QString &projectDir);
+
+    // These rules and those of the .gitignore of directory, if it has one.
+    IgnoreRules withGitIgnore(const QString &directory) const;
+    // These rules and those in contents, relative to directory.
+    IgnoreRules withRules(const QString &directory, const QByteArray &contents) const;
+
+    bool isIgnored(const QString &path, bool isDirectory) const;
+
+private:
+    struct Rule
+    {
+        QString directory;
+        QRegularExpression pattern;
+        // Matched against the path from directory, otherwise the name only.
+        bool anchored;
+        bool directoryOnly;
+        bool negated;
+    };
+
+    QVector<Rule> m_rules;
+};
+
+// Lists the project directories on the thread pool, one level of the tree at a
+// time, without going into the ignored ones. Paths are absolute.
+class ProjectCrawler
+{
+public:
+    struct Directory
+    {
+        QSet<QString> files;
+        QSet<QString> subdirectories;
+        // The rules for what the directory holds, its .gitignore included.
+        IgnoreRules rules;
+    };
+
+    explicit ProjectCrawler(const QRegularExpression &filePattern);
+
+    // The files of the directory that match the pattern and its subdirectories,
+    // rules being those of the parent directory.
+    Directory list(const QString &path, const IgnoreRules &rules) const;
+    // Every directory from path down.
+    QHash<QString, Directory> crawl(const QString &path, const IgnoreRules &rules) const;
+
+private:
+    struct Lister;
+
+    QRegularExpression m_filePattern;
+};
+
+}
+
+#endif
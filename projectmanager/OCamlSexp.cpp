@@ -0,0 +1,168 @@
+#include "OCamlSexp.h"
+
+namespace OCamlCreator {
+
+namespace {
+
+class Reader
+{
+public:
+    explicit Reader(const QByteArray &contents)
+        : m_data(contents.constData()), m_end(contents.constData() + contents.size()) {}
+
+    // Reads expressions until a closing parenthesis or the end, false on an
+    // unexpected one of those.
+    bool readList(QVector<Sexp> &list, bool nested)
+    {
+        for (;;) {
+            skipBlanks();
+            if (m_data == m_end)
+                return !nested;
+            if (*m_data == ')') {
+                ++m_data;
+                return nested;
+            }
+            if (m_data + 1 < m_end && m_data[0] == '#' && m_data[1] == ';') {
+                m_data += 2;
+                Sexp ignored;
+                if (!read(ignored))
+                    return false;
+                continue;
+            }
+            Sexp sexp;
+            if (!read(sexp))
+                return false;
+            list << sexp;
+        }
+    }
+
+private:
+    bool read(Sexp &sexp)
+    {
+        skipBlanks();
+        if (m_data == m_end || *m_data == ')')
+            return false;
+        if (*m_data == '(') {
+            ++m_data;
+            sexp.kind = Sexp::List;
+            return readList(sexp.list, true);
+        }
+        sexp.kind = Sexp::Atom;
+        if (*m_data == '"')
+            return readString(sexp.atom);
+        const char *start = m_data;
+        while (m_data != m_end && !isDelimiter(*m_data))
+            ++m_data;
+        sexp.atom = QByteArray(start, int(m_data - start));
+        return true;
+    }
+
+    bool readString(QByteArray &atom)
+    {
+        ++m_data;
+        while (m_data != m_end && *m_data != '"') {
+            if (*m_data == '\\' && m_data + 1 < m_end) {
+                ++m_data;
+                switch (*m_data) {
+                case 'n': atom += '\n'; break;
+                case 't': atom += '\t'; break;
+                case '\n':
+                    // Line continuation, the next line's indentation goes too.
+                    while (m_data + 1 < m_end && (m_data[1] == ' ' || m_data[1] == '\t'))
+                        ++m_data;
+                    break;
+                default: atom += *m_data; break;
+                }
+            } else {
+                atom += *m_data;
+            }
+            ++m_data;
+        }
+        if (m_data == m_end)
+            return false;
+        ++m_data;
+        return true;
+    }
+
+    void skipBlanks()
+    {
+        while (m_data != m_end) {
+            const char c = *m_data;
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f') {
+                ++m_data;
+            } else if (c == ';') {
+                while (m_data != m_end && *m_data != '\n')
+                    ++m_data;
+            } else if (c == '#' && m_data + 1 < m_end && m_data[1] == '|') {
+                skipBlockComment();
+            } else {
+                return;
+            }
+        }
+    }
+
+    // Block comments nest.
+    void skipBlockComment()
+    {
+        int depth = 0;
+        while (m_data + 1 < m_end) {
+            if (m_data[0] == '#' && m_data[1] == '|') {
+                ++depth;
+                m_data += 2;
+            } else if (m_data[0] == '|' && m_data[1] == '#') {
+                m_data += 2;
+                if (--depth == 0)
+                    return;
+            } else {
+                ++m_data;
+            }
+        }
+        m_data = m_end;
+    }
+
+    static bool isDelimiter(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'
+                || c == '(' || c == ')' || c == '"' || c == ';';
+    }
+
+    const char *m_data;
+    const char *m_end;
+};
+
+} // anonymous namespace
+
+QByteArray Sexp::head() const
+{
+    if (kind != List || list.isEmpty() || list.first().kind != Atom)
+        return QByteArray();
+    return list.first().atom;
+}
+
+QList<QByteArray> Sexp::arguments() const
+{
+    QList<QByteArray> atoms;
+    for (int i = 1; i < list.size(); ++i) {
+        if (list.at(i).kind == Atom)
+            atoms << list.at(i).atom;
+    }
+    return atoms;
+}
+
+const Sexp *Sexp::field(const char *name) const
+{
+    for (const Sexp &element : list) {
+        if (element.head() == name)
+            return &element;
+    }
+    return nullptr;
+}
+
+QVector<Sexp> Sexp::parse(const QByteArray &contents)
+{
+    QVector<Sexp> sexps;
+    Reader(contents).readList(sexps, false);
+    return sexps;
+}
+
+}
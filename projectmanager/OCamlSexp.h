@@ -0,0 +1,36 @@
+#ifndef OCaml_Sexp_h
+#define OCaml_Sexp_h
+
+#include <QByteArray>
+#include <QList>
+#include <QVector>
+
+namespace OCamlCreator {
+
+// An s-expression as dune files have them: an atom, quoted strings being
+// atoms too, or a list.
+struct Sexp
+{
+    enum Kind { Atom, List };
+
+    Kind kind = Atom;
+    QByteArray atom;
+    QVector<Sexp> list;
+
+    bool isList() const { return kind == List; }
+    // The first atom of a list, the name of a stanza or a field.
+    QByteArray head() const;
+    // The atoms of a list after its head.
+    QList<QByteArray> arguments() const;
+    // The first element of the list whose head is name.
+    const Sexp *field(const char *name) const;
+
+    // The s-expressions of contents, in one pass over the bytes. Comments,
+    // block comments and "#;" commented out expressions are skipped. What
+    // follows a syntax error, an unbalanced parenthesis, is dropped.
+    static QVector<Sexp> parse(const QByteArray &contents);
+};
+
+}
+
+#endif
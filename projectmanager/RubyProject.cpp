@@ -1,40 +1,79 @@
 #include "RubyProject.h"
 
 #include "../editor/RubyCodeModel.h"
+#include "../editor/OCamlOutlineIndex.h"
+#include "../editor/RubyRubocopHighlighter.h"
 #include "../RubyConstants.h"
 #include "RubyProjectNode.h"
 
+#include <QCryptographicHash>
 #include <QDebug>
+#include <QFile>
 #include <QFileInfo>
 #include <QRegularExpression>
+#include <QStandardPaths>
 #include <QThread>
 
 #include <texteditor/textdocument.h>
+#include <utils/asconst.h>
 
 namespace OCamlCreator {
 
-const int MIN_TIME_BETWEEN_PROJECT_SCANS = 4500;
+// Changes come in bursts, a build or a checkout, the directories they touch
+// are rescanned together.
+const int MIN_TIME_BETWEEN_PROJECT_SCANS = 500;
+// The whole tree is walked again now and then, in case the watcher missed
+// something or ran out of watches.
+const int FULL_PROJECT_SCAN_INTERVAL = 5 * 60 * 1000;
+
+// One code model index and one merlin outline cache per project directory,
+// kept between sessions.
+static QString cacheFileFor(const QDir &projectDir, const QString &suffix)
+{
+    const QByteArray hash = QCryptographicHash::hash(projectDir.absolutePath().toUtf8(),
+                                                     QCryptographicHash::Sha1).toHex();
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            + "/OCamlCreator/" + QString::fromLatin1(hash) + suffix;
+}
 
 Project::Project(const Utils::FileName &fileName) :
-    ProjectExplorer::Project(Constants::OCaml::MimeType, fileName, [this] { scheduleProjectScan(); })
+    ProjectExplorer::Project(Constants::OCaml::MimeType, fileName, [this] { scheduleProjectScan(); }),
+    m_crawler(QRegularExpression("^(?:.+\\.(?:ml|mli|mll|mly)|dune|dune-project|.+\\.rubyproject(?:\\.user)?)$"))
 {
     m_projectDir = fileName.toFileInfo().dir();
-    m_rootNode = new ProjectNode(Utils::FileName::fromString(m_projectDir.dirName()));
+    m_codeModelIndex = cacheFileFor(m_projectDir, ".index");
+    m_outlineCache = cacheFileFor(m_projectDir, ".outline");
 
     m_projectScanTimer.setSingleShot(true);
-    connect(&m_projectScanTimer, &QTimer::timeout, this, &Project::populateProject);
+    connect(&m_projectScanTimer, &QTimer::timeout, this, &Project::scanChangedDirectories);
 
     populateProject();
-    CodeModel::instance()->addFiles(m_files.toList());
+    if (!rootProjectNode())
+        buildTree();
+
+    connect(&m_fsWatcher, &QFileSystemWatcher::directoryChanged, this, &Project::onDirectoryChanged);
+    // Dune files are watched for their contents.
+    connect(&m_fsWatcher, &QFileSystemWatcher::fileChanged, this, [this](const QString &path) {
+        onDirectoryChanged(QFileInfo(path).path());
+    });
 
-    connect(&m_fsWatcher, &QFileSystemWatcher::directoryChanged, this, &Project::scheduleProjectScan);
+    m_fullScanTimer.setInterval(FULL_PROJECT_SCAN_INTERVAL);
+    connect(&m_fullScanTimer, &QTimer::timeout, this, &Project::populateProject);
+    m_fullScanTimer.start();
 
     setDisplayName(m_projectDir.dirName());
 }
 
-ProjectExplorer::ProjectNode *Project::rootProjectNode() const
+Project::~Project()
+{
+    for (const QString &directory : Utils::asConst(m_merlinFlagDirectories))
+        RubocopHighlighter::setMerlinFlags(directory, QStringList());
+}
+
+void Project::onDirectoryChanged(const QString &path)
 {
-    return m_rootNode;
+    m_changedDirectories << path;
+    scheduleProjectScan();
 }
 
 void Project::scheduleProjectScan()
@@ -46,114 +85,232 @@ void Project::scheduleProjectScan()
             m_projectScanTimer.start();
         }
     } else {
-        populateProject();
+        scanChangedDirectories();
     }
 }
 
-void Project::populateProject()
+// Lists the changed directories again, and only them. New subdirectories are
+// walked, those that went away are forgotten along with what they held.
+void Project::scanChangedDirectories()
 {
     m_lastProjectScan.start();
-    QSet<QString> oldFiles(m_files);
-    m_files.clear();
-    recursiveScanDirectory(m_projectDir, m_files);
+    const QSet<QString> changedDirectories = m_changedDirectories;
+    m_changedDirectories.clear();
 
-    const auto removedFiles = oldFiles - m_files;
-    const auto addedFiles = m_files - oldFiles;
+    QSet<QString> addedFiles;
+    QSet<QString> removedFiles;
+    for (const QString &path : changedDirectories) {
+        // Gone with a parent handled before
+        if (!m_directories.contains(path))
+            continue;
+        if (!QFileInfo(path).isDir()) {
+            forgetDirectory(path, removedFiles);
+            continue;
+        }
 
-    removeNodes(removedFiles);
-    addNodes(addedFiles);
+        Directory directory = m_crawler.list(path, rulesFor(path));
+        readDirectory(path, directory);
+        const Directory known = m_directories.value(path);
+        removedFiles += known.files - directory.files;
+        addedFiles += directory.files - known.files;
+        for (const QString &subdirectory : known.subdirectories - directory.subdirectories)
+            forgetDirectory(subdirectory, removedFiles);
+        m_directories.insert(path, directory);
 
-    for (const QString &file : removedFiles)
-        CodeModel::instance()->removeSymbolsFrom(file);
-    for (const QString &file : addedFiles)
-        CodeModel::instance()->addFile(file);
-}
-
-void Project::recursiveScanDirectory(const QDir &dir, QSet<QString> &container)
-{
-    QRegularExpression projectFilePattern(".*\\.rubyproject(?:\\.user)?$");
-    const auto files = dir.entryInfoList(QDir::AllDirs | QDir::Files | QDir::NoDotAndDotDot
-                                         | QDir::NoSymLinks | QDir::CaseSensitive);
-    for (const QFileInfo &info : files) {
-        if (info.isDir())
-            recursiveScanDirectory(QDir(info.filePath()), container);
-        else if (projectFilePattern.match(info.fileName()).hasMatch())
-            container << info.filePath();
+        for (const QString &subdirectory : directory.subdirectories - known.subdirectories) {
+            QHash<QString, Directory> scanned = m_crawler.crawl(subdirectory, directory.rules);
+            for (auto it = scanned.begin(); it != scanned.end(); ++it) {
+                readDirectory(it.key(), it.value());
+                addedFiles += it->files;
+                m_directories.insert(it.key(), it.value());
+            }
+        }
     }
-    m_fsWatcher.addPath(dir.absolutePath());
+
+    updateWatchedPaths();
+    updateMerlinFlags();
+    updateFiles(addedFiles, removedFiles);
 }
 
-void Project::addNodes(const QSet<QString> &nodes)
+// The full walk, the first time and then as a consistency check.
+void Project::populateProject()
 {
-    using namespace ProjectExplorer;
+    m_lastProjectScan.start();
+    m_changedDirectories.clear();
+    m_projectScanTimer.stop();
+
+    const QString root = m_projectDir.absolutePath();
+    m_rules = IgnoreRules::forProject(root);
+    m_dune.reset(DuneProject::isDuneProject(root) ? new DuneProject(root) : nullptr);
+    QHash<QString, Directory> directories = m_crawler.crawl(root, m_rules);
 
-    const QChar sep = '/';
-    QStringList path;
-    for (const QString &node : nodes) {
-        path = m_projectDir.relativeFilePath(node).split(sep);
-        path.pop_back();
-        FolderNode *folder = findFolderFor(path);
-        folder->addNode(new FileNode(Utils::FileName::fromString(node), FileType::Source, false));
+    QSet<QString> files;
+    for (auto it = directories.begin(); it != directories.end(); ++it) {
+        readDirectory(it.key(), it.value());
+        files += it->files;
     }
+    m_directories.swap(directories);
+
+    updateWatchedPaths();
+    updateMerlinFlags();
+    updateFiles(files - m_files, m_files - files);
 }
 
-void Project::tryRemoveEmptyFolder(ProjectExplorer::FolderNode *folder)
+// The rules the parent of path leaves for it.
+IgnoreRules Project::rulesFor(const QString &path) const
 {
-    using namespace ProjectExplorer;
+    const auto parent = m_directories.constFind(QFileInfo(path).path());
+    return parent == m_directories.cend() ? m_rules : parent->rules;
+}
 
-    if (folder == m_rootNode)
+// In a dune project only the directories with a dune file, and the root,
+// bring their files. Their targets are read along.
+void Project::readDirectory(const QString &path, Directory &directory)
+{
+    if (!m_dune)
         return;
 
-    FolderNode *parent = folder->parentFolderNode();
-    if (parent && folder->fileNodes().empty() && folder->folderNodes().empty()) {
-        parent->removeNode(folder);
-        tryRemoveEmptyFolder(parent);
+    const QString duneFile = path + "/dune";
+    QFile file(duneFile);
+    if (directory.files.contains(duneFile) && file.open(QIODevice::ReadOnly)) {
+        m_dune->setDirectory(path, file.readAll(), directory.files.toList());
+        return;
     }
+    m_dune->removeDirectory(path);
+    if (path != m_projectDir.absolutePath())
+        directory.files.clear();
 }
 
-void Project::removeNodes(const QSet<QString> &nodes)
+void Project::forgetDirectory(const QString &path, QSet<QString> &files)
 {
-    using namespace ProjectExplorer;
-
+    const auto it = m_directories.find(path);
+    if (it == m_directories.end())
+        return;
+    const Directory directory = it.value();
+    m_directories.erase(it);
+    if (m_dune)
+        m_dune->removeDirectory(path);
 
-    for (const QString &node : nodes) {
-        QStringList path = m_projectDir.relativeFilePath(node).split('/');
-        path.pop_back();
-        FolderNode *folder = findFolderFor(path);
+    files += directory.files;
+    for (const QString &subdirectory : directory.subdirectories)
+        forgetDirectory(subdirectory, files);
+}
 
-        const auto files = folder->fileNodes();
-        for (FileNode *file : files) {
-            if (file->filePath().toString() == node) {
-                folder->removeNode(file);
-                tryRemoveEmptyFolder(folder);
-                break;
+// Every directory is watched but in dune projects, where only the dune files,
+// the directories that have one and those on the way to them are. New
+// directories elsewhere turn up with the next full scan.
+void Project::updateWatchedPaths()
+{
+    const QString root = m_projectDir.absolutePath();
+    QSet<QString> paths;
+    if (!m_dune) {
+        paths = m_directories.keys().toSet();
+    } else {
+        paths << root << root + "/dune-project";
+        for (auto it = m_directories.cbegin(); it != m_directories.cend(); ++it) {
+            const QString duneFile = it.key() + "/dune";
+            if (!it->files.contains(duneFile))
+                continue;
+            paths << duneFile;
+            for (QString path = it.key(); path.size() > root.size() && !paths.contains(path);
+                 path = QFileInfo(path).path()) {
+                paths << path;
             }
         }
     }
+
+    const QSet<QString> watched = (m_fsWatcher.directories() + m_fsWatcher.files()).toSet();
+    const QStringList removed = (watched - paths).toList();
+    const QStringList added = (paths - watched).toList();
+    if (!removed.isEmpty())
+        m_fsWatcher.removePaths(removed);
+    if (!added.isEmpty())
+        m_fsWatcher.addPaths(added);
 }
 
-ProjectExplorer::FolderNode *Project::findFolderFor(const QStringList &path)
+// Merlin gets the include paths of the dune targets of a directory with every
+// request on its files.
+void Project::updateMerlinFlags()
 {
-    using namespace ProjectExplorer;
-    FolderNode *folder = m_rootNode;
-
-    for (const QString &part : path) {
-        bool folderFound = false;
-        const auto subFolders = folder->folderNodes();
-        for (FolderNode *subFolder : subFolders) {
-            if (subFolder->displayName() == part) {
-                folder = subFolder;
-                folderFound = true;
-                break;
+    QSet<QString> directories;
+    if (m_dune) {
+        for (const QString &directory : m_dune->directories()) {
+            QStringList flags;
+            QSet<QString> seen;
+            for (const DuneProject::Target &target : m_dune->targets(directory)) {
+                const QStringList targetFlags = m_dune->merlinFlags(target);
+                for (int i = 0; i + 1 < targetFlags.size(); i += 2) {
+                    const QString flag = targetFlags.at(i) + ' ' + targetFlags.at(i + 1);
+                    if (seen.contains(flag))
+                        continue;
+                    seen << flag;
+                    flags << targetFlags.at(i) << targetFlags.at(i + 1);
+                }
             }
-        }
-        if (!folderFound) {
-            FolderNode *newFolder = new FolderNode(Utils::FileName::fromString(part));
-            folder->addNode(newFolder);
-            folder = newFolder;
+            RubocopHighlighter::setMerlinFlags(directory, flags);
+            directories << directory;
         }
     }
+    for (const QString &directory : m_merlinFlagDirectories - directories)
+        RubocopHighlighter::setMerlinFlags(directory, QStringList());
+    m_merlinFlagDirectories = directories;
+}
+
+void Project::updateFiles(const QSet<QString> &addedFiles, const QSet<QString> &removedFiles)
+{
+    if (addedFiles.isEmpty() && removedFiles.isEmpty())
+        return;
+
+    m_files -= removedFiles;
+    m_files += addedFiles;
+
+    buildTree();
+
+    for (const QString &file : removedFiles) {
+        CodeModel::instance()->removeSymbolsFrom(file);
+        OutlineIndex::instance()->removeFile(file);
+    }
+    CodeModel::instance()->addFiles(addedFiles.toList(), m_codeModelIndex);
+    OutlineIndex::instance()->refresh(addedFiles.toList(), m_outlineCache);
+}
+
+// The folder of path, relative to the project directory, made along with its
+// parents when it is not in folders yet.
+static ProjectExplorer::FolderNode *folderFor(const QString &path,
+                                              QHash<QString, ProjectExplorer::FolderNode *> &folders)
+{
+    using namespace ProjectExplorer;
+
+    const auto it = folders.constFind(path);
+    if (it != folders.cend())
+        return it.value();
+
+    const int slash = path.lastIndexOf('/');
+    FolderNode *parent = folderFor(slash < 0 ? QString() : path.left(slash), folders);
+    auto folder = new FolderNode(Utils::FileName::fromString(path.mid(slash + 1)));
+    parent->addNode(folder);
+    folders.insert(path, folder);
     return folder;
 }
 
+// Builds the tree of m_files aside, in one pass, and hands it to the project
+// explorer in one go instead of a change per node.
+void Project::buildTree()
+{
+    using ProjectExplorer::FileNode;
+    using ProjectExplorer::FolderNode;
+
+    auto root = new ProjectNode(Utils::FileName::fromString(m_projectDir.dirName()));
+    QHash<QString, FolderNode *> folders;
+    folders.insert(QString(), root);
+    for (const QString &file : Utils::asConst(m_files)) {
+        const QString path = m_projectDir.relativeFilePath(file);
+        const int slash = path.lastIndexOf('/');
+        FolderNode *folder = folderFor(slash < 0 ? QString() : path.left(slash), folders);
+        folder->addNode(new FileNode(Utils::FileName::fromString(file), ProjectExplorer::FileType::Source,
+                                     false));
+    }
+    setRootProjectNode(root);
+}
+
 }
@@ -4,8 +4,14 @@
 #include <projectexplorer/project.h>
 #include <projectexplorer/projectnodes.h>
 
+#include "OCamlDuneProject.h"
+#include "OCamlProjectCrawler.h"
+
 #include <QFileSystemWatcher>
 #include <QElapsedTimer>
+#include <QHash>
+#include <QScopedPointer>
+#include <QSet>
 #include <QTimer>
 
 namespace TextEditor { class TextDocument; }
@@ -20,28 +26,42 @@ class Project : public ProjectExplorer::Project
 
 public:
     explicit Project(const Utils::FileName &fileName);
-    ProjectExplorer::ProjectNode *rootProjectNode() const override;
+    ~Project() override;
 
 private:
+    typedef ProjectCrawler::Directory Directory;
+
+    void onDirectoryChanged(const QString &path);
     void scheduleProjectScan();
+    void scanChangedDirectories();
     void populateProject();
 
-    void recursiveScanDirectory(const QDir &dir, QSet<QString> &container);
-    void addNodes(const QSet<QString> &nodes);
-    void removeNodes(const QSet<QString> &nodes);
-
-    ProjectExplorer::FolderNode *findFolderFor(const QStringList &path);
-    void tryRemoveEmptyFolder(ProjectExplorer::FolderNode* folder);
+    IgnoreRules rulesFor(const QString &path) const;
+    void readDirectory(const QString &path, Directory &directory);
+    void forgetDirectory(const QString &path, QSet<QString> &files);
+    void updateWatchedPaths();
+    void updateMerlinFlags();
+    void updateFiles(const QSet<QString> &addedFiles, const QSet<QString> &removedFiles);
+    void buildTree();
 
 private:
-    ProjectNode *m_rootNode;
-
     QDir m_projectDir;
+    QString m_codeModelIndex;
+    QString m_outlineCache;
     QSet<QString> m_files;
+    ProjectCrawler m_crawler;
+    IgnoreRules m_rules;
+    // Every directory of the project as of the last scan but the ignored ones.
+    QHash<QString, Directory> m_directories;
+    // Set when the project directory has a dune-project file.
+    QScopedPointer<DuneProject> m_dune;
+    QSet<QString> m_merlinFlagDirectories;
+    QSet<QString> m_changedDirectories;
     QFileSystemWatcher m_fsWatcher;
 
     QElapsedTimer m_lastProjectScan;
     QTimer m_projectScanTimer;
+    QTimer m_fullScanTimer;
 };
 
 }